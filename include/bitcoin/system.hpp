@@ -28,6 +28,8 @@
 #include <bitcoin/system/version.hpp>
 #include <bitcoin/system/warnings.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_file.hpp>
+#include <bitcoin/system/chain/block_parser.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
@@ -35,11 +37,14 @@
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/json_reader.hpp>
+#include <bitcoin/system/chain/json_writer.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/prevout.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/snapshot.hpp>
 #include <bitcoin/system/chain/stripper.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
 #include <bitcoin/system/chain/witness.hpp>
@@ -117,6 +122,7 @@
 #include <bitcoin/system/hash/functions.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/hash/hmac.hpp>
+#include <bitcoin/system/hash/merkle_tree.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
 #include <bitcoin/system/hash/scrypt.hpp>
 #include <bitcoin/system/hash/siphash.hpp>
@@ -154,6 +160,7 @@
 #include <bitcoin/system/math/byteswap.hpp>
 #include <bitcoin/system/math/cast.hpp>
 #include <bitcoin/system/math/division.hpp>
+#include <bitcoin/system/math/fixed_uint256.hpp>
 #include <bitcoin/system/math/functional.hpp>
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/math/logarithm.hpp>
@@ -193,8 +200,12 @@
 #include <bitcoin/system/stream/streamers/byte_flipper.hpp>
 #include <bitcoin/system/stream/streamers/byte_reader.hpp>
 #include <bitcoin/system/stream/streamers/byte_writer.hpp>
+#include <bitcoin/system/stream/streamers/gather_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
+#include <bitcoin/system/stream/streamers/sha256x2_reader.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+#include <bitcoin/system/stream/streamers/slice_reader.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitreader.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitwriter.hpp>
@@ -226,10 +237,12 @@
 #include <bitcoin/system/wallet/addresses/qr_code.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_address.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_scanner.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_sender.hpp>
 #include <bitcoin/system/wallet/addresses/tiff.hpp>
 #include <bitcoin/system/wallet/addresses/uri.hpp>
 #include <bitcoin/system/wallet/addresses/uri_reader.hpp>
+#include <bitcoin/system/wallet/addresses/vanity_search.hpp>
 #include <bitcoin/system/wallet/addresses/witness_address.hpp>
 #include <bitcoin/system/wallet/keys/ec_point.hpp>
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
@@ -250,6 +263,7 @@
 #include <bitcoin/system/words/dictionary.hpp>
 #include <bitcoin/system/words/language.hpp>
 #include <bitcoin/system/words/languages.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
 #include <bitcoin/system/words/words.hpp>
 #include <bitcoin/system/words/catalogs/electrum.hpp>
 #include <bitcoin/system/words/catalogs/electrum_v1.hpp>
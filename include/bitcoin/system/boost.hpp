@@ -48,6 +48,7 @@
 // Avoid format.hpp here due to warning repetition (include in printer.cpp).
 #include <boost/algorithm/string.hpp>
 ////#include <boost/format.hpp> // /config/printer.cpp
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/iostreams/stream.hpp>
 #include <boost/json.hpp>
 #include <boost/locale.hpp>
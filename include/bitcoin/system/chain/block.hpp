@@ -65,6 +65,8 @@ public:
     block(std::istream& stream, bool witness) NOEXCEPT;
     block(reader&& source, bool witness) NOEXCEPT;
     block(reader& source, bool witness) NOEXCEPT;
+    block(slice_reader&& source, bool witness) NOEXCEPT;
+    block(slice_reader& source, bool witness) NOEXCEPT;
 
     // Operators.
     // ------------------------------------------------------------------------
@@ -151,7 +153,10 @@ protected:
     // TX: error::confirmed_double_spend (prevout confirmation state)
 
 private:
-    static block from_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    static block from_data(Source& source, bool witness) NOEXCEPT;
+    static size_t serialized_size(const transaction_ptrs& txs,
+        bool witness) NOEXCEPT;
 
     // context free
     hash_digest generate_merkle_root(bool witness) const NOEXCEPT;
@@ -171,6 +176,10 @@ private:
     chain::header::cptr header_;
     chain::transactions_cptr txs_;
     bool valid_;
+
+    // Serialized sizes, cached on construction.
+    size_t nominal_size_;
+    size_t witness_size_;
 };
 
 typedef std::vector<block> blocks;
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILE_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILE_HPP
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Read-only memory-mapped file of concatenated (magic, size, block) records,
+/// as in the blk?????.dat files of a bitcoind data directory. The file is
+/// split into records on open without parsing blocks. Blocks are deserialized
+/// directly from the mapped pages (no copy to a read buffer), and scanning
+/// retains at most one batch of blocks at a time. Zero padding at the end of
+/// the file (preallocation) terminates the records without invalidating them.
+class BC_API block_file
+{
+public:
+    /// Location of a block within the file.
+    struct record
+    {
+        size_t offset;
+        size_t size;
+    };
+
+    typedef std::vector<record> records;
+
+    /// Handle a deserialized block, with its check() code and record index.
+    /// Return false to stop the scan.
+    typedef std::function<bool(const block::cptr&, const code&, size_t)>
+        handler;
+
+    /// Record prefix: magic (4 bytes) and block size (4 bytes), both LE.
+    static constexpr size_t prefix_size = sizeof(uint32_t) + sizeof(uint32_t);
+
+    /// Defaults.
+    block_file(block_file&&) = default;
+    block_file(const block_file&) = default;
+    block_file& operator=(block_file&&) = default;
+    block_file& operator=(const block_file&) = default;
+    ~block_file() = default;
+
+    /// Map the file and split it into records of the given network magic.
+    block_file(const std::filesystem::path& path, uint32_t magic) NOEXCEPT;
+
+    /// The file is mapped and all non-padding bytes are whole records.
+    /// False if the file cannot be mapped, or if a record has an unexpected
+    /// magic, an oversized block, or is truncated (records preceding the
+    /// failure remain available).
+    bool is_valid() const NOEXCEPT;
+
+    /// Total mapped bytes.
+    size_t size() const NOEXCEPT;
+
+    /// Record locations, in file order.
+    const records& index() const NOEXCEPT;
+
+    /// Serialized block of the record at the given index (empty if out of
+    /// range). Valid only for the lifetime of this object.
+    data_slice at(size_t index) const NOEXCEPT;
+
+    /// Deserialize and check() all blocks in batches of at most 'batch'
+    /// blocks, each batch in parallel, and pass them to handler in file
+    /// order. False if a block fails to deserialize (handler is not invoked
+    /// for it or any later block) or if the handler stopped the scan.
+    bool scan(const handler& handler, bool witness,
+        size_t batch) const NOEXCEPT;
+
+private:
+    bool split(uint32_t magic) NOEXCEPT;
+    static bool is_padding(const data_slice& data, size_t start) NOEXCEPT;
+
+    // These are thread safe (const after construction).
+    std::shared_ptr<boost::iostreams::mapped_file_source> file_;
+    records index_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
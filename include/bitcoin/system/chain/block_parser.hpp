@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_PARSER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_PARSER_HPP
+
+#include <memory>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Incremental (push) block deserializer for partially-received buffers.
+/// Chunks are buffered as they arrive and each element (header, transaction
+/// count, transaction) is parsed as soon as its bytes are complete, so that
+/// parsed transactions are available before the block is fully received.
+/// Buffered transactions are sized (without allocation) before deserializing,
+/// so each transaction is deserialized exactly once. An incomplete
+/// transaction is not sized again until enough bytes arrive for the read
+/// that it stopped on. Parsed bytes are dropped from the buffer once they are
+/// at least half of it, so buffering is linear. Bytes past the end of
+/// the block invalidate the parser, so the caller must split the stream by
+/// message payload size. Not thread safe.
+class BC_API block_parser
+{
+public:
+    /// Defaults.
+    block_parser(block_parser&&) = default;
+    block_parser& operator=(block_parser&&) = default;
+    ~block_parser() = default;
+
+    /// Copies do not share parsed transactions.
+    block_parser(const block_parser& other) NOEXCEPT;
+    block_parser& operator=(const block_parser& other) NOEXCEPT;
+
+    /// Parse a block serialized with or without witnesses (bip144).
+    block_parser(bool witness) NOEXCEPT;
+
+    /// Buffer the chunk and parse all elements completed by it.
+    /// False if the block is invalid, in which case subsequent pushes fail.
+    bool push(const data_slice& chunk) NOEXCEPT;
+
+    /// The block has been fully parsed.
+    bool is_complete() const NOEXCEPT;
+
+    /// The block is invalid (or bytes were pushed past its end).
+    bool is_invalid() const NOEXCEPT;
+
+    /// Bytes buffered but not yet parsed (need more).
+    size_t pending() const NOEXCEPT;
+
+    /// Declared transaction count (zero until parsed).
+    size_t expected() const NOEXCEPT;
+
+    /// Header, nullptr until parsed.
+    const header::cptr& header_ptr() const NOEXCEPT;
+
+    /// Transactions parsed so far, in block order.
+    const transaction_ptrs& transactions() const NOEXCEPT;
+
+    /// The parsed block, default (invalid) unless complete.
+    block to_block() const NOEXCEPT;
+
+    /// Serialized size of the transaction at the front of data, or zero if
+    /// data is incomplete or the transaction is invalid (sets invalid).
+    static size_t transaction_size(const data_slice& data,
+        bool& invalid) NOEXCEPT;
+
+    /// As above, and if incomplete sets required to a lower bound on the
+    /// number of bytes of data needed to size the transaction.
+    static size_t transaction_size(const data_slice& data, bool& invalid,
+        size_t& required) NOEXCEPT;
+
+private:
+    static std::shared_ptr<transaction_ptrs> copy(
+        const transaction_ptrs& txs) NOEXCEPT;
+
+    bool parse(const data_slice& data, size_t& offset) NOEXCEPT;
+
+    // These are not thread safe.
+    bool witness_;
+    bool invalid_;
+    bool counted_;
+    size_t expected_;
+    size_t offset_;
+    size_t required_;
+    header::cptr header_;
+    std::shared_ptr<transaction_ptrs> txs_;
+    data_chunk buffer_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
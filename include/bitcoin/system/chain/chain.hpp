@@ -20,6 +20,8 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_CHAIN_HPP
 
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_file.hpp>
+#include <bitcoin/system/chain/block_parser.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
@@ -36,11 +38,14 @@
 #include <bitcoin/system/chain/enums/script_version.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/json_reader.hpp>
+#include <bitcoin/system/chain/json_writer.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/prevout.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/snapshot.hpp>
 #include <bitcoin/system/chain/stripper.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
 #include <bitcoin/system/chain/witness.hpp>
@@ -21,10 +21,12 @@
 
 #include <memory>
 #include <deque>
+#include <vector>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/forks.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -196,6 +198,17 @@ public:
     /// This block height is less than or equal to that of the top checkpoint.
     bool is_under_checkpoint() const NOEXCEPT;
 
+    /// Validate a contiguous run of headers above this (parent) state.
+    /// Hashing and context free checks run in parallel (header hash caches
+    /// are not written). Contextual checks run in one pass, promoting a copy
+    /// of the last valid values for each header.
+    /// Returns the state of the last valid header (or of this header), with
+    /// index set to the first invalid header (or headers.size()) and ec to
+    /// the failure code (or success).
+    ptr validate(code& ec, size_t& index,
+        const std::vector<std::shared_ptr<const header>>& headers,
+        const system::settings& settings, bool scrypt=false) const NOEXCEPT;
+
 protected:
     struct activations
     {
@@ -237,6 +250,16 @@ private:
     static data to_header(const chain_state& parent, const header& header,
         const system::settings& settings) NOEXCEPT;
 
+    // In place promotion of values to the next height (pool) and header.
+    static void promote(data& values, uint32_t forks,
+        const system::settings& settings) NOEXCEPT;
+    static void promote(data& values, const header& header,
+        const system::settings& settings) NOEXCEPT;
+    static void promote(data& values, const header& header,
+        const hash_digest& hash, const system::settings& settings) NOEXCEPT;
+    static bool is_checkpoint_conflict(const checkpoints& checkpoints,
+        size_t height, const hash_digest& hash) NOEXCEPT;
+
     static uint32_t work_required_retarget(const data& values, uint32_t forks,
         uint32_t proof_of_work_limit, uint32_t minimum_timespan,
         uint32_t maximum_timespan, uint32_t retargeting_interval_seconds) NOEXCEPT;
@@ -50,6 +50,13 @@ public:
     /// Uses non-minimal exponent encoding to avoid mantissa sign (bug).
     static constexpr small_type compress(const span_type& number) NOEXCEPT;
 
+    /// Fixed-width (limb) forms of expand and compress, with identical
+    /// results, for work and difficulty computation without uintx.
+    static constexpr fixed_uint256 expand_fixed(
+        small_type exponential) NOEXCEPT;
+    static constexpr small_type compress_fixed(
+        const fixed_uint256& number) NOEXCEPT;
+
 protected:
     using exponent_type = unsigned_type<e_bytes>;
 
@@ -62,6 +69,9 @@ protected:
 
     static constexpr parse to_compact(small_type small) NOEXCEPT;
     static constexpr small_type from_compact(const parse& compact) NOEXCEPT;
+    static constexpr small_type normalize_expand(
+        small_type exponential) NOEXCEPT;
+    static constexpr small_type normalize_compress(small_type small) NOEXCEPT;
 };
 
 } // namespace chain
@@ -29,6 +29,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -78,6 +79,8 @@ public:
     header(std::istream& stream) NOEXCEPT;
     header(reader&& source) NOEXCEPT;
     header(reader& source) NOEXCEPT;
+    header(slice_reader&& source) NOEXCEPT;
+    header(slice_reader& source) NOEXCEPT;
 
     // Operators.
     // ------------------------------------------------------------------------
@@ -105,17 +108,44 @@ public:
     uint32_t nonce() const NOEXCEPT;
 
     /// Computed properties.
+    /// The identity hash is computed from the midstate on first call and
+    /// cached (not thread safe), the cache is shared by copies.
     hash_digest hash() const NOEXCEPT;
     uint256_t difficulty() const NOEXCEPT;
 
+    /// Fixed-width difficulty, for cumulative chain work accumulation.
+    fixed_uint256 work() const NOEXCEPT;
+    static fixed_uint256 work(uint32_t bits) NOEXCEPT;
+
+    /// Cached identity hash, computed and cached if not yet cached.
+    const hash_digest& get_hash() const NOEXCEPT;
+
+    /// Midstate hashing.
+    /// The midstate is the sha256 state of the first serialized 64 bytes,
+    /// which excludes timestamp and nonce. Hashes with the given timestamp
+    /// and nonce, or with out.size() consecutive nonces (vectorized).
+    sha256::state_t midstate() const NOEXCEPT;
+    hash_digest hash(const sha256::state_t& midstate, uint32_t timestamp,
+        uint32_t nonce) const NOEXCEPT;
+    void hash(hashes& out, const sha256::state_t& midstate,
+        uint32_t timestamp, uint32_t nonce) const NOEXCEPT;
+
     // Validation.
     // ------------------------------------------------------------------------
 
     code check(uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
         bool scrypt=false) const NOEXCEPT;
 
+    /// Check against a precomputed identity hash (the cache is not written).
+    code check(const hash_digest& hash, uint32_t timestamp_limit_seconds,
+        uint32_t proof_of_work_limit, bool scrypt=false) const NOEXCEPT;
+
     code accept(const chain_state& state) const NOEXCEPT;
 
+    /// Accept against precomputed contextual values (bulk validation).
+    code accept(bool checkpoint_conflict, uint32_t minimum_block_version,
+        uint32_t median_time_past, uint32_t work_required) const NOEXCEPT;
+
 protected:
     header(uint32_t version, hash_digest&& previous_block_hash,
         hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
@@ -129,6 +159,8 @@ protected:
 
     bool is_invalid_proof_of_work(uint32_t proof_of_work_limit,
         bool scrypt=false) const NOEXCEPT;
+    bool is_invalid_proof_of_work(const hash_digest& hash,
+        uint32_t proof_of_work_limit, bool scrypt=false) const NOEXCEPT;
     bool is_invalid_timestamp(uint32_t timestamp_limit_seconds) const NOEXCEPT;
 
     // Accept (relative to chain_state).
@@ -140,8 +172,11 @@ protected:
     // error::incorrect_proof_of_work
 
 private:
-    static header from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static header from_data(Source& source) NOEXCEPT;
     static uint256_t difficulty(uint32_t bits) NOEXCEPT;
+    sha256::quarter_t quarter(uint32_t timestamp,
+        uint32_t nonce) const NOEXCEPT;
 
     // Header should be stored as shared (adds 16 bytes).
     // copy: 4 * 32 + 2 * 256 + 1 = 81 bytes (vs. 16 when shared).
@@ -152,6 +187,9 @@ private:
     uint32_t bits_;
     uint32_t nonce_;
     bool valid_;
+
+    // Identity hash caching.
+    mutable std::shared_ptr<const hash_digest> hash_{};
 };
 
 typedef std::vector<header> headers;
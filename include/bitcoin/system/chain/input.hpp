@@ -72,6 +72,8 @@ public:
     input(std::istream& stream) NOEXCEPT;
     input(reader&& source) NOEXCEPT;
     input(reader& source) NOEXCEPT;
+    input(slice_reader&& source) NOEXCEPT;
+    input(slice_reader& source) NOEXCEPT;
 
     // Operators.
     // ------------------------------------------------------------------------
@@ -120,7 +122,8 @@ protected:
         const chain::prevout::cptr& prevout) NOEXCEPT;
 
 private:
-    static input from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static input from_data(Source& source) NOEXCEPT;
     bool embedded_script(chain::script& out) const NOEXCEPT;
 
     // Input should be stored as shared (adds 16 bytes).
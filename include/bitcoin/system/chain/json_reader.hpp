@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_JSON_READER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_JSON_READER_HPP
+
+#include <functional>
+#include <string>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Streaming (single pass) json parser for chain objects, the inverse of
+/// json_writer and of the boost::json convertors. Chain objects are built
+/// directly from the source, without an intermediate json value tree.
+/// Members may appear in any order, unknown members are skipped and all known
+/// members are required. Parse failure invalidates the source and returns a
+/// default (invalid) object. The source may be any byte reader, such as
+/// read::bytes::istream or read::bytes::copy. Not thread safe.
+class BC_API json_reader
+{
+public:
+    /// Handlers return false to stop parsing.
+    typedef std::function<bool(const header::cptr&)> header_handler;
+    typedef std::function<bool(const transaction::cptr&)> transaction_handler;
+
+    DELETE5(json_reader);
+
+    /// The source must remain in scope for the lifetime of the reader.
+    json_reader(reader& source) NOEXCEPT;
+
+    /// Parse the object from the source.
+    block read_block() NOEXCEPT;
+    header read_header() NOEXCEPT;
+    transaction read_transaction() NOEXCEPT;
+    input read_input() NOEXCEPT;
+    output read_output() NOEXCEPT;
+    point read_point() NOEXCEPT;
+    script read_script() NOEXCEPT;
+    witness read_witness() NOEXCEPT;
+
+    /// Parse a block as a sequence of events, the header and then each
+    /// transaction as it is parsed. Transactions are not retained, so memory
+    /// is bounded by the largest transaction. The header must precede the
+    /// transactions. False if invalid or stopped by a handler.
+    bool read_block(const header_handler& on_header,
+        const transaction_handler& on_transaction) NOEXCEPT;
+
+    /// The source is valid.
+    operator bool() const NOEXCEPT;
+    bool operator!() const NOEXCEPT;
+
+protected:
+    typedef std::function<bool(const std::string& name)> member_handler;
+    typedef std::function<bool()> element_handler;
+
+    /// Structure, handlers must consume the member/element value.
+    bool read_object(const member_handler& on_member) NOEXCEPT;
+    bool read_array(const element_handler& on_element) NOEXCEPT;
+
+    /// Values.
+    bool read_string(std::string& out) NOEXCEPT;
+    bool read_number(uint64_t& out) NOEXCEPT;
+    bool read_number(uint32_t& out) NOEXCEPT;
+    bool read_hash(hash_digest& out) NOEXCEPT;
+    bool skip_value() NOEXCEPT;
+
+    /// Lexing.
+    bool read_literal(char expected) NOEXCEPT;
+    uint8_t peek_token() NOEXCEPT;
+    bool fail() NOEXCEPT;
+
+private:
+    bool read_escape(std::string& out) NOEXCEPT;
+    bool read_code_point(uint32_t& out) NOEXCEPT;
+    bool skip_container() NOEXCEPT;
+    void skip_space() NOEXCEPT;
+
+    reader& source_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_JSON_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_JSON_WRITER_HPP
+
+#include <string>
+#include <string_view>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Streaming (single pass) json serializer for chain objects.
+/// Output is identical to boost::json::serialize(boost::json::value_from(x))
+/// but no json value tree is constructed. The sink may be any byte writer,
+/// such as write::bytes::ostream or write::bytes::text. Not thread safe.
+class BC_API json_writer
+{
+public:
+    DELETE5(json_writer);
+
+    /// The sink must remain in scope for the lifetime of the writer.
+    json_writer(writer& sink) NOEXCEPT;
+
+    /// Serialize the object to the sink.
+    void write(const block& block) NOEXCEPT;
+    void write(const header& header) NOEXCEPT;
+    void write(const transaction& tx) NOEXCEPT;
+    void write(const input& input) NOEXCEPT;
+    void write(const output& output) NOEXCEPT;
+    void write(const point& point) NOEXCEPT;
+    void write(const script& script) NOEXCEPT;
+    void write(const witness& witness) NOEXCEPT;
+
+    /// Flush the sink.
+    void flush() NOEXCEPT;
+
+    /// The sink is valid.
+    operator bool() const NOEXCEPT;
+    bool operator!() const NOEXCEPT;
+
+protected:
+    void write_text(const std::string_view& text) NOEXCEPT;
+    void write_number(uint64_t value) NOEXCEPT;
+    void write_hash(const hash_digest& hash) NOEXCEPT;
+    void write_string(const std::string& text) NOEXCEPT;
+
+private:
+    writer& sink_;
+};
+
+/// Serialize the object to a json string (json_writer over a text sink).
+BC_API std::string to_json(const block& block) NOEXCEPT;
+BC_API std::string to_json(const header& header) NOEXCEPT;
+BC_API std::string to_json(const transaction& tx) NOEXCEPT;
+BC_API std::string to_json(const input& input) NOEXCEPT;
+BC_API std::string to_json(const output& output) NOEXCEPT;
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -377,6 +377,8 @@ public:
     operation(std::istream& stream) NOEXCEPT;
     operation(reader&& source) NOEXCEPT;
     operation(reader& source) NOEXCEPT;
+    operation(slice_reader&& source) NOEXCEPT;
+    operation(slice_reader& source) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     // TODO: a byte-deserialized operation cannot be invalid unless empty.
@@ -443,7 +445,11 @@ private:
     // So script may call count_op.
     friend class script;
 
-    static operation from_data(reader& source) NOEXCEPT;
+    // So snapshot may construct underflow operations.
+    friend class snapshot;
+
+    template <typename Source>
+    static operation from_data(Source& source) NOEXCEPT;
     static operation from_push_data(const chunk_cptr& data,
         bool minimal) NOEXCEPT;
 
@@ -453,7 +459,9 @@ private:
     static chunk_cptr no_data_ptr() NOEXCEPT;
     static chunk_cptr any_data_ptr() NOEXCEPT;
     static bool count_op(reader& source) NOEXCEPT;
+    static bool count_op(slice_reader& source) NOEXCEPT;
     static uint32_t read_data_size(opcode code, reader& source) NOEXCEPT;
+    static uint32_t read_data_size(opcode code, slice_reader& source) NOEXCEPT;
 
     static inline opcode opcode_from_data(const data_chunk& push_data,
         bool minimal) NOEXCEPT
@@ -63,6 +63,8 @@ public:
     output(std::istream& stream) NOEXCEPT;
     output(reader&& source) NOEXCEPT;
     output(reader& source) NOEXCEPT;
+    output(slice_reader&& source) NOEXCEPT;
+    output(slice_reader& source) NOEXCEPT;
 
     // Operators.
     // ------------------------------------------------------------------------
@@ -101,7 +103,8 @@ protected:
         bool valid) NOEXCEPT;
 
 private:
-    static output from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static output from_data(Source& source) NOEXCEPT;
 
     // Output should be stored as shared (adds 16 bytes).
     // copy: 3 * 64 + 1 = 25 bytes (vs. 16 when shared).
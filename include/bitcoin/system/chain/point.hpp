@@ -66,6 +66,8 @@ public:
     point(std::istream& stream) NOEXCEPT;
     point(reader&& source) NOEXCEPT;
     point(reader& source) NOEXCEPT;
+    point(slice_reader&& source) NOEXCEPT;
+    point(slice_reader& source) NOEXCEPT;
 
     // Operators.
     // ------------------------------------------------------------------------
@@ -96,7 +98,8 @@ protected:
     point(const hash_digest& hash, uint32_t index, bool valid) NOEXCEPT;
 
 private:
-    static point from_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    static point from_data(Source& source) NOEXCEPT;
 
     // The index is consensus-serialized as a fixed 4 bytes, however it is
     // effectively bound to 2^17 by the block byte size limit.
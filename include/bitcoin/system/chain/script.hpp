@@ -449,6 +449,8 @@ public:
     script(std::istream& stream, bool prefix) NOEXCEPT;
     script(reader&& source, bool prefix) NOEXCEPT;
     script(reader& source, bool prefix) NOEXCEPT;
+    script(slice_reader&& source, bool prefix) NOEXCEPT;
+    script(slice_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     script(const std::string& mnemonic) NOEXCEPT;
@@ -505,14 +507,21 @@ public:
     bool is_unspendable() const NOEXCEPT;
 
 protected:
+    // So that split operations may be restored from a snapshot.
+    friend class snapshot;
+
     script(operations&& ops, bool valid, bool fails) NOEXCEPT;
     script(const operations& ops, bool valid, bool fails) NOEXCEPT;
 
 private:
     // TODO: move to config serialization wrapper.
     static script from_string(const std::string& mnemonic) NOEXCEPT;
-    static script from_data(reader& source, bool prefix) NOEXCEPT;
-    static size_t op_count(reader& source) NOEXCEPT;
+    template <typename Source>
+    static script from_data(Source& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    static size_t op_count(Source& source) NOEXCEPT;
+    static size_t operations_size(const operations::const_iterator& begin,
+        const operations::const_iterator& end) NOEXCEPT;
 
     // Script should be stored as shared.
     operations ops_;
@@ -522,6 +531,9 @@ private:
     bool prefail_;
     ////bool roller_{ false };
 
+    // Serialized size of ops_ (unprefixed), cached on construction.
+    size_t size_;
+
 public:
     using iterator = operations::const_iterator;
 
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_SNAPSHOT_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_SNAPSHOT_HPP
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Read-only memory-mapped file of pre-parsed (validated) transactions and
+/// blocks. Records carry the cached identity hashes, serialized sizes,
+/// segregated state and signature operation count of each transaction, and
+/// scripts are stored split into operations. So loading neither hashes nor
+/// parses scripts, and objects are read directly from the mapped pages (no
+/// copy to a read buffer). The file is split into records on open.
+///
+/// File: magic (4 bytes), version (4 bytes), records.
+/// Record: kind (1 byte), body size (4 bytes), sigops (4 bytes), body.
+/// Integers are little-endian. The format is not a wire format and it is not
+/// validated beyond its structure, so it must only be used for files written
+/// by this node.
+class BC_API snapshot
+{
+public:
+    enum class kind : uint8_t
+    {
+        transaction = 1,
+        block = 2
+    };
+
+    /// Location of an object within the file.
+    struct record
+    {
+        snapshot::kind kind;
+        size_t sigops;
+        size_t offset;
+        size_t size;
+    };
+
+    typedef std::vector<record> records;
+
+    /// Handle a loaded object, with its sigops and record index.
+    /// Return false to stop the scan.
+    typedef std::function<bool(const transaction::cptr&, size_t, size_t)>
+        transaction_handler;
+    typedef std::function<bool(const block::cptr&, size_t, size_t)>
+        block_handler;
+
+    /// File prefix: "bcsn" magic and format version.
+    static constexpr uint32_t magic = 0x6e736362;
+    static constexpr uint32_t version = 1;
+    static constexpr size_t prefix_size = sizeof(uint32_t) + sizeof(uint32_t);
+
+    /// Record prefix: kind, body size and sigops.
+    static constexpr size_t record_size = sizeof(uint8_t) + sizeof(uint32_t) +
+        sizeof(uint32_t);
+
+    /// Write the file prefix, then any number of records.
+    static void write_prefix(writer& sink) NOEXCEPT;
+
+    /// Write the record of a transaction or block, with the signature
+    /// operation count of its validation (transaction or block total).
+    static void write(writer& sink, const transaction& tx,
+        size_t sigops) NOEXCEPT;
+    static void write(writer& sink, const block& block,
+        size_t sigops) NOEXCEPT;
+
+    /// Defaults.
+    snapshot(snapshot&&) = default;
+    snapshot(const snapshot&) = default;
+    snapshot& operator=(snapshot&&) = default;
+    snapshot& operator=(const snapshot&) = default;
+    ~snapshot() = default;
+
+    /// Map the file and split it into records.
+    snapshot(const std::filesystem::path& path) NOEXCEPT;
+
+    /// The file is mapped, has the expected prefix and all bytes are whole
+    /// records. An empty file is valid (no records). Records preceding a
+    /// failure remain available.
+    bool is_valid() const NOEXCEPT;
+
+    /// Total mapped bytes.
+    size_t size() const NOEXCEPT;
+
+    /// Record locations, in file order.
+    const records& index() const NOEXCEPT;
+
+    /// Load the object of the record at the given index (nullptr if out of
+    /// range, of the other kind, or malformed).
+    transaction::cptr get_transaction(size_t index) const NOEXCEPT;
+    block::cptr get_block(size_t index) const NOEXCEPT;
+
+    /// Load all objects in batches of at most 'batch' records, each batch in
+    /// parallel, and pass them to the handler of their kind in file order.
+    /// False if a record is malformed (no handler is invoked for it or any
+    /// later record) or if a handler stopped the scan.
+    bool scan(const block_handler& on_block,
+        const transaction_handler& on_transaction,
+        size_t batch) const NOEXCEPT;
+
+private:
+    static void write_record(writer& sink, kind type, size_t sigops,
+        const data_chunk& body) NOEXCEPT;
+    static void write_transaction(writer& sink,
+        const transaction& tx) NOEXCEPT;
+    static void write_script(writer& sink, const script& script) NOEXCEPT;
+    static void write_witness(writer& sink, const witness& witness) NOEXCEPT;
+    static transaction::cptr read_transaction(slice_reader& source) NOEXCEPT;
+    static script::cptr read_script(slice_reader& source) NOEXCEPT;
+    static witness::cptr read_witness(slice_reader& source) NOEXCEPT;
+
+    data_slice at(size_t index) const NOEXCEPT;
+    bool split() NOEXCEPT;
+
+    // These are thread safe (const after construction).
+    std::shared_ptr<boost::iostreams::mapped_file_source> file_;
+    records index_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -64,6 +64,12 @@ public:
     transaction(std::istream& stream, bool witness) NOEXCEPT;
     transaction(reader&& source, bool witness) NOEXCEPT;
     transaction(reader& source, bool witness) NOEXCEPT;
+    transaction(slice_reader&& source, bool witness) NOEXCEPT;
+    transaction(slice_reader& source, bool witness) NOEXCEPT;
+
+    /// Computes txid and wtxid from the bytes read (no reserialization).
+    transaction(hash::sha256x2::istream&& source, bool witness) NOEXCEPT;
+    transaction(hash::sha256x2::istream& source, bool witness) NOEXCEPT;
 
     // Operators.
     // ------------------------------------------------------------------------
@@ -140,9 +146,15 @@ public:
     code connect(const context& state) const NOEXCEPT;
 
 protected:
+    // So that cached metadata may be restored from a snapshot.
+    friend class snapshot;
+
     transaction(uint32_t version, const chain::inputs_cptr& inputs,
         const chain::outputs_cptr& outputs, uint32_t locktime, bool segregated,
         bool valid) NOEXCEPT;
+    transaction(uint32_t version, const chain::inputs_cptr& inputs,
+        const chain::outputs_cptr& outputs, uint32_t locktime, bool segregated,
+        bool valid, size_t nominal_size, size_t witness_size) NOEXCEPT;
 
     // Guard (context free).
     // ------------------------------------------------------------------------
@@ -186,9 +198,12 @@ protected:
 
 
 private:
-    static transaction from_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    static transaction from_data(Source& source, bool witness) NOEXCEPT;
     static bool segregated(const chain::inputs& inputs) NOEXCEPT;
     static bool segregated(const chain::input_cptrs& inputs) NOEXCEPT;
+    static size_t serialized_size(const chain::input_cptrs& inputs,
+        const chain::output_cptrs& outputs, bool witness) NOEXCEPT;
     ////static size_t maximum_size(bool coinbase) NOEXCEPT;
 
     // signature hash
@@ -218,6 +233,14 @@ private:
     bool segregated_;
     bool valid_;
 
+    // Serialized sizes, cached on construction.
+    size_t nominal_size_;
+    size_t witness_size_;
+
+    // Identity hashes computed during deserialization (shared on copy).
+    std::shared_ptr<const hash_digest> nominal_hash_{};
+    std::shared_ptr<const hash_digest> witness_hash_{};
+
 private:
     typedef struct
     {
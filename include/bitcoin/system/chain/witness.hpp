@@ -67,6 +67,8 @@ public:
     witness(std::istream& stream, bool prefix) NOEXCEPT;
     witness(reader&& source, bool prefix) NOEXCEPT;
     witness(reader& source, bool prefix) NOEXCEPT;
+    witness(slice_reader&& source, bool prefix) NOEXCEPT;
+    witness(slice_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     witness(const std::string& mnemonic) NOEXCEPT;
@@ -126,7 +128,8 @@ public:
 private:
     // TODO: move to config serialization wrapper.
     static witness from_string(const std::string& mnemonic) NOEXCEPT;
-    static witness from_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    static witness from_data(Source& source, bool prefix) NOEXCEPT;
     size_t serialized_size() const NOEXCEPT;
 
     witness(chunk_cptrs&& stack, bool valid) NOEXCEPT;
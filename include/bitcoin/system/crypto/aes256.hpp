@@ -36,10 +36,23 @@ typedef data_array<block_size> block;
 constexpr size_t secret_size = bytes<256>;
 typedef data_array<secret_size> secret;
 
+/// The key schedule of a secret (key is working space of each block).
+struct context
+{
+    secret key;
+    secret enckey;
+    secret deckey;
+};
+
 /// Perform aes256 encryption/decryption on a data block.
 void encrypt(block& bytes, const secret& key) NOEXCEPT;
 void decrypt(block& bytes, const secret& key) NOEXCEPT;
 
+/// Expand the key schedule once for any number of blocks of the same secret.
+void initialize(context& context, const secret& key) NOEXCEPT;
+void encrypt(block& bytes, context& context) NOEXCEPT;
+void decrypt(block& bytes, context& context) NOEXCEPT;
+
 } // namespace aes256
 } // namespace system
 } // namespace libbitcoin
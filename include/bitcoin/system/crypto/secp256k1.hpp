@@ -118,6 +118,45 @@ BC_API bool ec_multiply(ec_uncompressed& point,
 /// Compute the product a = (a * b) % n.
 BC_API bool ec_multiply(ec_secret& left, const ec_secret& right) NOEXCEPT;
 
+/// A fixed point with a precomputed table of its 4 bit window multiples
+/// (64 windows x 15 multiples), for repeated multiplication of the same
+/// point by varying public scalars (such as tweaks). Multiplication is a
+/// variable time sum of the table entries selected by the scalar, much as
+/// with ec_sum, so its timing and memory access reveal the scalar. It must
+/// never be given a secret scalar, use ec_multiply for secrets. Multiply with
+/// the multiply_vartime member or ec_multiply_vartime(out, point, scalar).
+class BC_API ec_prepared_point
+{
+public:
+    static constexpr size_t window_bits = 4;
+    static constexpr size_t windows = to_bits(ec_secret_size) / window_bits;
+    static constexpr size_t multiples = sub1(power2(window_bits));
+
+    /// Invalid if the point does not parse.
+    ec_prepared_point(const ec_compressed& point) NOEXCEPT;
+
+    operator bool() const NOEXCEPT;
+    const ec_compressed& point() const NOEXCEPT;
+
+    /// Compute the product out = point * scalar, in variable time.
+    /// The scalar must be public (never a secret key or nonce).
+    bool multiply_vartime(ec_compressed& out,
+        const ec_secret& scalar) const NOEXCEPT;
+
+private:
+    static data_chunk prepare(const ec_compressed& point) NOEXCEPT;
+
+    // Parsed (library internal) points, empty if invalid.
+    const ec_compressed point_;
+    const data_chunk table_;
+};
+
+/// Compute the product out = point * scalar, using the prepared point table.
+/// This is variable time, so the scalar must be public (never a secret key or
+/// nonce). Use ec_multiply (constant time) for secret scalars.
+BC_API bool ec_multiply_vartime(ec_compressed& out,
+    const ec_prepared_point& point, const ec_secret& scalar) NOEXCEPT;
+
 // Negate EC values
 // ----------------------------------------------------------------------------
 
@@ -149,6 +188,27 @@ BC_API bool secret_to_public(ec_compressed& out,
 BC_API bool secret_to_public(ec_uncompressed& out,
     const ec_secret& secret) NOEXCEPT;
 
+// Batch EC values
+// ----------------------------------------------------------------------------
+// Elements are independent and computed in parallel, with any shared point
+// parsed once. Output order matches input. False if any element fails.
+
+/// Compute the sums out[i] = point + G * scalars[i].
+BC_API bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT;
+
+/// Compute the sums points[i] += G * scalars[i].
+BC_API bool ec_add(compressed_list& points,
+    const secret_list& scalars) NOEXCEPT;
+
+/// Compute the products points[i] *= scalar.
+BC_API bool ec_multiply(compressed_list& points,
+    const ec_secret& scalar) NOEXCEPT;
+
+/// Convert secrets to compressed points.
+BC_API bool secret_to_public(compressed_list& out,
+    const secret_list& secrets) NOEXCEPT;
+
 // Verify keys
 // ----------------------------------------------------------------------------
 
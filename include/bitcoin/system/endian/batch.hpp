@@ -70,6 +70,34 @@ template <typename Integral, size_t Count>
 constexpr void from_little_endians(std_array<Integral, Count>& out,
     const std_array<Integral, Count>& in) NOEXCEPT;
 
+/// Span endian conversion (vectorized when available, out may equal in).
+/// ---------------------------------------------------------------------------
+
+/// Byte swap each of count integrals from in to out.
+BC_API void byteswaps(uint16_t* out, const uint16_t* in, size_t count) NOEXCEPT;
+BC_API void byteswaps(uint32_t* out, const uint32_t* in, size_t count) NOEXCEPT;
+BC_API void byteswaps(uint64_t* out, const uint64_t* in, size_t count) NOEXCEPT;
+
+/// Copy a span of native integral integers to big-endian.
+template <typename Integral, if_integral_integer<Integral> = true>
+inline void to_big_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT;
+
+/// Copy a span of native integral integers to little-endian.
+template <typename Integral, if_integral_integer<Integral> = true>
+inline void to_little_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT;
+
+/// Copy a span of big-endian integral integers to native.
+template <typename Integral, if_integral_integer<Integral> = true>
+inline void from_big_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT;
+
+/// Copy a span of little-endian integral integers to native.
+template <typename Integral, if_integral_integer<Integral> = true>
+inline void from_little_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
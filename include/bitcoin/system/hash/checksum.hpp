@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_CHECKSUM_HPP
 #define LIBBITCOIN_SYSTEM_HASH_CHECKSUM_HPP
 
+#include <array>
+#include <string>
+#include <string_view>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/radix/radix.hpp>
@@ -87,6 +90,42 @@ BC_API bool bech32_verify_checked(uint8_t& out_version,
     data_chunk& out_program, const std::string& prefix,
     const base32_chunk& checked) NOEXCEPT;
 
+// bech32 fixed buffer, used by witness_address batch conversion.
+// ----------------------------------------------------------------------------
+
+/// These utilities encode and decode a complete bech32/bech32m string (prefix,
+/// separator, version, program and checksum) in one pass, without allocation.
+/// The polymod is computed from a table of the generator xor (by coefficient)
+/// as the characters are written or read. Program and prefix validity (other
+/// than prefix match and program size) is not checked here.
+
+namespace detail {
+
+/// BIP173 maximum length of a bech32 string.
+constexpr size_t bech32_maximum_length = 90;
+
+/// BIP141 maximum size of a witness program.
+constexpr size_t bech32_program_maximum_size = 40;
+
+} // namespace detail
+
+typedef std::array<char, detail::bech32_maximum_length> bech32_text;
+typedef data_array<detail::bech32_program_maximum_size> bech32_program;
+
+/// Write prefix (lowered from either case), separator, version, program and
+/// checksum to out.
+/// Returns the number of characters written, zero if version is not 5 bits or
+/// the string would exceed the size of bech32_text.
+BC_API size_t bech32_encode(bech32_text& out, const std::string_view& prefix,
+    uint8_t version, const data_slice& program) NOEXCEPT;
+
+/// Read version and program from text with the prefix (in either case).
+/// False if mixed case, prefix or separator mismatch, invalid character, more
+/// than four (or non-zero) padding bits, program overflow or invalid checksum.
+BC_API bool bech32_decode(uint8_t& out_version, bech32_program& out_program,
+    size_t& out_size, const std::string_view& prefix,
+    const std::string_view& text) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -127,6 +127,15 @@ INLINE hash_digest merkle_root(hashes&& set) NOEXCEPT;
 /// Litecoin scrypt hash [chain].
 INLINE hash_digest scrypt_hash(const data_slice& data) NOEXCEPT;
 
+/// Hash list byte order reversal (display and rpc encoding).
+/// ---------------------------------------------------------------------------
+
+/// Reverse the byte order of each hash in place (vectorized when available).
+BC_API void reverse_hashes(hashes& values) NOEXCEPT;
+
+/// Copy of values with the byte order of each hash reversed.
+BC_API hashes reverse_hashes_copy(const hashes& values) NOEXCEPT;
+
 /// Hash table keying.
 /// ---------------------------------------------------------------------------
 
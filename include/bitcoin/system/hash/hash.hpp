@@ -26,6 +26,7 @@
 #include <bitcoin/system/hash/checksum.hpp>
 #include <bitcoin/system/hash/functions.hpp>
 #include <bitcoin/system/hash/hmac.hpp>
+#include <bitcoin/system/hash/merkle_tree.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
 #include <bitcoin/system/hash/scrypt.hpp>
 #include <bitcoin/system/hash/siphash.hpp>
@@ -34,11 +34,25 @@ class hmac
 {
 public:
     DEFAULT5(hmac);
+    using state_t = typename Algorithm::state_t;
     using digest_t = typename Algorithm::digest_t;
 
+    /// Key midstates, the algorithm states after the inner and outer pads.
+    struct midstate_t
+    {
+        state_t inner;
+        state_t outer;
+    };
+
+    /// Precompute key midstates, for reuse across messages with same key.
+    static inline midstate_t midstate(const data_slice& key) NOEXCEPT;
+
     /// hmac accumulator, not resettable.
     inline hmac(const data_slice& key) NOEXCEPT;
 
+    /// hmac accumulator from key midstates (skips both pad compressions).
+    inline hmac(const midstate_t& midstate) NOEXCEPT;
+
     inline void write(const data_slice& data) NOEXCEPT;
     inline digest_t flush() NOEXCEPT;
 
@@ -46,6 +60,10 @@ public:
     static inline digest_t code(const data_slice& data,
         const data_slice& key) NOEXCEPT;
 
+    /// finalized authentication code from key midstates.
+    static inline digest_t code(const data_slice& data,
+        const midstate_t& midstate) NOEXCEPT;
+
 protected:
     using byte_t = typename Algorithm::byte_t;
     using block_t = typename Algorithm::block_t;
@@ -55,7 +73,8 @@ protected:
     static constexpr block_t& xor_n(block_t& pad, const byte_t* from,
         size_t size) NOEXCEPT;
 
-    inline void xor_key(const byte_t* key, size_t size) NOEXCEPT;
+    static inline void xor_key(block_t& ipad, block_t& opad,
+        const data_slice& key) NOEXCEPT;
 
 private:
     accumulator<Algorithm> inner_{};
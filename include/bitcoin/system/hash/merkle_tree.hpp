@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_MERKLE_TREE_HPP
+#define LIBBITCOIN_SYSTEM_HASH_MERKLE_TREE_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Merkle tree retaining all levels (leaves first) in one contiguous buffer.
+/// Each level has spare capacity, so appends are amortized O(log n).
+/// Odd levels pair their last digest with itself, as with merkle_root.
+/// Algorithm can be any merkle hash function exposing:
+///     digest_t, digests_t, merkle_hash(digests_t&), double_hash(left, right).
+template <typename Algorithm>
+class merkle_tree
+{
+public:
+    DEFAULT5(merkle_tree);
+    using digest_t = typename Algorithm::digest_t;
+    using digests_t = typename Algorithm::digests_t;
+
+    /// A branch is the sibling of each node from leaf up to (not incl) root.
+    using branch_t = digests_t;
+    using branches_t = std_vector<branch_t>;
+    using indexes_t = std_vector<size_t>;
+
+    /// Levels are hashed with merkle_hash (vectorized where available).
+    inline merkle_tree(const digests_t& leaves) NOEXCEPT;
+    inline merkle_tree(digests_t&& leaves) NOEXCEPT;
+
+    /// Number of leaves.
+    inline size_t size() const NOEXCEPT;
+
+    /// Number of levels, including leaves and root (zero if empty).
+    inline size_t depth() const NOEXCEPT;
+
+    /// Tree root, null hash if empty.
+    inline digest_t root() const NOEXCEPT;
+
+    /// Leaf at index (index must be less than size()).
+    inline const digest_t& leaf(size_t index) const NOEXCEPT;
+
+    /// Branch of leaf at index, empty if index is out of range.
+    inline branch_t branch(size_t index) const NOEXCEPT;
+
+    /// Branches of leaves at indexes, populated in one pass over the levels.
+    /// Branches of out of range indexes are empty.
+    inline branches_t branches(const indexes_t& indexes) const NOEXCEPT;
+
+    /// Replace leaf at index, rehashing only its path, false if out of range.
+    inline bool update(size_t index, const digest_t& leaf) NOEXCEPT;
+
+    /// Append leaf, rehashing only the right edge of each level. Leaf capacity
+    /// doubles when exhausted (relocating all levels), as with std::vector.
+    inline void append(const digest_t& leaf) NOEXCEPT;
+
+    /// Root of a tree from leaf, its branch and index (proof verification).
+    static inline digest_t root(const digest_t& leaf, const branch_t& branch,
+        size_t index) NOEXCEPT;
+
+protected:
+    static inline size_t parent_size(size_t size) NOEXCEPT;
+    inline size_t level_size(size_t row) const NOEXCEPT;
+    inline size_t capacity(size_t row) const NOEXCEPT;
+    inline const digest_t* level(size_t row) const NOEXCEPT;
+    inline digest_t* level(size_t row) NOEXCEPT;
+    inline digest_t& node(size_t row, size_t index) NOEXCEPT;
+    inline const digest_t& sibling(size_t row, size_t index) const NOEXCEPT;
+    inline void rehash(size_t row, size_t index) NOEXCEPT;
+    inline void reserve(size_t leaves) NOEXCEPT;
+    inline void build() NOEXCEPT;
+
+private:
+    // Concatenated levels (leaves first), with the offset of each level (and
+    // end of the last), bounding level capacities, and the size of each level.
+    digests_t buffer_{};
+    std_vector<size_t> offsets_{};
+    std_vector<size_t> sizes_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/hash/merkle_tree.ipp>
+
+#endif
@@ -24,6 +24,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
 #include <bitcoin/system/hash/algorithms.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -42,12 +43,23 @@ constexpr auto is_scrypt_args =
     !is_multiply_overflow(R, 128_size);
 
 /// Concurrent increases memory consumption from minimum to maximum.
+/// Vectorized mixes rblocks in SIMD lanes (when available), each lane
+/// requiring its own romix working set (up to maximum_memory).
 template<size_t W, size_t R, size_t P, bool Concurrent = false,
-    bool_if<is_scrypt_args<W, R, P>> If = true>
+    bool Vectorized = false, bool_if<is_scrypt_args<W, R, P>> If = true>
 class scrypt
 {
 public:
     static constexpr auto block_size = 64_size;
+    static constexpr auto have_x128 = Vectorized && system::with_sse41;
+    static constexpr auto have_x256 = Vectorized && system::with_avx2;
+    static constexpr auto have_x512 = Vectorized && system::with_avx512;
+
+    /// Peak variable memory consumption of one romix (per rblock/lane).
+    static constexpr auto romix_memory = 1_u64 *
+        (1 * (3 * (1 * 1 * block_size))) + // (denormalizing optimization)
+        (1 * (1 * (2 * R * block_size))) - (1 * (add1(R) * block_size)) +
+        (1 * (W * (2 * R * block_size)));
 
     /// Peak variable memory consumption for non-concurrent execution.
     static constexpr auto minimum_memory = 1_u64 *
@@ -75,6 +87,17 @@ public:
     static data_array<Size> hash(const data_slice& password,
         const data_slice& salt) NOEXCEPT;
 
+    /// Hash each password with its corresponding salt (multi-buffer).
+    /// The rblocks of all hashes are mixed across lanes and threads, with
+    /// concurrent romix consumption bounded by memory (but at least one).
+    /// Unvectorized romix working sets are allocated once and reused.
+    /// Return by reference, false if out of memory or sizes do not match.
+    template<size_t Size, if_not_greater<Size,
+        scrypt_derivation::maximum_size> = true>
+    static bool hash(std_vector<data_array<Size>>& out,
+        const data_stack& passwords, const data_stack& salts,
+        uint64_t memory=maximum_memory) NOEXCEPT;
+
 protected:
     using word_t    = uint32_t;
     using words_t   = std_array<word_t,   block_size / sizeof(word_t)>;
@@ -94,6 +117,52 @@ protected:
     static inline block_t& salsa_8(block_t& block) NOEXCEPT;
     static inline bool block_mix(rblock_t& rblock) NOEXCEPT;
     static inline bool romix(rblock_t& rblock) NOEXCEPT;
+    static inline bool romix(rblock_t& rblock, wrblock_t& wrblocks) NOEXCEPT;
+    static inline bool romix(rblock_t* rblocks, size_t count,
+        uint64_t memory) NOEXCEPT;
+
+    /// Vectorization (X words of each lane are interleaved, V is by lane).
+    template <typename xWord>
+    using xblock_t   = std_array<xWord, block_size / sizeof(word_t)>;
+    template <typename xWord>
+    using xrblock_t  = std_array<xblock_t<xWord>,  R * 2_size>;
+    template <typename xWord>
+    using xwrblock_t = std_array<wrblock_t, capacity<xWord, word_t>>;
+    template <typename xWord>
+    using xyblock_t  = std_array<xblock_t<xWord>,  sub1(R)>;
+
+    template <typename xWord>
+    INLINE static word_t& lane(xWord& xword, size_t lane) NOEXCEPT;
+    template <typename xWord>
+    INLINE static word_t lane(const xWord& xword, size_t lane) NOEXCEPT;
+    template <typename xWord>
+    INLINE static xblock_t<xWord>& xor_(xblock_t<xWord>& to,
+        const xblock_t<xWord>& from) NOEXCEPT;
+    template <typename xWord>
+    INLINE static void xor_(xrblock_t<xWord>& to, const rblock_t& from,
+        size_t lane) NOEXCEPT;
+    template <typename xWord>
+    INLINE static void store(rblock_t& to, const xrblock_t<xWord>& from,
+        size_t lane) NOEXCEPT;
+    template <typename xWord>
+    INLINE static size_t index(const xrblock_t<xWord>& xrblock,
+        size_t lane) NOEXCEPT;
+    template <typename xWord>
+    INLINE static void pack(xrblock_t<xWord>& xrblock,
+        const rblock_t* rblocks) NOEXCEPT;
+    template <typename xWord>
+    INLINE static void unpack(rblock_t* rblocks,
+        const xrblock_t<xWord>& xrblock) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static xblock_t<xWord>& salsa_8(xblock_t<xWord>& xblock) NOEXCEPT;
+    template <typename xWord>
+    INLINE static void block_mix(xrblock_t<xWord>& xrblock,
+        xyblock_t<xWord>& xyblock) NOEXCEPT;
+    template <typename xWord>
+    static inline bool romix_v(rblock_t* rblocks) NOEXCEPT;
+    static inline size_t vector_lanes(size_t count, uint64_t memory) NOEXCEPT;
+    static inline bool romix_v(rblock_t* rblocks, size_t lanes) NOEXCEPT;
 
 private:
     template<typename Block>
@@ -110,6 +179,8 @@ static_assert(scrypt< 1024, 1, 1>::minimum_memory == 131'392_u64);
 static_assert(scrypt<16384, 8, 8>::minimum_memory == 16'786'048_u64);
 static_assert(scrypt< 1024, 1, 1>::maximum_memory == 131'392_u64);
 static_assert(scrypt<16384, 8, 8>::maximum_memory == 134'231'040_u64);
+static_assert(scrypt< 1024, 1, 1>::romix_memory == 131'264_u64);
+static_assert(scrypt<16384, 8, 8>::romix_memory == 16'777'856_u64);
 
 } // namespace system
 } // namespace libbitcoin
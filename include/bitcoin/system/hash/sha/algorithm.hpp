@@ -60,6 +60,7 @@ public:
     /// Byte-based types.
     using byte_t    = uint8_t;
     using half_t    = std_array<byte_t, SHA::chunk_words * SHA::word_bytes>;
+    using quarter_t = std_array<byte_t, to_half(SHA::chunk_words) * SHA::word_bytes>;
     using block_t   = std_array<byte_t, SHA::block_words * SHA::word_bytes>;
     using digest_t  = std_array<byte_t, bytes<SHA::digest>>;
 
@@ -107,6 +108,17 @@ public:
     static VCONSTEXPR digest_t merkle_root(digests_t&& digests) NOEXCEPT;
     static VCONSTEXPR digests_t& merkle_hash(digests_t& digests) NOEXCEPT;
 
+    /// Midstate hashing (sha256/512).
+    /// -----------------------------------------------------------------------
+    /// Double hashing of one block and one quarter block (e.g. sha256 header),
+    /// from the state of the block. The batch form hashes digests.size()
+    /// variations of quarter, the last word (little-endian) incremented in each.
+    static constexpr state_t midstate(const block_t& block) NOEXCEPT;
+    static constexpr digest_t midstate_hash(const state_t& midstate,
+        const quarter_t& quarter) NOEXCEPT;
+    static void midstate_hash(digests_t& digests, const state_t& midstate,
+        const quarter_t& quarter) NOEXCEPT;
+
     /// Streamed hashing (unfinalized).
     /// -----------------------------------------------------------------------
     static void accumulate(state_t& state, iblocks_t&& blocks) NOEXCEPT;
@@ -168,6 +180,7 @@ protected:
     INLINE static constexpr void input(buffer_t& buffer, const block_t& block) NOEXCEPT;
     INLINE static constexpr void input1(buffer_t& buffer, const half_t& half) NOEXCEPT;
     INLINE static constexpr void input2(buffer_t& buffer, const half_t& half) NOEXCEPT;
+    INLINE static constexpr void input(buffer_t& buffer, const quarter_t& quarter) NOEXCEPT;
     INLINE static constexpr digest_t output(const state_t& state) NOEXCEPT;
 
     /// Padding
@@ -177,6 +190,7 @@ protected:
     static constexpr void schedule_n(buffer_t& buffer, size_t blocks) NOEXCEPT;
     static constexpr void schedule_1(buffer_t& buffer) NOEXCEPT;
     static constexpr void pad_half(buffer_t& buffer) NOEXCEPT;
+    static constexpr void pad_quarter(buffer_t& buffer) NOEXCEPT;
     static constexpr void pad_n(buffer_t& buffer, count_t blocks) NOEXCEPT;
 
     /// Block iteration.
@@ -200,11 +214,14 @@ protected:
 private:
     using pad_t = std_array<word_t, subtract(SHA::block_words,
         count_bytes / SHA::word_bytes)>;
+    using tail_t = std_array<word_t, subtract(SHA::block_words,
+        to_half(SHA::chunk_words))>;
 
     template <size_t Blocks>
     static CONSTEVAL buffer_t scheduled_pad() NOEXCEPT;
     static CONSTEVAL chunk_t chunk_pad() NOEXCEPT;
     static CONSTEVAL pad_t stream_pad() NOEXCEPT;
+    static CONSTEVAL tail_t quarter_pad() NOEXCEPT;
 
 /// Compression.
 /// -----------------------------------------------------------------------
@@ -273,6 +290,20 @@ protected:
 
     INLINE static void merkle_hash_v(digests_t& digests) NOEXCEPT;
 
+    /// Midstate Hash.
+    /// -----------------------------------------------------------------------
+
+    template <typename xWord>
+    INLINE static auto pack_counter(word_t counter) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void midstate_hash_v_(idigests_t& digests,
+        const state_t& midstate, const buffer_t& message,
+        word_t& counter) NOEXCEPT;
+
+    INLINE static size_t midstate_hash_v(digests_t& digests,
+        const state_t& midstate, const buffer_t& message) NOEXCEPT;
+
     /// Message Schedule (block vectorization).
     /// -----------------------------------------------------------------------
 
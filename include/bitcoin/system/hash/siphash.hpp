@@ -23,6 +23,7 @@
 #define LIBBITCOIN_SYSTEM_HASH_SIPHASH
 
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/functions.hpp>
@@ -37,6 +38,13 @@ BC_API uint64_t siphash(const siphash_key& key,
 BC_API uint64_t siphash(const half_hash& hash,
     const data_slice& message) NOEXCEPT;
 
+/// Hash each message with the same key, in message order.
+/// Messages of equal word count are hashed in SIMD lanes when available.
+BC_API std::vector<uint64_t> siphash(const siphash_key& key,
+    const data_stack& messages) NOEXCEPT;
+BC_API std::vector<uint64_t> siphash(const half_hash& hash,
+    const data_stack& messages) NOEXCEPT;
+
 BC_API siphash_key to_siphash_key(const half_hash& hash) NOEXCEPT;
 
 } // namespace system
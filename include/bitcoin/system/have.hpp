@@ -110,6 +110,11 @@
     #define HAVE_XASSEMBLY
 #endif
 
+/// Native 128 bit integer (gcc/clang on 64 bit targets).
+#if defined(__SIZEOF_INT128__) && (defined(HAVE_CLANG) || defined(HAVE_GNUC))
+    #define HAVE_INT128
+#endif
+
 /// ARM Neon intrinsics.
 #if defined(HAVE_ARM)
     // -march=armv8-a+crc+crypto [all]
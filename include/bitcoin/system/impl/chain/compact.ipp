@@ -81,10 +81,8 @@ compact::from_compact(const parse& compact) NOEXCEPT
     );
 }
 
-// public
-
-constexpr compact::span_type
-compact::expand(small_type exponential) NOEXCEPT
+constexpr typename compact::small_type
+compact::normalize_expand(small_type exponential) NOEXCEPT
 {
     auto compact = to_compact(exponential);
 
@@ -101,14 +99,14 @@ compact::expand(small_type exponential) NOEXCEPT
     }
 
     // Above exists only because negatives were inadvertently excluded.
-    
-    return base256e::expand(from_compact(compact));
+
+    return from_compact(compact);
 }
 
-constexpr compact::small_type
-compact::compress(const span_type& number) NOEXCEPT
+constexpr typename compact::small_type
+compact::normalize_compress(small_type small) NOEXCEPT
 {
-    auto compact = to_compact(base256e::compress(number));
+    auto compact = to_compact(small);
 
     // Below exists only to work around negatives being inadvertently excluded.
 
@@ -122,6 +120,62 @@ compact::compress(const span_type& number) NOEXCEPT
     return from_compact(compact);
 }
 
+// public
+
+constexpr compact::span_type
+compact::expand(small_type exponential) NOEXCEPT
+{
+    // A negative is normalized to zero, which expands to zero.
+    return base256e::expand(normalize_expand(exponential));
+}
+
+constexpr compact::small_type
+compact::compress(const span_type& number) NOEXCEPT
+{
+    return normalize_compress(base256e::compress(number));
+}
+
+// As base256e::expand, over fixed_uint256.
+constexpr fixed_uint256
+compact::expand_fixed(small_type exponential) NOEXCEPT
+{
+    const auto normal = normalize_expand(exponential);
+    const auto shift = raise(shift_right(normal, precision));
+    const auto mantissa = mask_left<small_type>(normal, e_width);
+
+    // Zero returned if unsigned exponent is out of bounds [0..e_max].
+    if (is_limited(shift, span))
+        return {};
+
+    fixed_uint256 number{ mantissa };
+
+    shift > precision ?
+        number <<= (shift - precision) :
+        number >>= (precision - shift);
+
+    return number;
+}
+
+// As base256e::compress, over fixed_uint256.
+constexpr compact::small_type
+compact::compress_fixed(const fixed_uint256& number) NOEXCEPT
+{
+    if (is_zero(number))
+        return 0;
+
+    const auto shift = raise(number.byte_width());
+    const auto mantissa = narrow_cast<small_type>
+    (
+        (shift > precision ?
+            number >> (shift - precision) :
+            number << (precision - shift)).limbs().front()
+    );
+
+    return normalize_compress(bit_or(shift_left(
+        possible_narrow_cast<small_type>(lower(shift)), precision),
+        mantissa));
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
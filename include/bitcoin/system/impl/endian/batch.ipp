@@ -212,6 +212,57 @@ constexpr void to_little_endians(std_array<Integral, Count>& out,
     from_little_endians(out, in);
 }
 
+// Span (out may equal in).
+// ----------------------------------------------------------------------------
+
+template <typename Integral>
+inline void byteswaps_copy(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT
+{
+    if (out != in)
+        std::copy_n(in, count, out);
+}
+
+template <typename Integral, if_integral_integer<Integral>>
+inline void from_big_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT
+{
+    using unsigned_type = to_unsigned_type<Integral>;
+
+    if constexpr (is_little_endian && !is_one(sizeof(Integral)))
+        byteswaps(possible_pointer_cast<unsigned_type>(out),
+            possible_pointer_cast<const unsigned_type>(in), count);
+    else
+        byteswaps_copy(out, in, count);
+}
+
+template <typename Integral, if_integral_integer<Integral>>
+inline void from_little_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT
+{
+    using unsigned_type = to_unsigned_type<Integral>;
+
+    if constexpr (is_big_endian && !is_one(sizeof(Integral)))
+        byteswaps(possible_pointer_cast<unsigned_type>(out),
+            possible_pointer_cast<const unsigned_type>(in), count);
+    else
+        byteswaps_copy(out, in, count);
+}
+
+template <typename Integral, if_integral_integer<Integral>>
+inline void to_big_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT
+{
+    from_big_endians(out, in, count);
+}
+
+template <typename Integral, if_integral_integer<Integral>>
+inline void to_little_endians(Integral* out, const Integral* in,
+    size_t count) NOEXCEPT
+{
+    from_little_endians(out, in, count);
+}
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -36,25 +36,37 @@ namespace system {
 // hmac accumulator
 // ---------------------------------------------------------------------------
 
+TEMPLATE
+inline typename CLASS::midstate_t CLASS::
+midstate(const data_slice& key) NOEXCEPT
+{
+    auto ipad = inner_pad();
+    auto opad = outer_pad();
+    xor_key(ipad, opad, key);
+
+    // Each pad is exactly one block, so its accumulation is only a state.
+    midstate_t out{ Algorithm::H::get, Algorithm::H::get };
+    Algorithm::accumulate(out.inner, ipad);
+    Algorithm::accumulate(out.outer, opad);
+    return out;
+}
+
 TEMPLATE
 inline CLASS::
 hmac(const data_slice& key) NOEXCEPT
 {
-    constexpr auto block_bytes = array_count<typename Algorithm::block_t>;
-    constexpr auto digest_bytes = array_count<typename Algorithm::digest_t>;
-
-    // rfc2104
-    // K if K is not larger than block size.
-    if (key.size() <= block_bytes)
-    {
-        xor_key(key.data(), key.size());
-        return;
-    }
+    auto ipad = inner_pad();
+    auto opad = outer_pad();
+    xor_key(ipad, opad, key);
+    inner_.write(ipad);
+    outer_.write(opad);
+}
 
-    // rfc2104
-    // H(K) if K is larger than block size.
-    xor_key(accumulator<Algorithm>::hash(key.size(), key.data()).data(),
-        digest_bytes);
+TEMPLATE
+inline CLASS::
+hmac(const midstate_t& midstate) NOEXCEPT
+  : inner_{ midstate.inner, one }, outer_{ midstate.outer, one }
+{
 }
 
 TEMPLATE
@@ -134,23 +146,30 @@ outer_pad() NOEXCEPT
     return opad;
 }
 
-// protected
+// protected/static
 TEMPLATE
 inline void CLASS::
-xor_key(const byte_t* key, size_t size) NOEXCEPT
+xor_key(block_t& ipad, block_t& opad, const data_slice& key) NOEXCEPT
 {
-    constexpr auto ipad = inner_pad();
-    constexpr auto opad = outer_pad();
+    constexpr auto block_bytes = array_count<block_t>;
+    constexpr auto digest_bytes = array_count<digest_t>;
 
     // rfc2104
-    // XOR (bitwise exclusive-OR) the B byte string ... with ipad.
-    auto pad = ipad;
-    inner_.write(xor_n(pad, key, size));
+    // K if K is not larger than block size.
+    if (key.size() <= block_bytes)
+    {
+        // rfc2104
+        // XOR (bitwise exclusive-OR) the B byte string ... with ipad/opad.
+        xor_n(ipad, key.data(), key.size());
+        xor_n(opad, key.data(), key.size());
+        return;
+    }
 
     // rfc2104
-    // XOR (bitwise exclusive-OR) the B byte string ... with opad.
-    pad = opad;
-    outer_.write(xor_n(pad, key, size));
+    // H(K) if K is larger than block size.
+    const auto hash = accumulator<Algorithm>::hash(key.size(), key.data());
+    xor_n(ipad, hash.data(), digest_bytes);
+    xor_n(opad, hash.data(), digest_bytes);
 }
 
 // finalized authentication code
@@ -167,6 +186,17 @@ code(const data_slice& data, const data_slice& key) NOEXCEPT
     return buffer.flush();
 }
 
+TEMPLATE
+inline typename CLASS::digest_t CLASS::
+code(const data_slice& data, const midstate_t& midstate) NOEXCEPT
+{
+    // rfc2104
+    // H(K XOR opad, H(K XOR ipad, text)) [with precomputed pad states].
+    hmac<Algorithm> buffer{ midstate };
+    buffer.write(data);
+    return buffer.flush();
+}
+
 #undef CLASS
 #undef TEMPLATE
 
@@ -0,0 +1,337 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_MERKLE_TREE_IPP
+#define LIBBITCOIN_SYSTEM_HASH_MERKLE_TREE_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+#define TEMPLATE template <typename Algorithm>
+#define CLASS merkle_tree<Algorithm>
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// constructors
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline CLASS::
+merkle_tree(const digests_t& leaves) NOEXCEPT
+  : buffer_(leaves)
+{
+    build();
+}
+
+TEMPLATE
+inline CLASS::
+merkle_tree(digests_t&& leaves) NOEXCEPT
+  : buffer_(std::move(leaves))
+{
+    build();
+}
+
+// properties
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline size_t CLASS::
+size() const NOEXCEPT
+{
+    return is_zero(depth()) ? zero : level_size(zero);
+}
+
+TEMPLATE
+inline size_t CLASS::
+depth() const NOEXCEPT
+{
+    return sizes_.size();
+}
+
+TEMPLATE
+inline typename CLASS::digest_t CLASS::
+root() const NOEXCEPT
+{
+    return is_zero(depth()) ? digest_t{} : level(sub1(depth()))[zero];
+}
+
+TEMPLATE
+inline const typename CLASS::digest_t& CLASS::
+leaf(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < size());
+    return buffer_[index];
+}
+
+// branches
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline typename CLASS::branch_t CLASS::
+branch(size_t index) const NOEXCEPT
+{
+    if (index >= size())
+        return {};
+
+    branch_t out{};
+    out.reserve(sub1(depth()));
+    for (size_t row = 0; row < sub1(depth()); ++row)
+    {
+        out.push_back(sibling(row, index));
+        index = to_half(index);
+    }
+
+    return out;
+}
+
+TEMPLATE
+inline typename CLASS::branches_t CLASS::
+branches(const indexes_t& indexes) const NOEXCEPT
+{
+    const auto leaves = size();
+    const auto height = is_zero(depth()) ? zero : sub1(depth());
+    branches_t out(indexes.size());
+
+    for (size_t item = 0; item < indexes.size(); ++item)
+        if (indexes[item] < leaves)
+            out[item].reserve(height);
+
+    // Levels outer, so that each level is read (once) in sequence.
+    for (size_t row = 0; row < height; ++row)
+        for (size_t item = 0; item < indexes.size(); ++item)
+            if (indexes[item] < leaves)
+                out[item].push_back(sibling(row,
+                    shift_right(indexes[item], row)));
+
+    return out;
+}
+
+TEMPLATE
+inline typename CLASS::digest_t CLASS::
+root(const digest_t& leaf, const branch_t& branch, size_t index) NOEXCEPT
+{
+    auto out = leaf;
+    for (const auto& node: branch)
+    {
+        out = is_odd(index) ? Algorithm::double_hash(node, out) :
+            Algorithm::double_hash(out, node);
+        index = to_half(index);
+    }
+
+    return out;
+}
+
+// mutators
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline bool CLASS::
+update(size_t index, const digest_t& leaf) NOEXCEPT
+{
+    if (index >= size())
+        return false;
+
+    node(zero, index) = leaf;
+    for (size_t row = 0; row < sub1(depth()); ++row)
+    {
+        rehash(row, index);
+        index = to_half(index);
+    }
+
+    return true;
+}
+
+TEMPLATE
+inline void CLASS::
+append(const digest_t& leaf) NOEXCEPT
+{
+    if (is_zero(depth()))
+    {
+        buffer_.assign(one, leaf);
+        build();
+        return;
+    }
+
+    // Levels are relocated only when leaf capacity is exhausted, doubling it.
+    auto index = size();
+    if (index == capacity(zero))
+        reserve(two * index);
+
+    // Grow each level by at most one node, adding a root level as required.
+    auto count = add1(index);
+    for (size_t row = 0;; ++row)
+    {
+        if (row == depth())
+            sizes_.push_back(count);
+        else
+            sizes_[row] = count;
+
+        if (is_one(count))
+            break;
+
+        count = parent_size(count);
+    }
+
+    // Only the new leaf and its ancestors (the right edge) are rehashed.
+    node(zero, index) = leaf;
+    for (size_t row = 0; row < sub1(depth()); ++row)
+    {
+        rehash(row, index);
+        index = to_half(index);
+    }
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline size_t CLASS::
+parent_size(size_t size) NOEXCEPT
+{
+    return to_half(add1(size));
+}
+
+TEMPLATE
+inline size_t CLASS::
+level_size(size_t row) const NOEXCEPT
+{
+    return sizes_[row];
+}
+
+TEMPLATE
+inline size_t CLASS::
+capacity(size_t row) const NOEXCEPT
+{
+    return offsets_[add1(row)] - offsets_[row];
+}
+
+TEMPLATE
+inline const typename CLASS::digest_t* CLASS::
+level(size_t row) const NOEXCEPT
+{
+    return &buffer_[offsets_[row]];
+}
+
+TEMPLATE
+inline typename CLASS::digest_t* CLASS::
+level(size_t row) NOEXCEPT
+{
+    return &buffer_[offsets_[row]];
+}
+
+TEMPLATE
+inline typename CLASS::digest_t& CLASS::
+node(size_t row, size_t index) NOEXCEPT
+{
+    return level(row)[index];
+}
+
+TEMPLATE
+inline const typename CLASS::digest_t& CLASS::
+sibling(size_t row, size_t index) const NOEXCEPT
+{
+    // The last node of an odd level is its own sibling.
+    const auto other = is_odd(index) ? sub1(index) : add1(index);
+    return level(row)[other < level_size(row) ? other : index];
+}
+
+TEMPLATE
+inline void CLASS::
+rehash(size_t row, size_t index) NOEXCEPT
+{
+    const auto left = index - (index % two);
+    node(add1(row), to_half(index)) = Algorithm::double_hash(
+        level(row)[left], sibling(row, left));
+}
+
+TEMPLATE
+inline void CLASS::
+reserve(size_t leaves) NOEXCEPT
+{
+    // Each level has capacity for the parents of a full level below it.
+    std_vector<size_t> offsets{ zero };
+    for (auto count = leaves;; count = parent_size(count))
+    {
+        offsets.push_back(offsets.back() + count);
+        if (is_one(count))
+            break;
+    }
+
+    digests_t buffer(offsets.back());
+    for (size_t row = 0; row < depth(); ++row)
+        std::copy_n(level(row), level_size(row), &buffer[offsets[row]]);
+
+    buffer_ = std::move(buffer);
+    offsets_ = std::move(offsets);
+}
+
+TEMPLATE
+inline void CLASS::
+build() NOEXCEPT
+{
+    offsets_.clear();
+    sizes_.clear();
+    if (buffer_.empty())
+        return;
+
+    // Levels sum to less than twice the leaf count.
+    buffer_.reserve(buffer_.size() * two);
+    offsets_.push_back(zero);
+
+    digests_t scratch{};
+    auto start = zero;
+    auto count = buffer_.size();
+    sizes_.push_back(count);
+
+    while (!is_one(count))
+    {
+        const auto first = std::next(buffer_.begin(), start);
+        scratch.assign(first, std::next(first, count));
+
+        if (is_odd(count))
+            scratch.push_back(scratch.back());
+
+        Algorithm::merkle_hash(scratch);
+        start += count;
+        count = scratch.size();
+        sizes_.push_back(count);
+        offsets_.push_back(start);
+        buffer_.insert(buffer_.end(), scratch.begin(), scratch.end());
+    }
+
+    offsets_.push_back(buffer_.size());
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -27,6 +27,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 // Based on:
@@ -38,9 +39,9 @@ namespace libbitcoin {
 namespace system {
 
 #define TEMPLATE \
-template<size_t W, size_t R, size_t P, bool Concurrent, \
+template<size_t W, size_t R, size_t P, bool Concurrent, bool Vectorized, \
     bool_if<is_scrypt_args<W, R, P>> If>
-#define CLASS scrypt<W, R, P, Concurrent, If>
+#define CLASS scrypt<W, R, P, Concurrent, Vectorized, If>
 
 BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
 BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
@@ -454,9 +455,15 @@ romix(rblock_t& rblock) NOEXCEPT
     // [P * (W * (R * 128))] bytes heap allocated.
     const auto ptr = allocate<wrblock_t>();
     if (!ptr) return false;
-    auto& wrblocks = *ptr;
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+    return romix(rblock, *ptr);
+}
+
+TEMPLATE
+inline bool CLASS::
+romix(rblock_t& rblock, wrblock_t& wrblocks) NOEXCEPT
+{
     // rfc7914
     // 1. X = B
     // 2. for i = 0 to N - 1 do
@@ -483,6 +490,351 @@ romix(rblock_t& rblock) NOEXCEPT
     return true;
 }
 
+TEMPLATE
+inline bool CLASS::
+romix(rblock_t* rblocks, size_t count, uint64_t memory) NOEXCEPT
+{
+    // Each unit mixes one vector of rblocks, or a single (remaining) rblock.
+    struct unit { rblock_t* rblocks; size_t lanes; };
+    const auto width = vector_lanes(count, memory);
+    std_vector<unit> units{};
+    units.reserve(count);
+
+    for (size_t i = 0; i < count;)
+    {
+        const auto size = (count - i) < width ? one : width;
+        units.push_back({ &rblocks[i], size });
+        i += size;
+    }
+
+    // Concurrent units are bounded by memory (but at least one proceeds).
+    const auto batch = std::min(units.size(), Concurrent ? std::max(one,
+        limit<size_t>(memory / (width * romix_memory))) : one);
+
+    // Make a working set of W rblocks for each concurrent scalar unit.
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [batch * (W * (R * 128))] bytes heap allocated (reused by each batch).
+    std_vector<std::shared_ptr<wrblock_t>> sets{};
+    if (width == one)
+    {
+        sets.reserve(batch);
+        for (size_t i = 0; i < batch; ++i)
+        {
+            sets.push_back(allocate<wrblock_t>());
+            if (!sets.back()) return false;
+        }
+    }
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    std::atomic_bool success{ true };
+    for (auto it = units.begin(); it != units.end();)
+    {
+        const auto end = std::next(it, std::min(batch,
+            possible_narrow_sign_cast<size_t>(std::distance(it, units.end()))));
+
+        // The position of a unit in its batch selects its working set.
+        const auto first = &(*it);
+        std_for_each(concurrency(), it, end,
+            [&](const unit& item) NOEXCEPT
+            {
+                const auto slot = possible_narrow_sign_cast<size_t>(
+                    &item - first);
+
+                success = success && ((item.lanes == one) ? (sets.empty() ?
+                    romix(*item.rblocks) : romix(*item.rblocks, *sets[slot])) :
+                    romix_v(item.rblocks, item.lanes));
+            });
+
+        it = end;
+    }
+
+    return success;
+}
+
+// Vectorization.
+// ----------------------------------------------------------------------------
+// Lanes are mixed as independent rblocks, with each xWord of an xblock holding
+// the same word of each lane. Vectors are only used on little-endian (x86).
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::word_t& CLASS::
+lane(xWord& xword, size_t lane) NOEXCEPT
+{
+    // Lane zero is the lowest order (lowest address) word.
+    return pointer_cast<word_t>(&xword)[lane];
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::word_t CLASS::
+lane(const xWord& xword, size_t lane) NOEXCEPT
+{
+    return pointer_cast<const word_t>(&xword)[lane];
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::template xblock_t<xWord>& CLASS::
+xor_(xblock_t<xWord>& to, const xblock_t<xWord>& from) NOEXCEPT
+{
+    to[ 0] = f::xor_(to[ 0], from[ 0]);
+    to[ 1] = f::xor_(to[ 1], from[ 1]);
+    to[ 2] = f::xor_(to[ 2], from[ 2]);
+    to[ 3] = f::xor_(to[ 3], from[ 3]);
+    to[ 4] = f::xor_(to[ 4], from[ 4]);
+    to[ 5] = f::xor_(to[ 5], from[ 5]);
+    to[ 6] = f::xor_(to[ 6], from[ 6]);
+    to[ 7] = f::xor_(to[ 7], from[ 7]);
+    to[ 8] = f::xor_(to[ 8], from[ 8]);
+    to[ 9] = f::xor_(to[ 9], from[ 9]);
+    to[10] = f::xor_(to[10], from[10]);
+    to[11] = f::xor_(to[11], from[11]);
+    to[12] = f::xor_(to[12], from[12]);
+    to[13] = f::xor_(to[13], from[13]);
+    to[14] = f::xor_(to[14], from[14]);
+    to[15] = f::xor_(to[15], from[15]);
+    return to;
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xor_(xrblock_t<xWord>& to, const rblock_t& from, size_t lane) NOEXCEPT
+{
+    // Each lane selects its own V[j], so lanes are xored independently.
+    for (size_t i = 0; i < (R << 1); ++i)
+    {
+        const auto& words = array_cast<word_t>(from[i]);
+        for (size_t j = 0; j < array_count<xblock_t<xWord>>; ++j)
+            CLASS::lane(to[i][j], lane) ^= words[j];
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+store(rblock_t& to, const xrblock_t<xWord>& from, size_t lane) NOEXCEPT
+{
+    // V is stored by lane (in native words), so that reading V[j] of a lane
+    // does not also pull the interleaved words of all other lanes into cache.
+    for (size_t i = 0; i < (R << 1); ++i)
+    {
+        auto& words = array_cast<word_t>(to[i]);
+        for (size_t j = 0; j < array_count<xblock_t<xWord>>; ++j)
+            words[j] = CLASS::lane(from[i][j], lane);
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE size_t CLASS::
+index(const xrblock_t<xWord>& xrblock, size_t lane) NOEXCEPT
+{
+    // Words are native, so Integerify (X) is (low | high << 32) mod N.
+    const uint64_t low = CLASS::lane(xrblock.back()[0], lane);
+    const uint64_t high = CLASS::lane(xrblock.back()[1], lane);
+    return possible_narrow_cast<size_t>(bit_or(shift_left(high, 32), low) % W);
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+pack(xrblock_t<xWord>& xrblock, const rblock_t* rblocks) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    for (size_t k = 0; k < lanes; ++k)
+        for (size_t i = 0; i < (R << 1); ++i)
+        {
+            const auto& words = array_cast<word_t>(rblocks[k][i]);
+            for (size_t j = 0; j < array_count<xblock_t<xWord>>; ++j)
+                lane(xrblock[i][j], k) = native_from_little_end(words[j]);
+        }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+unpack(rblock_t* rblocks, const xrblock_t<xWord>& xrblock) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    for (size_t k = 0; k < lanes; ++k)
+        for (size_t i = 0; i < (R << 1); ++i)
+        {
+            auto& words = array_cast<word_t>(rblocks[k][i]);
+            for (size_t j = 0; j < array_count<xblock_t<xWord>>; ++j)
+                words[j] = native_to_little_end(lane(xrblock[i][j], k));
+        }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::template xblock_t<xWord>& CLASS::
+salsa_8(xblock_t<xWord>& xblock) NOEXCEPT
+{
+    constexpr auto s = bits<word_t>;
+    auto x = xblock;
+
+    // salsa20/8 core (see salsa_8), across all lanes.
+    for (size_t i = 0; i < 4u; ++i)
+    {
+        // columns
+        x[ 4] = f::xor_(x[ 4], f::rol< 7, s>(f::add<s>(x[ 0], x[12])));
+        x[ 8] = f::xor_(x[ 8], f::rol< 9, s>(f::add<s>(x[ 4], x[ 0])));
+        x[12] = f::xor_(x[12], f::rol<13, s>(f::add<s>(x[ 8], x[ 4])));
+        x[ 0] = f::xor_(x[ 0], f::rol<18, s>(f::add<s>(x[12], x[ 8])));
+
+        x[ 9] = f::xor_(x[ 9], f::rol< 7, s>(f::add<s>(x[ 5], x[ 1])));
+        x[13] = f::xor_(x[13], f::rol< 9, s>(f::add<s>(x[ 9], x[ 5])));
+        x[ 1] = f::xor_(x[ 1], f::rol<13, s>(f::add<s>(x[13], x[ 9])));
+        x[ 5] = f::xor_(x[ 5], f::rol<18, s>(f::add<s>(x[ 1], x[13])));
+
+        x[14] = f::xor_(x[14], f::rol< 7, s>(f::add<s>(x[10], x[ 6])));
+        x[ 2] = f::xor_(x[ 2], f::rol< 9, s>(f::add<s>(x[14], x[10])));
+        x[ 6] = f::xor_(x[ 6], f::rol<13, s>(f::add<s>(x[ 2], x[14])));
+        x[10] = f::xor_(x[10], f::rol<18, s>(f::add<s>(x[ 6], x[ 2])));
+
+        x[ 3] = f::xor_(x[ 3], f::rol< 7, s>(f::add<s>(x[15], x[11])));
+        x[ 7] = f::xor_(x[ 7], f::rol< 9, s>(f::add<s>(x[ 3], x[15])));
+        x[11] = f::xor_(x[11], f::rol<13, s>(f::add<s>(x[ 7], x[ 3])));
+        x[15] = f::xor_(x[15], f::rol<18, s>(f::add<s>(x[11], x[ 7])));
+
+        // rows
+        x[ 1] = f::xor_(x[ 1], f::rol< 7, s>(f::add<s>(x[ 0], x[ 3])));
+        x[ 2] = f::xor_(x[ 2], f::rol< 9, s>(f::add<s>(x[ 1], x[ 0])));
+        x[ 3] = f::xor_(x[ 3], f::rol<13, s>(f::add<s>(x[ 2], x[ 1])));
+        x[ 0] = f::xor_(x[ 0], f::rol<18, s>(f::add<s>(x[ 3], x[ 2])));
+
+        x[ 6] = f::xor_(x[ 6], f::rol< 7, s>(f::add<s>(x[ 5], x[ 4])));
+        x[ 7] = f::xor_(x[ 7], f::rol< 9, s>(f::add<s>(x[ 6], x[ 5])));
+        x[ 4] = f::xor_(x[ 4], f::rol<13, s>(f::add<s>(x[ 7], x[ 6])));
+        x[ 5] = f::xor_(x[ 5], f::rol<18, s>(f::add<s>(x[ 4], x[ 7])));
+
+        x[11] = f::xor_(x[11], f::rol< 7, s>(f::add<s>(x[10], x[ 9])));
+        x[ 8] = f::xor_(x[ 8], f::rol< 9, s>(f::add<s>(x[11], x[10])));
+        x[ 9] = f::xor_(x[ 9], f::rol<13, s>(f::add<s>(x[ 8], x[11])));
+        x[10] = f::xor_(x[10], f::rol<18, s>(f::add<s>(x[ 9], x[ 8])));
+
+        x[12] = f::xor_(x[12], f::rol< 7, s>(f::add<s>(x[15], x[14])));
+        x[13] = f::xor_(x[13], f::rol< 9, s>(f::add<s>(x[12], x[15])));
+        x[14] = f::xor_(x[14], f::rol<13, s>(f::add<s>(x[13], x[12])));
+        x[15] = f::xor_(x[15], f::rol<18, s>(f::add<s>(x[14], x[13])));
+    }
+
+    for (size_t i = 0; i < array_count<xblock_t<xWord>>; ++i)
+        xblock[i] = f::add<s>(xblock[i], x[i]);
+
+    return xblock;
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+block_mix(xrblock_t<xWord>& xrblock, xyblock_t<xWord>& xyblock) NOEXCEPT
+{
+    // BLOCK_MIX_OPTIMAL_FORM (see block_mix), across all lanes.
+    xblock_t<xWord> xblock{ xrblock.back() };
+
+    for (size_t i = 0, j = 0; i < sub1(R); ++i)
+    {
+        xrblock[i] = salsa_8(xor_(xblock, xrblock[j++]));
+        xyblock[i] = salsa_8(xor_(xblock, xrblock[j++]));
+    }
+
+    xrblock[sub1(R << 0)] = salsa_8(xor_(xblock, xrblock[sub1(sub1(R << 1))]));
+    salsa_8(xor_(xrblock[sub1(R << 1)], xblock));
+
+    for (size_t i = 0, j = R; i < sub1(R); ++i)
+        xrblock[j++] = xyblock[i];
+}
+
+TEMPLATE
+template <typename xWord>
+inline bool CLASS::
+romix_v(rblock_t* rblocks) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    // Make a working set of W rblocks for each lane and X/Y working xrblocks.
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [lanes * (W * (R * 128))] bytes heap allocated.
+    const auto ptr = allocate<xwrblock_t<xWord>>();
+    const auto xptr = allocate<xrblock_t<xWord>>();
+    const auto yptr = allocate<xyblock_t<xWord>>();
+    if (!ptr || !xptr || !yptr) return false;
+    auto& xwrblocks = *ptr;
+    auto& xrblock = *xptr;
+    auto& xyblock = *yptr;
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    pack(xrblock, rblocks);
+
+    for (size_t i = 0; i < W; ++i)
+    {
+        for (size_t k = 0; k < lanes; ++k)
+            store(xwrblocks[k][i], xrblock, k);
+
+        block_mix(xrblock, xyblock);
+    }
+
+    for (size_t i = 0; i < W; ++i)
+    {
+        for (size_t k = 0; k < lanes; ++k)
+            xor_(xrblock, xwrblocks[k][index(xrblock, k)], k);
+
+        block_mix(xrblock, xyblock);
+    }
+
+    unpack(rblocks, xrblock);
+    return true;
+}
+
+TEMPLATE
+inline size_t CLASS::
+vector_lanes(size_t count, uint64_t memory) NOEXCEPT
+{
+    // Widest available vector with sufficient rblocks and memory.
+    const auto fits = [&](size_t lanes) NOEXCEPT
+    {
+        return count >= lanes && memory >= lanes * romix_memory;
+    };
+
+    if constexpr (have_x512)
+        if (fits(capacity<xint512_t, word_t>) && have<xint512_t>())
+            return capacity<xint512_t, word_t>;
+
+    if constexpr (have_x256)
+        if (fits(capacity<xint256_t, word_t>) && have<xint256_t>())
+            return capacity<xint256_t, word_t>;
+
+    if constexpr (have_x128)
+        if (fits(capacity<xint128_t, word_t>) && have<xint128_t>())
+            return capacity<xint128_t, word_t>;
+
+    return one;
+}
+
+TEMPLATE
+inline bool CLASS::
+romix_v(rblock_t* rblocks, size_t lanes) NOEXCEPT
+{
+    if constexpr (have_x512)
+        if (lanes == capacity<xint512_t, word_t>)
+            return romix_v<xint512_t>(rblocks);
+
+    if constexpr (have_x256)
+        if (lanes == capacity<xint256_t, word_t>)
+            return romix_v<xint256_t>(rblocks);
+
+    if constexpr (have_x128)
+        if (lanes == capacity<xint128_t, word_t>)
+            return romix_v<xint128_t>(rblocks);
+
+    return false;
+}
+
 // public
 // ----------------------------------------------------------------------------
 
@@ -514,12 +866,10 @@ CLASS::hash(data_array<Size>& out, const data_slice& password,
     // 2. for i = 0 to p - 1 do
     //    B[i] = scryptROMix (r, B[i], N)
     // end for
-    std::atomic_bool success{ true };
-    std_for_each(concurrency(), prblocks.begin(), prblocks.end(),
-        [&](rblock_t& rblock) NOEXCEPT
-        {
-            success = success && romix(rblock);
-        });
+    constexpr auto memory = (Concurrent || Vectorized) ? maximum_memory :
+        minimum_memory;
+    if (!romix(prblocks.data(), P, memory))
+        return false;
 
     // rfc7914
     // 3. DK = PBKDF2-HMAC-SHA256 (P, B[0] || B[1] || ... || B[p - 1], 1, dkLen)
@@ -537,6 +887,40 @@ CLASS::hash(const data_slice& password, const data_slice& salt) NOEXCEPT
     return out;
 }
 
+TEMPLATE
+template<size_t Size, if_not_greater<Size, scrypt_derivation::maximum_size>>
+bool
+CLASS::hash(std_vector<data_array<Size>>& out, const data_stack& passwords,
+    const data_stack& salts, uint64_t memory) NOEXCEPT
+{
+    const auto count = passwords.size();
+    if (salts.size() != count)
+        return false;
+
+    out.resize(count);
+    if (is_zero(count))
+        return true;
+
+    // Make a working set of P rblocks for each password (contiguous).
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [count * (P * (R * 128))] bytes heap allocated.
+    std_vector<prblock_t> prblocks(count);
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    for (size_t i = 0; i < count; ++i)
+        scrypt_derivation::key(array_cast<uint8_t>(prblocks[i]), passwords[i],
+            salts[i], one);
+
+    if (!romix(prblocks.front().data(), count * P, memory))
+        return false;
+
+    for (size_t i = 0; i < count; ++i)
+        scrypt_derivation::key(out[i], passwords[i],
+            array_cast<uint8_t>(prblocks[i]), one);
+
+    return true;
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -755,6 +755,35 @@ input2(buffer_t& buffer, const half_t& half) NOEXCEPT
     }
 }
 
+TEMPLATE
+INLINE constexpr void CLASS::
+input(buffer_t& buffer, const quarter_t& quarter) NOEXCEPT
+{
+    using word = array_element<buffer_t>;
+
+    if (std::is_constant_evaluated())
+    {
+        constexpr auto size = SHA::word_bytes;
+        from_big<0 * size>(buffer.at(0), quarter);
+        from_big<1 * size>(buffer.at(1), quarter);
+        from_big<2 * size>(buffer.at(2), quarter);
+        from_big<3 * size>(buffer.at(3), quarter);
+    }
+    else if constexpr (bc::is_little_endian)
+    {
+        const auto& in = array_cast<word>(quarter);
+        buffer[0] = native_from_big_end(in[0]);
+        buffer[1] = native_from_big_end(in[1]);
+        buffer[2] = native_from_big_end(in[2]);
+        buffer[3] = native_from_big_end(in[3]);
+    }
+    else
+    {
+        array_cast<word, to_half(SHA::chunk_words)>(buffer) =
+            array_cast<word>(quarter);
+    }
+}
+
 TEMPLATE
 INLINE constexpr typename CLASS::digest_t CLASS::
 output(const state_t& state) NOEXCEPT
@@ -858,6 +887,20 @@ stream_pad() NOEXCEPT
     return out;
 }
 
+TEMPLATE
+CONSTEVAL typename CLASS::tail_t CLASS::
+quarter_pad() NOEXCEPT
+{
+    // See comments in accumulator regarding padding endianness.
+    constexpr auto bytes = possible_narrow_cast<word_t>(
+        array_count<block_t> + array_count<quarter_t>);
+
+    tail_t out{};
+    out.front() = bit_hi<word_t>;
+    out.back() = to_bits(bytes);
+    return out;
+}
+
 TEMPLATE
 template<size_t Blocks>
 constexpr void CLASS::
@@ -938,6 +981,35 @@ pad_half(buffer_t& buffer) NOEXCEPT
     }
 }
 
+TEMPLATE
+constexpr void CLASS::
+pad_quarter(buffer_t& buffer) NOEXCEPT
+{
+    // Pad for any block and quarter block, unscheduled buffer.
+    constexpr auto pad = quarter_pad();
+
+    if (std::is_constant_evaluated())
+    {
+        buffer.at(4) = pad.at(0);
+        buffer.at(5) = pad.at(1);
+        buffer.at(6) = pad.at(2);
+        buffer.at(7) = pad.at(3);
+        buffer.at(8) = pad.at(4);
+        buffer.at(9) = pad.at(5);
+        buffer.at(10) = pad.at(6);
+        buffer.at(11) = pad.at(7);
+        buffer.at(12) = pad.at(8);
+        buffer.at(13) = pad.at(9);
+        buffer.at(14) = pad.at(10);
+        buffer.at(15) = pad.at(11);
+    }
+    else
+    {
+        array_cast<word_t, array_count<tail_t>, to_half(SHA::chunk_words)>(
+            buffer) = pad;
+    }
+}
+
 TEMPLATE
 constexpr void CLASS::
 pad_n(buffer_t& buffer, count_t blocks) NOEXCEPT
@@ -1185,6 +1257,83 @@ double_hash(const half_t& left, const half_t& right) NOEXCEPT
     return output(state);
 }
 
+// Midstate Hashing (sha256/512).
+// ---------------------------------------------------------------------------
+// No midstate optimizations for sha160 (double_hash requires half_t).
+
+TEMPLATE
+constexpr typename CLASS::state_t CLASS::
+midstate(const block_t& block) NOEXCEPT
+{
+    auto state = H::get;
+    accumulate(state, block);
+    return state;
+}
+
+TEMPLATE
+constexpr typename CLASS::digest_t CLASS::
+midstate_hash(const state_t& midstate, const quarter_t& quarter) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+
+    buffer_t buffer{};
+    auto state = midstate;
+    input(buffer, quarter);
+    pad_quarter(buffer);
+    schedule(buffer);
+    compress(state, buffer);
+
+    // Second hash
+    input(buffer, state);
+    pad_half(buffer);
+    schedule(buffer);
+    state = H::get;
+    compress(state, buffer);
+    return output(state);
+}
+
+TEMPLATE
+void CLASS::
+midstate_hash(digests_t& digests, const state_t& midstate,
+    const quarter_t& quarter) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+    constexpr auto last = sub1(to_half(SHA::chunk_words));
+
+    // Scheduling adds K to message words, so they are restored for each.
+    buffer_t message{};
+    input(message, quarter);
+    pad_quarter(message);
+
+    auto offset = zero;
+    if constexpr (vectorization)
+        offset = midstate_hash_v(digests, midstate, message);
+
+    // Counter is serialized little-endian, so byteswapped in the buffer.
+    auto counter = byteswap(message[last]);
+    counter += possible_narrow_cast<word_t>(offset);
+
+    // Complete hashes using normal form.
+    buffer_t buffer{};
+    for (auto index = offset; index < digests.size(); ++index, ++counter)
+    {
+        auto state = midstate;
+        message[last] = byteswap(counter);
+        array_cast<word_t, SHA::block_words>(buffer) =
+            array_cast<word_t, SHA::block_words>(message);
+        schedule(buffer);
+        compress(state, buffer);
+
+        // Second hash
+        input(buffer, state);
+        pad_half(buffer);
+        schedule(buffer);
+        state = H::get;
+        compress(state, buffer);
+        digests[index] = output(state);
+    }
+}
+
 // Block iteration.
 // ------------------------------------------------------------------------
 
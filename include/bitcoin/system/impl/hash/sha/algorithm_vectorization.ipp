@@ -475,6 +475,137 @@ merkle_hash_v(digests_t& digests) NOEXCEPT
     merkle_hash_(digests, offset);
 }
 
+// Midstate Hash.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+template <typename xWord>
+INLINE auto CLASS::
+pack_counter(word_t counter) NOEXCEPT
+{
+    // Lanes hash consecutive little-endian counters (big-endian words).
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    if constexpr (lanes == 2)
+    {
+        return byteswap<word_t>(set<xWord>(
+            counter + 0u,
+            counter + 1u));
+    }
+    else if constexpr (lanes == 4)
+    {
+        return byteswap<word_t>(set<xWord>(
+            counter + 0u,
+            counter + 1u,
+            counter + 2u,
+            counter + 3u));
+    }
+    else if constexpr (lanes == 8)
+    {
+        return byteswap<word_t>(set<xWord>(
+            counter + 0u,
+            counter + 1u,
+            counter + 2u,
+            counter + 3u,
+            counter + 4u,
+            counter + 5u,
+            counter + 6u,
+            counter + 7u));
+    }
+    else if constexpr (lanes == 16)
+    {
+        return byteswap<word_t>(set<xWord>(
+            counter +  0u,
+            counter +  1u,
+            counter +  2u,
+            counter +  3u,
+            counter +  4u,
+            counter +  5u,
+            counter +  6u,
+            counter +  7u,
+            counter +  8u,
+            counter +  9u,
+            counter + 10u,
+            counter + 11u,
+            counter + 12u,
+            counter + 13u,
+            counter + 14u,
+            counter + 15u));
+    }
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+midstate_hash_v_(idigests_t& digests, const state_t& midstate,
+    const buffer_t& message, word_t& counter) NOEXCEPT
+{
+    constexpr auto last = sub1(to_half(SHA::chunk_words));
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if (digests.size() >= lanes && have<xWord>())
+    {
+        static auto initial = pack<xWord>(H::get);
+        const auto xmidstate = pack<xWord>(midstate);
+        std_array<xWord, SHA::block_words> xmessage;
+        xbuffer_t<xWord> xbuffer;
+
+        // Message words other than the counter are common to all lanes.
+        for (size_t word = 0; word < SHA::block_words; ++word)
+            xmessage[word] = broadcast<xWord>(message[word]);
+
+        do
+        {
+            // Scheduling adds K to message words, so they are restored.
+            auto xstate = xmidstate;
+            xmessage[last] = pack_counter<xWord>(counter);
+            array_cast<xWord, SHA::block_words>(xbuffer) = xmessage;
+            schedule(xbuffer);
+            compress(xstate, xbuffer);
+
+            // Second hash
+            input(xbuffer, xstate);
+            pad_half(xbuffer);
+            schedule(xbuffer);
+            xstate = initial;
+            compress(xstate, xbuffer);
+
+            // output() advances digest iterator by lanes.
+            output(digests, xstate);
+            counter += possible_narrow_cast<word_t>(lanes);
+        }
+        while (digests.size() >= lanes);
+    }
+}
+
+TEMPLATE
+INLINE size_t CLASS::
+midstate_hash_v(digests_t& digests, const state_t& midstate,
+    const buffer_t& message) NOEXCEPT
+{
+    constexpr auto last = sub1(to_half(SHA::chunk_words));
+
+    if (digests.empty() || digests.size() < min_lanes)
+        return zero;
+
+    const auto count = digests.size();
+    const auto size = count * array_count<digest_t>;
+    auto idigests = idigests_t{ size, digests.front().data() };
+    auto counter = byteswap(message[last]);
+
+    // Midstate hash vector dispatch.
+    if constexpr (have_x512)
+        midstate_hash_v_<xint512_t>(idigests, midstate, message, counter);
+    if constexpr (have_x256)
+        midstate_hash_v_<xint256_t>(idigests, midstate, message, counter);
+    if constexpr (have_x128)
+        midstate_hash_v_<xint128_t>(idigests, midstate, message, counter);
+
+    // idigests.size() is reduced by vectorization.
+    return count - idigests.size();
+}
+
 // Message Schedule (block vectorization).
 // ----------------------------------------------------------------------------
 // eprint.iacr.org/2012/067.pdf
@@ -0,0 +1,586 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_IPP
+#define LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_IPP
+
+#include <compare>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/bits.hpp>
+#include <bitcoin/system/math/bytes.hpp>
+#include <bitcoin/system/math/cast.hpp>
+#include <bitcoin/system/math/division.hpp>
+
+#if defined(HAVE_MSC) && defined(HAVE_X64)
+    #include <intrin.h>
+#endif
+
+namespace libbitcoin {
+namespace system {
+
+// Limb primitives.
+// ----------------------------------------------------------------------------
+
+constexpr uint64_t fixed_uint256::add_carry(uint64_t left, uint64_t right,
+    bool& carry) NOEXCEPT
+{
+#if defined(HAVE_INT128)
+    const auto sum = uint128_native_t{ left } + right + to_int(carry);
+    carry = to_bool(sum >> bits<uint64_t>);
+    return static_cast<uint64_t>(sum);
+#else
+    #if defined(HAVE_MSC) && defined(HAVE_X64)
+    if (!std::is_constant_evaluated())
+    {
+        unsigned long long sum{};
+        carry = to_bool(_addcarry_u64(to_int<uint8_t>(carry), left, right,
+            &sum));
+        return sum;
+    }
+    #endif
+    const auto sum = left + right;
+    const auto out = sum + to_int<uint64_t>(carry);
+    carry = (sum < left) || (out < sum);
+    return out;
+#endif
+}
+
+constexpr uint64_t fixed_uint256::subtract_borrow(uint64_t left,
+    uint64_t right, bool& borrow) NOEXCEPT
+{
+#if defined(HAVE_MSC) && defined(HAVE_X64)
+    if (!std::is_constant_evaluated())
+    {
+        unsigned long long difference{};
+        borrow = to_bool(_subborrow_u64(to_int<uint8_t>(borrow), left, right,
+            &difference));
+        return difference;
+    }
+#endif
+    const auto difference = left - right;
+    const auto out = difference - to_int<uint64_t>(borrow);
+    borrow = (left < right) || (difference < to_int<uint64_t>(borrow));
+    return out;
+}
+
+constexpr uint64_t fixed_uint256::multiply(uint64_t left, uint64_t right,
+    uint64_t& high) NOEXCEPT
+{
+#if defined(HAVE_INT128)
+    const auto product = uint128_native_t{ left } * right;
+    high = static_cast<uint64_t>(product >> bits<uint64_t>);
+    return static_cast<uint64_t>(product);
+#else
+    #if defined(HAVE_MSC) && defined(HAVE_X64)
+    if (!std::is_constant_evaluated())
+    {
+        unsigned long long upper{};
+        const auto lower = _umul128(left, right, &upper);
+        high = upper;
+        return lower;
+    }
+    #endif
+    constexpr auto half = bits<uint32_t>;
+    constexpr auto mask = max_uint32;
+    const auto left_low = left & mask;
+    const auto left_high = left >> half;
+    const auto right_low = right & mask;
+    const auto right_high = right >> half;
+
+    const auto low_low = left_low * right_low;
+    const auto high_low = left_high * right_low;
+    const auto low_high = left_low * right_high;
+    const auto high_high = left_high * right_high;
+    const auto cross = (low_low >> half) + (high_low & mask) + low_high;
+
+    high = high_high + (high_low >> half) + (cross >> half);
+    return (cross << half) | (low_low & mask);
+#endif
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+constexpr fixed_uint256::fixed_uint256() NOEXCEPT
+  : limbs_{}
+{
+}
+
+constexpr fixed_uint256::fixed_uint256(uint64_t value) NOEXCEPT
+  : limbs_{ value, 0, 0, 0 }
+{
+}
+
+constexpr fixed_uint256::fixed_uint256(const limbs_type& limbs) NOEXCEPT
+  : limbs_{ limbs }
+{
+}
+
+inline fixed_uint256::fixed_uint256(const uint256_t& value) NOEXCEPT
+  : limbs_{}
+{
+    auto copy = value;
+    for (auto& limb: limbs_)
+    {
+        limb = static_cast<uint64_t>(copy & max_uint64);
+        copy >>= bits<uint64_t>;
+    }
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+constexpr const fixed_uint256::limbs_type&
+fixed_uint256::limbs() const NOEXCEPT
+{
+    return limbs_;
+}
+
+constexpr size_t fixed_uint256::bit_width() const NOEXCEPT
+{
+    for (auto index = count; index > 0; --index)
+        if (!is_zero(limbs_[sub1(index)]))
+            return sub1(index) * bits<uint64_t> +
+                system::bit_width(limbs_[sub1(index)]);
+
+    return zero;
+}
+
+constexpr size_t fixed_uint256::byte_width() const NOEXCEPT
+{
+    return to_ceilinged_bytes(bit_width());
+}
+
+inline uint256_t fixed_uint256::to_uintx() const NOEXCEPT
+{
+    uint256_t out{};
+    for (auto limb = limbs_.rbegin(); limb != limbs_.rend(); ++limb)
+    {
+        out <<= bits<uint64_t>;
+        out |= *limb;
+    }
+
+    return out;
+}
+
+// Arithmetic.
+// ----------------------------------------------------------------------------
+
+constexpr fixed_uint256&
+fixed_uint256::operator+=(const fixed_uint256& other) NOEXCEPT
+{
+    auto carry = false;
+    limbs_[0] = add_carry(limbs_[0], other.limbs_[0], carry);
+    limbs_[1] = add_carry(limbs_[1], other.limbs_[1], carry);
+    limbs_[2] = add_carry(limbs_[2], other.limbs_[2], carry);
+    limbs_[3] = add_carry(limbs_[3], other.limbs_[3], carry);
+    return *this;
+}
+
+constexpr fixed_uint256&
+fixed_uint256::operator-=(const fixed_uint256& other) NOEXCEPT
+{
+    auto borrow = false;
+    limbs_[0] = subtract_borrow(limbs_[0], other.limbs_[0], borrow);
+    limbs_[1] = subtract_borrow(limbs_[1], other.limbs_[1], borrow);
+    limbs_[2] = subtract_borrow(limbs_[2], other.limbs_[2], borrow);
+    limbs_[3] = subtract_borrow(limbs_[3], other.limbs_[3], borrow);
+    return *this;
+}
+
+// Schoolbook, truncated to the low four limbs.
+constexpr fixed_uint256&
+fixed_uint256::operator*=(const fixed_uint256& other) NOEXCEPT
+{
+    limbs_type out{};
+    for (size_t row = 0; row < count; ++row)
+    {
+        uint64_t carry{};
+        for (size_t column = 0; row + column < count; ++column)
+        {
+            uint64_t high{};
+            auto low = multiply(limbs_[row], other.limbs_[column], high);
+
+            auto overflow = false;
+            low = add_carry(low, carry, overflow);
+            high += to_int<uint64_t>(overflow);
+
+            overflow = false;
+            out[row + column] = add_carry(out[row + column], low, overflow);
+            carry = high + to_int<uint64_t>(overflow);
+        }
+    }
+
+    limbs_ = out;
+    return *this;
+}
+
+constexpr fixed_uint256&
+fixed_uint256::operator*=(uint64_t multiplier) NOEXCEPT
+{
+    uint64_t carry{};
+    for (auto& limb: limbs_)
+    {
+        uint64_t high{};
+        auto overflow = false;
+        limb = add_carry(multiply(limb, multiplier, high), carry, overflow);
+        carry = high + to_int<uint64_t>(overflow);
+    }
+
+    return *this;
+}
+
+constexpr fixed_uint256&
+fixed_uint256::operator/=(const fixed_uint256& other) NOEXCEPT
+{
+    *this = long_divide(*this, other);
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator++() NOEXCEPT
+{
+    return *this += fixed_uint256{ one };
+}
+
+constexpr fixed_uint256& fixed_uint256::operator--() NOEXCEPT
+{
+    return *this -= fixed_uint256{ one };
+}
+
+// Each limb is divided as two 32 bit halves, so no wide division is required.
+constexpr uint32_t fixed_uint256::divide(uint32_t divisor) NOEXCEPT
+{
+    BC_ASSERT_MSG(!is_zero(divisor), "division by zero");
+    if (is_zero(divisor))
+    {
+        limbs_ = {};
+        return {};
+    }
+
+    constexpr auto half = bits<uint32_t>;
+    uint64_t remainder{};
+    for (auto limb = limbs_.rbegin(); limb != limbs_.rend(); ++limb)
+    {
+        const auto upper = (remainder << half) | (*limb >> half);
+        const auto upper_quotient = upper / divisor;
+        remainder = upper % divisor;
+
+        const auto lower = (remainder << half) | (*limb & max_uint32);
+        const auto lower_quotient = lower / divisor;
+        remainder = lower % divisor;
+
+        *limb = (upper_quotient << half) | lower_quotient;
+    }
+
+    return narrow_cast<uint32_t>(remainder);
+}
+
+constexpr fixed_uint256 fixed_uint256::long_divide(const fixed_uint256& left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    BC_ASSERT_MSG(!is_zero(right), "division by zero");
+    if (is_zero(right) || left < right)
+        return {};
+
+    // Single 32 bit digit divisor.
+    if (right.bit_width() <= bits<uint32_t>)
+    {
+        auto quotient = left;
+        quotient.divide(narrow_cast<uint32_t>(right.limbs_[0]));
+        return quotient;
+    }
+
+#if defined(HAVE_INT128)
+    return knuth_divide<uint64_t, uint128_native_t>(left, right);
+#else
+    return knuth_divide<uint32_t, uint64_t>(left, right);
+#endif
+}
+
+// Two digit by one digit division, native divq when the quotient fits.
+template <typename Digit, typename Wide>
+constexpr void fixed_uint256::estimate_digit(Wide& quotient, Wide& remainder,
+    Digit high, Digit low, Digit divisor) NOEXCEPT
+{
+#if defined(HAVE_XASSEMBLY) && defined(HAVE_X64)
+    if constexpr (is_same_type<Digit, uint64_t>)
+    {
+        if (!std::is_constant_evaluated() && high < divisor)
+        {
+            uint64_t lower{};
+            uint64_t upper{};
+            __asm__("divq %4"
+                : "=a"(lower), "=d"(upper)
+                : "a"(low), "d"(high), "rm"(divisor));
+            quotient = lower;
+            remainder = upper;
+            return;
+        }
+    }
+#endif
+
+    const auto value = (Wide{ high } << bits<Digit>) | low;
+    quotient = value / divisor;
+    remainder = value % divisor;
+}
+
+// Knuth algorithm D (TAOCP 4.3.1), with the divisor normalized by shift so
+// that at most two corrections of each estimated quotient digit are required.
+// Requires left >= right.
+template <typename Digit, typename Wide>
+constexpr fixed_uint256 fixed_uint256::knuth_divide(const fixed_uint256& left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    constexpr size_t width = bits<Digit>;
+    constexpr size_t per_limb = bits<uint64_t> / width;
+    constexpr size_t digits = count * per_limb;
+    constexpr auto maximum = std::numeric_limits<Digit>::max();
+    using digits_type = std_array<Digit, add1(digits)>;
+
+    const auto n = ceilinged_divide(right.bit_width(), width);
+
+    // Single digit divisor (short division).
+    if (is_one(n))
+    {
+        const auto divisor = static_cast<Digit>(right.limbs_[0]);
+        fixed_uint256 quotient{};
+        Wide estimate{};
+        Wide remainder{};
+
+        for (auto index = digits; index > 0; --index)
+        {
+            const auto at = sub1(index);
+            const auto offset = width * (at % per_limb);
+            estimate_digit(estimate, remainder, static_cast<Digit>(remainder),
+                static_cast<Digit>(left.limbs_[at / per_limb] >> offset),
+                divisor);
+            quotient.limbs_[at / per_limb] |=
+                static_cast<uint64_t>(estimate) << offset;
+        }
+
+        return quotient;
+    }
+
+    // n divisor digits (n > 1), m + n dividend digits, shift normalizes.
+    const auto m = ceilinged_divide(left.bit_width(), width) - n;
+    const auto shift = width * n - right.bit_width();
+    const auto divisor = right << shift;
+    const auto dividend = left << shift;
+
+    digits_type v{};
+    digits_type u{};
+    for (size_t index = 0; index < digits; ++index)
+    {
+        const auto offset = width * (index % per_limb);
+        v[index] = static_cast<Digit>(divisor.limbs_[index / per_limb] >>
+            offset);
+        u[index] = static_cast<Digit>(dividend.limbs_[index / per_limb] >>
+            offset);
+    }
+
+    // Dividend bits shifted out by normalization.
+    if (!is_zero(shift))
+        u[digits] = static_cast<Digit>(left.limbs_[sub1(count)] >>
+            (bits<uint64_t> - shift));
+
+    fixed_uint256 quotient{};
+    for (auto j = add1(m); j > 0; --j)
+    {
+        const auto at = sub1(j);
+
+        // Estimate quotient digit from the high two digits, then correct.
+        Wide estimate{};
+        Wide remainder{};
+        estimate_digit(estimate, remainder, u[at + n], u[at + n - 1],
+            v[n - 1]);
+
+        while (estimate > maximum || estimate * v[n - 2] >
+            ((remainder << width) | u[at + n - 2]))
+        {
+            --estimate;
+            remainder += v[n - 1];
+            if (remainder > maximum)
+                break;
+        }
+
+        // Multiply and subtract.
+        Wide carry{};
+        auto borrow = false;
+        for (size_t index = 0; index < n; ++index)
+        {
+            const auto product = estimate * v[index] + carry;
+            const auto low = static_cast<Digit>(product);
+            const auto digit = u[index + at];
+            u[index + at] = digit - low - to_int<Digit>(borrow);
+            borrow = (digit < low) || (digit - low < to_int<Digit>(borrow));
+            carry = product >> width;
+        }
+
+        const auto top = Wide{ u[at + n] };
+        const auto subtrahend = carry + to_int<Digit>(borrow);
+        u[at + n] = static_cast<Digit>(top - subtrahend);
+
+        // Add back if the estimate was one too large (rare).
+        if (top < subtrahend)
+        {
+            --estimate;
+            Wide sum{};
+            for (size_t index = 0; index < n; ++index)
+            {
+                sum = Wide{ u[index + at] } + v[index] + (sum >> width);
+                u[index + at] = static_cast<Digit>(sum);
+            }
+
+            u[at + n] += static_cast<Digit>(sum >> width);
+        }
+
+        quotient.limbs_[at / per_limb] |= static_cast<uint64_t>(estimate) <<
+            (width * (at % per_limb));
+    }
+
+    return quotient;
+}
+
+// Bitwise.
+// ----------------------------------------------------------------------------
+
+constexpr fixed_uint256& fixed_uint256::operator<<=(size_t shift) NOEXCEPT
+{
+    if (shift >= bits<uint64_t> * count)
+    {
+        limbs_ = {};
+        return *this;
+    }
+
+    const auto limbs = shift / bits<uint64_t>;
+    const auto offset = shift % bits<uint64_t>;
+
+    for (auto index = count; index > 0; --index)
+    {
+        const auto to = sub1(index);
+        if (to < limbs)
+        {
+            limbs_[to] = 0;
+            continue;
+        }
+
+        const auto from = to - limbs;
+        limbs_[to] = limbs_[from] << offset;
+        if (!is_zero(offset) && !is_zero(from))
+            limbs_[to] |= limbs_[sub1(from)] >> (bits<uint64_t> - offset);
+    }
+
+    return *this;
+}
+
+constexpr fixed_uint256& fixed_uint256::operator>>=(size_t shift) NOEXCEPT
+{
+    if (shift >= bits<uint64_t> * count)
+    {
+        limbs_ = {};
+        return *this;
+    }
+
+    const auto limbs = shift / bits<uint64_t>;
+    const auto offset = shift % bits<uint64_t>;
+
+    for (size_t to = 0; to < count; ++to)
+    {
+        const auto from = to + limbs;
+        if (from >= count)
+        {
+            limbs_[to] = 0;
+            continue;
+        }
+
+        limbs_[to] = limbs_[from] >> offset;
+        if (!is_zero(offset) && add1(from) < count)
+            limbs_[to] |= limbs_[add1(from)] << (bits<uint64_t> - offset);
+    }
+
+    return *this;
+}
+
+constexpr fixed_uint256 fixed_uint256::operator~() const NOEXCEPT
+{
+    return fixed_uint256
+    {
+        limbs_type{ ~limbs_[0], ~limbs_[1], ~limbs_[2], ~limbs_[3] }
+    };
+}
+
+// Comparison.
+// ----------------------------------------------------------------------------
+
+constexpr std::strong_ordering
+fixed_uint256::operator<=>(const fixed_uint256& other) const NOEXCEPT
+{
+    for (auto index = count; index > 0; --index)
+        if (limbs_[sub1(index)] != other.limbs_[sub1(index)])
+            return limbs_[sub1(index)] <=> other.limbs_[sub1(index)];
+
+    return std::strong_ordering::equal;
+}
+
+// Free operators.
+// ----------------------------------------------------------------------------
+
+constexpr fixed_uint256 operator+(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left += right;
+}
+
+constexpr fixed_uint256 operator-(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left -= right;
+}
+
+constexpr fixed_uint256 operator*(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left *= right;
+}
+
+constexpr fixed_uint256 operator*(fixed_uint256 left,
+    uint64_t right) NOEXCEPT
+{
+    return left *= right;
+}
+
+constexpr fixed_uint256 operator/(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT
+{
+    return left /= right;
+}
+
+constexpr fixed_uint256 operator<<(fixed_uint256 left, size_t shift) NOEXCEPT
+{
+    return left <<= shift;
+}
+
+constexpr fixed_uint256 operator>>(fixed_uint256 left, size_t shift) NOEXCEPT
+{
+    return left >>= shift;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
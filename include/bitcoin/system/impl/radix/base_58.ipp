@@ -20,20 +20,252 @@
 #define LIBBITCOIN_SYSTEM_RADIX_BASE_58_IPP
 
 #include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+// base58
+// Base 58 is an ascii data encoding with a domain of 58 symbols (characters).
+// 58 is not a power of 2 so base58 is not a bit mapping. Conversion is a
+// change of number base, which is quadratic in the length of the number.
+// The number is held in 32 bit limbs (with 64 bit carry arithmetic), of base
+// 58^5 (the largest power of 58 in 32 bits) for digits and of base 2^32 for
+// bytes. So each carry step converts five digits or four bytes, as opposed
+// to one digit or byte. Fixed size data uses fixed size limb buffers.
 
 namespace libbitcoin {
 namespace system {
 
+// Codec helpers, not published.
+namespace detail {
+
+constexpr auto base58_limb_digits = 5_size;
+constexpr auto base58_limb_bytes = sizeof(uint32_t);
+constexpr auto base58_limb = 656356768_u64;
+constexpr auto base58_invalid = 0xff_u8;
+constexpr std::string_view base58_characters
+{
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz"
+};
+
+constexpr std::array<uint8_t, 256> base58_values = []() NOEXCEPT
+{
+    std::array<uint8_t, 256> values{};
+    values.fill(base58_invalid);
+    for (size_t value = 0; value < base58_characters.size(); ++value)
+        values.at(static_cast<uint8_t>(base58_characters.at(value))) =
+            narrow_cast<uint8_t>(value);
+
+    return values;
+}();
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Maximal number of digits for a number of bytes: log(256)/log(58) = 1.366.
+constexpr size_t base58_encoded_size(size_t bytes) NOEXCEPT
+{
+    return add1(bytes * 137_size / 100_size);
+}
+
+// Maximal number of bytes for a number of digits: log(58)/log(256) = 0.733.
+constexpr size_t base58_decoded_size(size_t digits) NOEXCEPT
+{
+    return add1(digits * 733_size / 1000_size);
+}
+
+// Bytes to base 58^5 limbs (little-endian), returns the number of limbs.
+// Bytes are read as big-endian 32 bit words, with a partial leading word.
+template <typename Limbs, typename Iterator>
+constexpr size_t base58_pack(Limbs& limbs, Iterator it,
+    const Iterator& end) NOEXCEPT
+{
+    size_t used = zero;
+    const auto size = possible_narrow_sign_cast<size_t>(std::distance(it, end));
+    auto count = size % base58_limb_bytes;
+    if (is_zero(count))
+        count = base58_limb_bytes;
+
+    while (it != end)
+    {
+        uint64_t carry = zero;
+        for (size_t byte = 0; byte < count; ++byte)
+            carry = (carry << byte_bits) | *it++;
+
+        const auto scale = power2<uint64_t>(count * byte_bits);
+        for (size_t limb = 0; limb < used; ++limb)
+        {
+            carry += scale * limbs[limb];
+            limbs[limb] = narrow_cast<uint32_t>(carry % base58_limb);
+            carry /= base58_limb;
+        }
+
+        while (!is_zero(carry))
+        {
+            limbs[used++] = narrow_cast<uint32_t>(carry % base58_limb);
+            carry /= base58_limb;
+        }
+
+        count = base58_limb_bytes;
+    }
+
+    return used;
+}
+
+// Digits to base 2^32 limbs (little-endian), returns false if a digit is not
+// base58 or the number overflows limbs. Digits are read in groups of five,
+// with a partial leading group.
+template <typename Limbs>
+constexpr bool base58_unpack(Limbs& limbs, size_t& used,
+    const std::string_view& digits) NOEXCEPT
+{
+    used = zero;
+    auto it = digits.begin();
+    auto count = digits.size() % base58_limb_digits;
+    if (is_zero(count))
+        count = base58_limb_digits;
+
+    while (it != digits.end())
+    {
+        uint64_t carry = zero;
+        uint64_t scale = one;
+        for (size_t digit = 0; digit < count; ++digit)
+        {
+            const auto value = base58_values[static_cast<uint8_t>(*it++)];
+            if (value == base58_invalid)
+                return false;
+
+            carry = carry * base58_characters.size() + value;
+            scale *= base58_characters.size();
+        }
+
+        for (size_t limb = 0; limb < used; ++limb)
+        {
+            carry += scale * limbs[limb];
+            limbs[limb] = narrow_cast<uint32_t>(carry);
+            carry >>= bits<uint32_t>;
+        }
+
+        while (!is_zero(carry))
+        {
+            if (used == limbs.size())
+                return false;
+
+            limbs[used++] = narrow_cast<uint32_t>(carry);
+            carry >>= bits<uint32_t>;
+        }
+
+        count = base58_limb_digits;
+    }
+
+    return true;
+}
+
+// Base 58^5 limbs to digits, after a '1' for each leading zero byte.
+template <typename Limbs>
+SCONSTEXPR std::string base58_encode(const Limbs& limbs, size_t used,
+    size_t leading_zeros) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::string out(leading_zeros + used * base58_limb_digits,
+        base58_characters.front());
+    BC_POP_WARNING()
+
+    // Limbs are written from the end, all but the last are five digits.
+    auto digit = out.rbegin();
+    for (size_t limb = 0; limb < used; ++limb)
+    {
+        auto value = limbs[limb];
+        const auto last = (add1(limb) == used);
+        for (size_t count = 0; count < base58_limb_digits; ++count)
+        {
+            if (last && is_zero(value))
+                break;
+
+            *digit++ = base58_characters[value % base58_characters.size()];
+            value /= base58_characters.size();
+        }
+    }
+
+    // Unwritten digits of the most significant limb are removed.
+    const auto written = possible_narrow_sign_cast<size_t>(
+        std::distance(out.rbegin(), digit));
+    out.erase(leading_zeros, used * base58_limb_digits - written);
+    return out;
+}
+
+// The number of bytes in the value of base 2^32 limbs.
+template <typename Limbs>
+constexpr size_t base58_width(const Limbs& limbs, size_t used) NOEXCEPT
+{
+    if (is_zero(used))
+        return zero;
+
+    const auto top = limbs[sub1(used)];
+    const auto top_bytes = ceilinged_divide(bit_width(top), byte_bits);
+    return sub1(used) * base58_limb_bytes + top_bytes;
+}
+
+// Writes the value of base 2^32 limbs before end (big-endian).
+template <typename Limbs, typename Iterator>
+constexpr void base58_write(Iterator end, const Limbs& limbs,
+    size_t bytes) NOEXCEPT
+{
+    for (size_t byte = 0; byte < bytes; ++byte)
+        *--end = narrow_cast<uint8_t>(limbs[byte / base58_limb_bytes] >>
+            ((byte % base58_limb_bytes) * byte_bits));
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace detail
+
+// published
+// ============================================================================
+
 template <size_t Size>
-bool decode_base58(data_array<Size>& out, const std::string& in) NOEXCEPT
+SCONSTEXPR std::string encode_base58(const data_array<Size>& unencoded) NOEXCEPT
 {
-    data_chunk data;
-    if (!decode_base58(data, in) || (data.size() != Size))
+    const auto first = std::find_if(unencoded.begin(), unencoded.end(),
+        [](uint8_t byte) NOEXCEPT { return !is_zero(byte); });
+
+    constexpr auto limbs = ceilinged_divide(detail::base58_encoded_size(Size),
+        detail::base58_limb_digits);
+
+    std::array<uint32_t, limbs> packed{};
+    const auto used = detail::base58_pack(packed, first, unencoded.end());
+    return detail::base58_encode(packed, used,
+        possible_narrow_sign_cast<size_t>(first - unencoded.begin()));
+}
+
+template <size_t Size>
+SCONSTEXPR bool decode_base58(data_array<Size>& out,
+    const std::string& in) NOEXCEPT
+{
+    const auto leading_zeros = std::min(in.find_first_not_of(
+        detail::base58_characters.front()), in.size());
+    if (leading_zeros > Size)
+        return false;
+
+    constexpr auto limbs = add1(ceilinged_divide(Size,
+        detail::base58_limb_bytes));
+    std::array<uint32_t, limbs> unpacked{};
+    size_t used{};
+    if (!detail::base58_unpack(unpacked, used, std::string_view{ in }.substr(
+        leading_zeros)))
+        return false;
+
+    // The decoded size must be exact (as zeros are not implied).
+    const auto bytes = detail::base58_width(unpacked, used);
+    if (leading_zeros + bytes != Size)
         return false;
 
-    std::copy(data.begin(), data.end(), out.begin());
+    std::fill_n(out.begin(), leading_zeros, 0x00_u8);
+    detail::base58_write(out.end(), unpacked, bytes);
     return true;
 }
 
@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_GATHER_WRITER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_GATHER_WRITER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/streamers/byte_reader.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// constructors
+// ----------------------------------------------------------------------------
+
+gather_writer::gather_writer(size_t reference) NOEXCEPT
+  : reference_(reference),
+    position_(zero),
+    owned_(false),
+    segments_(),
+    slices_()
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, if_integer<Integer>>
+void gather_writer::write_big_endian(Integer value) NOEXCEPT
+{
+    const auto& bytes = byte_cast(native_to_big_end(value));
+    do_copy_bytes(bytes.data(), bytes.size());
+}
+
+void gather_writer::write_2_bytes_big_endian(uint16_t value) NOEXCEPT
+{
+    write_big_endian<uint16_t>(value);
+}
+
+void gather_writer::write_4_bytes_big_endian(uint32_t value) NOEXCEPT
+{
+    write_big_endian<uint32_t>(value);
+}
+
+void gather_writer::write_8_bytes_big_endian(uint64_t value) NOEXCEPT
+{
+    write_big_endian<uint64_t>(value);
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, if_integer<Integer>>
+void gather_writer::write_little_endian(Integer value) NOEXCEPT
+{
+    const auto& bytes = byte_cast(native_to_little_end(value));
+    do_copy_bytes(bytes.data(), bytes.size());
+}
+
+void gather_writer::write_2_bytes_little_endian(uint16_t value) NOEXCEPT
+{
+    write_little_endian<uint16_t>(value);
+}
+
+void gather_writer::write_4_bytes_little_endian(uint32_t value) NOEXCEPT
+{
+    write_little_endian<uint32_t>(value);
+}
+
+void gather_writer::write_8_bytes_little_endian(uint64_t value) NOEXCEPT
+{
+    write_little_endian<uint64_t>(value);
+}
+
+// Normal consensus form.
+// There is exactly one representation for any number in the domain.
+void gather_writer::write_variable(uint64_t value) NOEXCEPT
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(narrow_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_little_endian(narrow_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_little_endian(narrow_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_little_endian(value);
+    }
+}
+
+// Normal client-server form.
+void gather_writer::write_error_code(const code& ec) NOEXCEPT
+{
+    write_4_bytes_little_endian(sign_cast<uint32_t>(ec.value()));
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+std::istream& gather_writer::write(std::istream& in) NOEXCEPT
+{
+    // The read buffer is temporary, so it is copied.
+    const auto data = byte_reader<std::istream>(in).read_bytes();
+    do_copy_bytes(data.data(), data.size());
+    return in;
+}
+
+void gather_writer::write_byte(uint8_t value) NOEXCEPT
+{
+    do_copy_bytes(&value, one);
+}
+
+void gather_writer::write_bytes(const data_slice& data) NOEXCEPT
+{
+    write_bytes(data.data(), data.size());
+}
+
+void gather_writer::write_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    if (size < reference_)
+    {
+        do_copy_bytes(data, size);
+        return;
+    }
+
+    append(data, size, false);
+}
+
+// strings
+// ----------------------------------------------------------------------------
+// Normal p2p form (consensus hash no strings).
+
+void gather_writer::write_string(const std::string& value) NOEXCEPT
+{
+    write_variable(value.size());
+    write_string_buffer(value, value.size());
+}
+
+void gather_writer::write_string_buffer(const std::string& value,
+    size_t size) NOEXCEPT
+{
+    const auto length = std::min(size, value.size());
+
+    // The string may be temporary, so it is copied.
+    do_copy_bytes(data_slice(value).data(), length);
+
+    // Pad to length with zeros, required for Bitcoin heading serialization.
+    do_fill_bytes(size - length);
+}
+
+// context
+// ----------------------------------------------------------------------------
+
+void gather_writer::flush() NOEXCEPT
+{
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+size_t gather_writer::get_position() NOEXCEPT
+{
+    return position_;
+}
+
+gather_writer::operator bool() const NOEXCEPT
+{
+    return true;
+}
+
+bool gather_writer::operator!() const NOEXCEPT
+{
+    return false;
+}
+
+// slices
+// ----------------------------------------------------------------------------
+
+const std::vector<data_slice>& gather_writer::slices() const NOEXCEPT
+{
+    return slices_;
+}
+
+data_chunk gather_writer::to_chunk() const NOEXCEPT
+{
+    data_chunk out(position_);
+    auto it = out.begin();
+    for (const auto& slice: slices_)
+        it = std::copy(slice.begin(), slice.end(), it);
+
+    return out;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Segments are never reallocated (capacity is reserved), so owned slices
+// remain valid as segments are added (vector move preserves the buffers).
+data_chunk& gather_writer::allocate(size_t size) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (segments_.empty() ||
+        segments_.back().capacity() - segments_.back().size() < size)
+    {
+        owned_ = false;
+        segments_.emplace_back();
+        segments_.back().reserve(std::max(size, segment));
+    }
+    BC_POP_WARNING()
+
+    return segments_.back();
+}
+
+void gather_writer::do_copy_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    if (is_zero(size))
+        return;
+
+    auto& buffer = allocate(size);
+    const auto offset = buffer.size();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    buffer.insert(buffer.end(), data, std::next(data, size));
+    BC_POP_WARNING()
+
+    append(std::next(buffer.data(), offset), size, true);
+}
+
+void gather_writer::do_fill_bytes(size_t size) NOEXCEPT
+{
+    if (is_zero(size))
+        return;
+
+    auto& buffer = allocate(size);
+    const auto offset = buffer.size();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    buffer.resize(offset + size, pad());
+    BC_POP_WARNING()
+
+    append(std::next(buffer.data(), offset), size, true);
+}
+
+void gather_writer::append(const uint8_t* begin, size_t size,
+    bool owned) NOEXCEPT
+{
+    if (is_zero(size))
+        return;
+
+    const auto end = std::next(begin, size);
+    position_ += size;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+    // Coalesce adjacent owned bytes (same segment) into the last slice.
+    if (owned && owned_ && slices_.back().end() == begin)
+        slices_.back() = { slices_.back().begin(), end };
+    else
+        slices_.emplace_back(begin, end);
+
+    BC_POP_WARNING()
+    owned_ = owned;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
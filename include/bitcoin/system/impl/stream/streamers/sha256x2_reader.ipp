@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SHA256X2_READER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SHA256X2_READER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/streamers/byte_reader.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// constructors
+// ----------------------------------------------------------------------------
+
+template <typename IStream>
+sha256x2_reader<IStream>::sha256x2_reader(IStream& source) NOEXCEPT
+  : byte_reader<IStream>(source)
+{
+}
+
+// hashes
+// ----------------------------------------------------------------------------
+
+template <typename IStream>
+void sha256x2_reader<IStream>::reset_hashes() NOEXCEPT
+{
+    witness_ = false;
+    consumed_ = zero;
+    hashed_ = zero;
+    nominal_.reset();
+    witnessed_.reset();
+}
+
+template <typename IStream>
+void sha256x2_reader<IStream>::set_witness(bool witness) NOEXCEPT
+{
+    witness_ = witness;
+}
+
+template <typename IStream>
+hash_digest sha256x2_reader<IStream>::nominal_hash() const NOEXCEPT
+{
+    // Finalize a copy so that hashing may continue.
+    auto context = nominal_;
+    return context.double_flush();
+}
+
+template <typename IStream>
+hash_digest sha256x2_reader<IStream>::witness_hash() const NOEXCEPT
+{
+    // Finalize a copy so that hashing may continue.
+    auto context = witnessed_;
+    return context.double_flush();
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+template <typename IStream>
+void sha256x2_reader<IStream>::do_read_bytes(uint8_t* buffer,
+    size_t size) NOEXCEPT
+{
+    byte_reader<IStream>::do_read_bytes(buffer, size);
+
+    // Limited and failed reads are not hashed (the reader is invalid).
+    if (!*this)
+        return;
+
+    // Bytes re-read after a rewind (below the high-water mark) were hashed.
+    const auto end = consumed_ + size;
+    if (end > hashed_)
+    {
+        const auto hashed = hashed_ - consumed_;
+        hasher(std::next(buffer, hashed), size - hashed);
+        hashed_ = end;
+    }
+
+    consumed_ = end;
+}
+
+template <typename IStream>
+void sha256x2_reader<IStream>::do_skip_bytes(size_t size) NOEXCEPT
+{
+    // Bytes below the high-water mark are already hashed, so seek over them.
+    const auto hashed = std::min(size, hashed_ - consumed_);
+    if (!is_zero(hashed))
+    {
+        byte_reader<IStream>::do_skip_bytes(hashed);
+        if (!*this)
+            return;
+
+        consumed_ += hashed;
+        size -= hashed;
+    }
+
+    // Unhashed skipped bytes must be hashed, so they are read via a buffer.
+    constexpr size_t chunk = 256;
+
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    data_array<chunk> buffer;
+    BC_POP_WARNING()
+
+    while (!is_zero(size) && *this)
+    {
+        const auto bytes = std::min(size, chunk);
+        do_read_bytes(buffer.data(), bytes);
+        size -= bytes;
+    }
+}
+
+template <typename IStream>
+void sha256x2_reader<IStream>::do_rewind_bytes(size_t size) NOEXCEPT
+{
+    // Bytes before the hash reset cannot be re-read without being hashed.
+    if (size > consumed_)
+    {
+        byte_reader<IStream>::invalidate();
+        return;
+    }
+
+    // Rewound bytes remain hashed and are not hashed again when re-read.
+    byte_reader<IStream>::do_rewind_bytes(size);
+    consumed_ -= size;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Only hash overflow returns write false, which requires (2^64-8)/8 bytes.
+template <typename IStream>
+void sha256x2_reader<IStream>::hasher(const uint8_t* data,
+    size_t size) NOEXCEPT
+{
+    witnessed_.write(size, data);
+
+    if (!witness_)
+        nominal_.write(size, data);
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
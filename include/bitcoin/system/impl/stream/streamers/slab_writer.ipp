@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/streamers/byte_reader.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// constructors
+// ----------------------------------------------------------------------------
+
+slab_writer::slab_writer(const data_slab& data) NOEXCEPT
+  : begin_(data.begin()),
+    position_(data.begin()),
+    end_(data.end()),
+    valid_(true)
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, if_integer<Integer>>
+void slab_writer::write_big_endian(Integer value) NOEXCEPT
+{
+    const auto& bytes = byte_cast(native_to_big_end(value));
+    do_write_bytes(bytes.data(), bytes.size());
+}
+
+void slab_writer::write_2_bytes_big_endian(uint16_t value) NOEXCEPT
+{
+    write_big_endian<uint16_t>(value);
+}
+
+void slab_writer::write_4_bytes_big_endian(uint32_t value) NOEXCEPT
+{
+    write_big_endian<uint32_t>(value);
+}
+
+void slab_writer::write_8_bytes_big_endian(uint64_t value) NOEXCEPT
+{
+    write_big_endian<uint64_t>(value);
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, if_integer<Integer>>
+void slab_writer::write_little_endian(Integer value) NOEXCEPT
+{
+    const auto& bytes = byte_cast(native_to_little_end(value));
+    do_write_bytes(bytes.data(), bytes.size());
+}
+
+void slab_writer::write_2_bytes_little_endian(uint16_t value) NOEXCEPT
+{
+    write_little_endian<uint16_t>(value);
+}
+
+void slab_writer::write_4_bytes_little_endian(uint32_t value) NOEXCEPT
+{
+    write_little_endian<uint32_t>(value);
+}
+
+void slab_writer::write_8_bytes_little_endian(uint64_t value) NOEXCEPT
+{
+    write_little_endian<uint64_t>(value);
+}
+
+// Normal consensus form.
+// There is exactly one representation for any number in the domain.
+void slab_writer::write_variable(uint64_t value) NOEXCEPT
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(narrow_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_little_endian(narrow_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_little_endian(narrow_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_little_endian(value);
+    }
+}
+
+// Normal client-server form.
+void slab_writer::write_error_code(const code& ec) NOEXCEPT
+{
+    write_4_bytes_little_endian(sign_cast<uint32_t>(ec.value()));
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+std::istream& slab_writer::write(std::istream& in) NOEXCEPT
+{
+    write_bytes(byte_reader<std::istream>(in).read_bytes());
+    return in;
+}
+
+void slab_writer::write_byte(uint8_t value) NOEXCEPT
+{
+    if (limiter(one))
+        return;
+
+    *position_ = value;
+    position_ = std::next(position_);
+}
+
+void slab_writer::write_bytes(const data_slice& data) NOEXCEPT
+{
+    do_write_bytes(data.data(), data.size());
+}
+
+void slab_writer::write_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    do_write_bytes(data, size);
+}
+
+// strings
+// ----------------------------------------------------------------------------
+// Normal p2p form (consensus hash no strings).
+
+void slab_writer::write_string(const std::string& value) NOEXCEPT
+{
+    write_variable(value.size());
+    write_string_buffer(value, value.size());
+}
+
+void slab_writer::write_string_buffer(const std::string& value,
+    size_t size) NOEXCEPT
+{
+    const auto length = std::min(size, value.size());
+
+    // Write the substring without creating a copy.
+    write_bytes(data_slice(value).data(), length);
+
+    // Pad to length with zeros, required for Bitcoin heading serialization.
+    const auto padding = size - length;
+    if (limiter(padding))
+        return;
+
+    position_ = std::fill_n(position_, padding, pad());
+}
+
+// context
+// ----------------------------------------------------------------------------
+
+void slab_writer::flush() NOEXCEPT
+{
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+size_t slab_writer::get_position() NOEXCEPT
+{
+    // Consistent with byte_writer, as tellp fails on an invalid stream.
+    return valid_ ? to_unsigned(std::distance(begin_, position_)) : zero;
+}
+
+slab_writer::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool slab_writer::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t slab_writer::remaining() const NOEXCEPT
+{
+    return to_unsigned(std::distance(position_, end_));
+}
+
+bool slab_writer::limiter(size_t size) NOEXCEPT
+{
+    // Write past end invalidates the writer, writes are not partial.
+    if (!valid_ || size > remaining())
+    {
+        valid_ = false;
+        return true;
+    }
+
+    return false;
+}
+
+void slab_writer::do_write_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    if (limiter(size))
+        return;
+
+    position_ = std::copy_n(data, size, position_);
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
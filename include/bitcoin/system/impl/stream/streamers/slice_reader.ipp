@@ -0,0 +1,394 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/streamers/byte_writer.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// constructors
+// ----------------------------------------------------------------------------
+
+slice_reader::slice_reader(const data_slice& data) NOEXCEPT
+  : begin_(data.begin()),
+    position_(data.begin()),
+    end_(data.end()),
+    limit_(data.end()),
+    valid_(true)
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, if_integer<Integer>>
+Integer slice_reader::read_big_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    do_read_bytes(bytes.data(), bytes.size());
+    return native_from_big_end(value);
+}
+
+uint16_t slice_reader::read_2_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint16_t>();
+}
+
+uint32_t slice_reader::read_4_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint32_t>();
+}
+
+uint64_t slice_reader::read_8_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint64_t>();
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, if_integer<Integer>>
+Integer slice_reader::read_little_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    do_read_bytes(bytes.data(), bytes.size());
+    return native_from_little_end(value);
+}
+
+uint16_t slice_reader::read_2_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint16_t>();
+}
+
+uint32_t slice_reader::read_4_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint32_t>();
+}
+
+uint64_t slice_reader::read_8_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t>();
+}
+
+uint64_t slice_reader::read_variable() NOEXCEPT
+{
+    const auto value = read_byte();
+
+    switch (value)
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_little_endian();
+        case varint_four_bytes:
+            return read_4_bytes_little_endian();
+        case varint_two_bytes:
+            return read_2_bytes_little_endian();
+        default:
+            return value;
+    }
+}
+
+size_t slice_reader::read_size(size_t limit) NOEXCEPT
+{
+    const auto size = read_variable();
+
+    // Return zero allows follow-on use before testing reader state.
+    if (size > limit)
+    {
+        invalidate();
+        return zero;
+    }
+
+    return possible_narrow_cast<size_t>(size);
+}
+
+code slice_reader::read_error_code() NOEXCEPT
+{
+    const auto value = read_little_endian<uint32_t>();
+    return code(static_cast<error::error_t>(value));
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+data_array<Size> slice_reader::read_forward() NOEXCEPT
+{
+    // Truncated bytes are populated with 0x00.
+    data_array<Size> out{};
+    do_read_bytes(out.data(), Size);
+    return out;
+}
+
+template <size_t Size>
+data_array<Size> slice_reader::read_reverse() NOEXCEPT
+{
+    return system::reverse(read_forward<Size>());
+}
+
+std::ostream& slice_reader::read(std::ostream& out) NOEXCEPT
+{
+    byte_writer<std::ostream>(out).write_bytes(read_bytes());
+    return out;
+}
+
+mini_hash slice_reader::read_mini_hash() NOEXCEPT
+{
+    return read_forward<mini_hash_size>();
+}
+
+short_hash slice_reader::read_short_hash() NOEXCEPT
+{
+    return read_forward<short_hash_size>();
+}
+
+hash_digest slice_reader::read_hash() NOEXCEPT
+{
+    return read_forward<hash_size>();
+}
+
+long_hash slice_reader::read_long_hash() NOEXCEPT
+{
+    return read_forward<long_hash_size>();
+}
+
+uint8_t slice_reader::peek_byte() NOEXCEPT
+{
+    // Peek past end invalidates the reader, but does not consume the limit.
+    if (!valid_ || is_zero(remaining()))
+    {
+        invalidate();
+        return pad();
+    }
+
+    return *position_;
+}
+
+uint8_t slice_reader::read_byte() NOEXCEPT
+{
+    if (limiter(one))
+        return pad();
+
+    const auto value = *position_;
+    position_ = std::next(position_);
+    return value;
+}
+
+data_chunk slice_reader::read_bytes() NOEXCEPT
+{
+    // Reads to the limit, and does not invalidate the reader.
+    if (is_exhausted())
+        return {};
+
+    data_chunk out(position_, limit_);
+    position_ = limit_;
+    return out;
+}
+
+data_chunk slice_reader::read_bytes(size_t size) NOEXCEPT
+{
+    if (is_zero(size))
+        return {};
+
+    // This allows caller read an invalid stream without allocation.
+    if (!valid_)
+        return {};
+
+    // Return size is guaranteed, truncated bytes are populated with 0x00.
+    data_chunk out(size);
+    do_read_bytes(out.data(), size);
+    return out;
+}
+
+void slice_reader::read_bytes(uint8_t* buffer, size_t size) NOEXCEPT
+{
+    do_read_bytes(buffer, size);
+}
+
+// strings
+// ----------------------------------------------------------------------------
+
+std::string slice_reader::read_string(size_t limit) NOEXCEPT
+{
+    return read_string_buffer(read_size(limit));
+}
+
+std::string slice_reader::read_string_buffer(size_t size) NOEXCEPT
+{
+    // Reads up to the limit, and does not invalidate the reader.
+    if (is_exhausted())
+        return {};
+
+    const auto end = std::next(position_, std::min(size, remaining()));
+    std::string out(position_, end);
+    position_ = end;
+
+    // Removes zero and all after, required for bitcoin string deserialization.
+    const auto position = out.find('\0');
+    out.resize(position == std::string::npos ? out.size() : position);
+    out.shrink_to_fit();
+    return out;
+}
+
+// context
+// ----------------------------------------------------------------------------
+
+void slice_reader::skip_byte() NOEXCEPT
+{
+    skip_bytes(one);
+}
+
+void slice_reader::skip_bytes(size_t size) NOEXCEPT
+{
+    if (limiter(size))
+        return;
+
+    position_ = std::next(position_, size);
+}
+
+void slice_reader::rewind_byte() NOEXCEPT
+{
+    rewind_bytes(one);
+}
+
+void slice_reader::rewind_bytes(size_t size) NOEXCEPT
+{
+    // Rewind past start invalidates the reader.
+    if (!valid_ || size > to_unsigned(std::distance(begin_, position_)))
+    {
+        invalidate();
+        return;
+    }
+
+    position_ = std::prev(position_, size);
+}
+
+bool slice_reader::is_exhausted() const NOEXCEPT
+{
+    // True if invalid or if no bytes remain within the limit.
+    return !valid_ || is_zero(remaining());
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+size_t slice_reader::get_position() NOEXCEPT
+{
+    // Consistent with byte_reader, as tellg fails on an invalid stream.
+    return valid_ ? to_unsigned(std::distance(begin_, position_)) : zero;
+}
+
+data_slice slice_reader::get_slice(size_t first, size_t last) const NOEXCEPT
+{
+    const auto size = to_unsigned(std::distance(begin_, end_));
+    if (first > last || last > size)
+        return {};
+
+    return { std::next(begin_, first), std::next(begin_, last) };
+}
+
+void slice_reader::set_position(size_t absolute) NOEXCEPT
+{
+    // Clear a presumed error state following a read overflow.
+    valid_ = true;
+
+    const auto position = get_position();
+
+    if (absolute > position)
+        skip_bytes(absolute - position);
+    else
+        rewind_bytes(position - absolute);
+}
+
+void slice_reader::set_limit(size_t size) NOEXCEPT
+{
+    const auto available = to_unsigned(std::distance(position_, end_));
+    limit_ = size < available ? std::next(position_, size) : end_;
+}
+
+void slice_reader::invalidate() NOEXCEPT
+{
+    valid_ = false;
+}
+
+slice_reader::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool slice_reader::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t slice_reader::remaining() const NOEXCEPT
+{
+    return to_unsigned(std::distance(position_, limit_));
+}
+
+bool slice_reader::limiter(size_t size) NOEXCEPT
+{
+    // Does not reset the current position or the limit.
+    if (!valid_ || size > remaining())
+    {
+        invalidate();
+        return true;
+    }
+
+    return false;
+}
+
+void slice_reader::do_read_bytes(uint8_t* buffer, size_t size) NOEXCEPT
+{
+    if (!valid_ || size > remaining())
+    {
+        // Limited reads are not partially filled or padded, but a read past
+        // the slice end is partially filled, consistent with copy_source.
+        if (valid_ && limit_ == end_)
+        {
+            std::copy(position_, end_, buffer);
+            position_ = end_;
+        }
+
+        invalidate();
+        return;
+    }
+
+    std::copy_n(position_, size, buffer);
+    position_ = std::next(position_, size);
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -24,6 +24,7 @@
 /// DELETECSTDINT
 #include <iterator>
 #include <string>
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/words/language.hpp>
@@ -102,6 +103,24 @@ dictionaries<Count, Size>::index(const string_list& words,
     return it != dictionaries_.end() ? it->index(words) : result{};
 }
 
+template<size_t Count, size_t Size>
+typename dictionaries<Count, Size>::location
+dictionaries<Count, Size>::locate(const std::string& word) const NOEXCEPT
+{
+    // The key is independent of dictionary, so is computed once for all.
+    const auto key = dictionary<Size>::table::to_key(word);
+
+    // Dictionary order is guaranteed, returns first match.
+    for (const auto& dictionary: dictionaries_)
+    {
+        const auto index = dictionary.index(word, key);
+        if (!is_negative(index))
+            return { dictionary.identifier(), index };
+    }
+
+    return { language::none, missing };
+}
+
 template<size_t Count, size_t Size>
 language dictionaries<Count, Size>::contains(const std::string& word,
     language identifier) const NOEXCEPT
@@ -113,14 +132,7 @@ language dictionaries<Count, Size>::contains(const std::string& word,
             identifier : language::none;
     }
 
-    // std::find_if returns first match, order is guaranteed.
-    const auto it = std::find_if(dictionaries_.begin(), dictionaries_.end(),
-        [&](const dictionary<Size>& dictionary) NOEXCEPT
-        {
-            return dictionary.contains(word);
-        });
-
-    return it != dictionaries_.end() ? it->identifier() : language::none;
+    return locate(word).first;
 }
 
 template<size_t Count, size_t Size>
@@ -134,14 +146,31 @@ language dictionaries<Count, Size>::contains(const string_list& words,
             identifier : language::none;
     }
 
-    // std::find_if returns first match, order is guaranteed.
-    const auto it = std::find_if(dictionaries_.begin(), dictionaries_.end(),
-        [&](const dictionary<Size>& dictionary) NOEXCEPT
+    // Each word is hashed once and probed in each remaining candidate.
+    std::array<bool, Count> candidates{};
+    candidates.fill(true);
+
+    for (const auto& word: words)
+    {
+        const auto key = dictionary<Size>::table::to_key(word);
+        auto remaining = false;
+
+        for (size_t index = 0; index < Count; ++index)
         {
-            return dictionary.contains(words);
-        });
+            auto& candidate = candidates.at(index);
+            candidate = candidate &&
+                !is_negative(dictionaries_.at(index).index(word, key));
+            remaining |= candidate;
+        }
+
+        if (!remaining)
+            return language::none;
+    }
 
-    return it != dictionaries_.end() ? it->identifier() : language::none;
+    // std::find returns first match, order is guaranteed.
+    const auto it = std::find(candidates.begin(), candidates.end(), true);
+    return it != candidates.end() ? dictionaries_.at(
+        std::distance(candidates.begin(), it)).identifier() : language::none;
 }
 
 // private
@@ -29,6 +29,7 @@
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/words/language.hpp>
 #include <bitcoin/system/words/languages.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -46,7 +47,14 @@ static_assert(std::is_pod<dictionary<1>::words>(), "performance");
 
 template<size_t Size>
 dictionary<Size>::dictionary(language identifier, const words& words) NOEXCEPT
-  : identifier_(identifier), words_(words)
+  : identifier_(identifier), words_(words), table_(nullptr)
+{
+}
+
+template<size_t Size>
+dictionary<Size>::dictionary(language identifier, const words& words,
+    table_getter table) NOEXCEPT
+  : identifier_(identifier), words_(words), table_(table)
 {
 }
 
@@ -90,6 +98,9 @@ string_list dictionary<Size>::at(const search& indexes) const NOEXCEPT
 template <size_t Size>
 int32_t dictionary<Size>::index(const std::string& word) const NOEXCEPT
 {
+    if (is_hashed())
+        return index(word, table::to_key(word));
+
     // Dictionary sort is configured on each dictionary, verified by tests.
     // Dictionary is char* elements but using std::string (word) for compares.
     if (words_.sorted)
@@ -101,6 +112,19 @@ int32_t dictionary<Size>::index(const std::string& word) const NOEXCEPT
         possible_narrow_cast<int32_t>(std::distance(words_.word.begin(), it));
 }
 
+template <size_t Size>
+int32_t dictionary<Size>::index(const std::string& word,
+    key key) const NOEXCEPT
+{
+    if (!is_hashed())
+        return index(word);
+
+    // The table maps any string to an index, so the word must be compared.
+    const auto at = table_().at(key);
+    return word == words_.word.at(at) ?
+        possible_narrow_sign_cast<int32_t>(at) : -1;
+}
+
 template <size_t Size>
 typename dictionary<Size>::result
 dictionary<Size>::index(const string_list& words) const NOEXCEPT
@@ -134,6 +158,16 @@ bool dictionary<Size>::contains(const string_list& words) const NOEXCEPT
         });
 }
 
+// private
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+bool dictionary<Size>::is_hashed() const NOEXCEPT
+{
+    // A table that failed to construct is not valid (linear search).
+    return table_ != nullptr && table_();
+}
+
 } // namespace words
 } // namespace system
 } // namespace libbitcoin
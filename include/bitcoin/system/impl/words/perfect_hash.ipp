@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_IPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_IPP
+
+#include <array>
+#include <string_view>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+// based on:
+// cmph.sourceforge.net/papers/esa09.pdf
+// [Belazzougui, Botelho, Dietzfelbinger] hash, displace, and compress.
+// Displacements are not compressed, the tables are small.
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// static
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+constexpr typename perfect_hash<Size>::key
+perfect_hash<Size>::to_key(const std::string_view& word) NOEXCEPT
+{
+    // fnv-1a (64 bit).
+    key hash = 0xcbf29ce484222325_u64;
+    for (const auto character: word)
+    {
+        hash ^= static_cast<uint8_t>(character);
+        hash *= 0x00000100000001b3_u64;
+    }
+
+    // murmur3 finalizer, fnv-1a alone does not mix high order bits.
+    hash ^= shift_right(hash, 33);
+    hash *= 0xff51afd7ed558ccd_u64;
+    hash ^= shift_right(hash, 33);
+    hash *= 0xc4ceb9fe1a85ec53_u64;
+    hash ^= shift_right(hash, 33);
+    return hash;
+}
+
+// private
+template <size_t Size>
+constexpr size_t perfect_hash<Size>::to_bucket(key key) NOEXCEPT
+{
+    return shift_right(key, 32) % buckets;
+}
+
+// private
+template <size_t Size>
+constexpr size_t perfect_hash<Size>::to_index(key key,
+    size_t displacement) NOEXCEPT
+{
+    // Displacement (d0, d1) is encoded as d0 * Size + d1.
+    const auto offset = key & max_uint16;
+    const auto stride = shift_right(key, 16) & max_uint16;
+    const auto d0 = displacement / Size;
+    const auto d1 = displacement % Size;
+    return (offset + d0 * stride + d1) % Size;
+}
+
+// Constructor.
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+constexpr perfect_hash<Size>::perfect_hash(const words& words) NOEXCEPT
+  : valid_(false), displacements_{}, indexes_{}
+{
+    static_assert(Size <= max_uint16, "indexes and displacements are 16 bit");
+
+    if constexpr (!is_zero(Size))
+    {
+        std::array<key, Size> keys{};
+        std::array<size_t, buckets> counts{};
+        for (size_t word = 0; word < Size; ++word)
+        {
+            keys[word] = to_key(words[word]);
+            ++counts[to_bucket(keys[word])];
+        }
+
+        // Group words by bucket, members of bucket are at [first, next first).
+        std::array<size_t, add1(buckets)> firsts{};
+        for (size_t bucket = 0; bucket < buckets; ++bucket)
+            firsts[add1(bucket)] = firsts[bucket] + counts[bucket];
+
+        std::array<uint16_t, Size> members{};
+        std::array<size_t, buckets> filled{};
+        for (size_t word = 0; word < Size; ++word)
+        {
+            const auto bucket = to_bucket(keys[word]);
+            members[firsts[bucket] + filled[bucket]++] =
+                narrow_cast<uint16_t>(word);
+        }
+
+        size_t largest = 0;
+        for (const auto count: counts)
+            largest = std::max(largest, count);
+
+        // Place buckets in order of decreasing size, the first displacement
+        // that places all bucket members into distinct open slots is saved.
+        // A slot taken by a member in the current trial is stamped with it.
+        std::array<bool, Size> used{};
+        std::array<size_t, Size> stamps{};
+        size_t trial = 0;
+
+        for (auto count = largest; count > one; --count)
+        {
+            for (size_t bucket = 0; bucket < buckets; ++bucket)
+            {
+                if (counts[bucket] != count)
+                    continue;
+
+                const auto first = firsts[bucket];
+                const auto last = first + count;
+                auto placed = false;
+
+                for (size_t displacement = 0; !placed &&
+                    displacement < displacement_limit; ++displacement)
+                {
+                    ++trial;
+                    placed = true;
+                    for (auto member = first; placed && member < last;
+                        ++member)
+                    {
+                        const auto index = to_index(keys[members[member]],
+                            displacement);
+
+                        placed = !used[index] && stamps[index] != trial;
+                        stamps[index] = trial;
+                    }
+
+                    if (!placed)
+                        continue;
+
+                    displacements_[bucket] =
+                        possible_narrow_cast<uint16_t>(displacement);
+
+                    for (auto member = first; member < last; ++member)
+                    {
+                        const auto index = to_index(keys[members[member]],
+                            displacement);
+                        used[index] = true;
+                        indexes_[index] = members[member];
+                    }
+                }
+
+                // Duplicate keys cannot be placed.
+                if (!placed)
+                    return;
+            }
+        }
+
+        // Singleton buckets are displaced (d0 = 0) directly to open slots.
+        size_t open = 0;
+        for (size_t bucket = 0; bucket < buckets; ++bucket)
+        {
+            if (counts[bucket] != one)
+                continue;
+
+            while (used[open])
+                ++open;
+
+            const auto member = members[firsts[bucket]];
+            const auto offset = keys[member] & max_uint16;
+            displacements_[bucket] = possible_narrow_cast<uint16_t>(
+                (open + Size - (offset % Size)) % Size);
+            used[open] = true;
+            indexes_[open] = member;
+        }
+
+        valid_ = true;
+    }
+}
+
+template <size_t Size>
+constexpr perfect_hash<Size>::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+// Search.
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+constexpr size_t perfect_hash<Size>::at(key key) const NOEXCEPT
+{
+    return indexes_[to_index(key, displacements_[to_bucket(key)])];
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#endif
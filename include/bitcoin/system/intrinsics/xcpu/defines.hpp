@@ -135,6 +135,7 @@ BC_POP_WARNING()
     #define mm_extract_epi32(a, Lane)   {}
     #define mm_extract_epi64(a, Lane)   {}
     #define mm_shuffle_epi8(a, mask)    (a)
+    #define mm_loadu_si128(a)           {}
     #define mm_storeu_si128(a, b)
     #define mm_set1_epi8(K)
     #define mm_set1_epi16(K)
@@ -165,6 +166,7 @@ BC_POP_WARNING()
     #define mm_extract_epi32(a, Lane)   _mm_extract_epi32(a, Lane)
     #define mm_extract_epi64(a, Lane)   _mm_extract_epi64(a, Lane) // undefined for X32
     #define mm_shuffle_epi8(a, mask)    _mm_shuffle_epi8(a, mask)
+    #define mm_loadu_si128(a)           _mm_loadu_si128(a)
     #define mm_storeu_si128(a, b)       _mm_storeu_si128(a, b)
     #define mm_set1_epi8(K)             _mm_set1_epi8(K)
     #define mm_set1_epi16(K)            _mm_set1_epi16(K)
@@ -200,6 +202,7 @@ BC_POP_WARNING()
     #define mm256_extract_epi32(a, Lane)    {}
     #define mm256_extract_epi64(a, Lane)    {}
     #define mm256_shuffle_epi8(a, mask)     (a)
+    #define mm256_loadu_si256(a)            {}
     #define mm256_storeu_si256(a, b)
     #define mm256_set1_epi8(K)
     #define mm256_set1_epi16(K)
@@ -230,6 +233,7 @@ BC_POP_WARNING()
     #define mm256_extract_epi32(a, Lane)    _mm256_extract_epi32(a, Lane)
     #define mm256_extract_epi64(a, Lane)    _mm256_extract_epi64(a, Lane) // undefined for X32
     #define mm256_shuffle_epi8(a, mask)     _mm256_shuffle_epi8(a, mask)
+    #define mm256_loadu_si256(a)            _mm256_loadu_si256(a)
     #define mm256_storeu_si256(a, b)        _mm256_storeu_si256(a, b)
     #define mm256_set1_epi8(K)              _mm256_set1_epi8(K)
     #define mm256_set1_epi16(K)             _mm256_set1_epi16(K)
@@ -261,6 +261,35 @@ INLINE xint128_t byteswap(xint128_t a) NOEXCEPT
     return mm_shuffle_epi8(a, mask);
 }
 
+// SSSE3
+INLINE xint128_t reverse_bytes(xint128_t a) NOEXCEPT
+{
+    static const auto mask = set<xint128_t>(
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    return mm_shuffle_epi8(a, mask);
+}
+
+/// load/store (unaligned)
+/// ---------------------------------------------------------------------------
+
+// SSE2
+template <typename xWord, if_same<xWord, xint128_t> = true>
+INLINE xint128_t load(const uint8_t* data) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+    return mm_loadu_si128(reinterpret_cast<const xint128_t*>(data));
+    BC_POP_WARNING()
+}
+
+// SSE2
+INLINE void store(uint8_t* data, xint128_t a) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+    mm_storeu_si128(reinterpret_cast<xint128_t*>(data), a);
+    BC_POP_WARNING()
+}
+
 /// pack/unpack
 /// ---------------------------------------------------------------------------
 ////
@@ -274,6 +274,26 @@ INLINE xint256_t byteswap(xint256_t a) NOEXCEPT
     return mm256_shuffle_epi8(a, mask);
 }
 
+/// load/store (unaligned)
+/// ---------------------------------------------------------------------------
+
+// AVX
+template <typename xWord, if_same<xWord, xint256_t> = true>
+INLINE xint256_t load(const uint8_t* data) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+    return mm256_loadu_si256(reinterpret_cast<const xint256_t*>(data));
+    BC_POP_WARNING()
+}
+
+// AVX
+INLINE void store(uint8_t* data, xint256_t a) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+    mm256_storeu_si256(reinterpret_cast<xint256_t*>(data), a);
+    BC_POP_WARNING()
+}
+
 /// pack/unpack
 /// ---------------------------------------------------------------------------
 ////
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_HPP
+#define LIBBITCOIN_SYSTEM_MATH_FIXED_UINT256_HPP
+
+#include <compare>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Fixed-width 256 bit unsigned integer of four 64 bit limbs (low first).
+/// Arithmetic is modulo 2^256 (as unchecked uint256_t), without allocation
+/// and constexpr-capable. Runtime carry and multiply use 128 bit integer
+/// (gcc/clang) or _addcarry_u64/_umul128 (msvc) intrinsics when available.
+/// Division by zero is undefined (asserted), returning zero.
+class fixed_uint256
+{
+public:
+    static constexpr size_t count = 4;
+    using limb_type = uint64_t;
+    using limbs_type = std_array<limb_type, count>;
+
+    /// Constructors.
+    constexpr fixed_uint256() NOEXCEPT;
+    constexpr fixed_uint256(uint64_t value) NOEXCEPT;
+    constexpr explicit fixed_uint256(const limbs_type& limbs) NOEXCEPT;
+    inline explicit fixed_uint256(const uint256_t& value) NOEXCEPT;
+
+    /// Properties.
+    constexpr const limbs_type& limbs() const NOEXCEPT;
+    constexpr size_t bit_width() const NOEXCEPT;
+    constexpr size_t byte_width() const NOEXCEPT;
+    inline uint256_t to_uintx() const NOEXCEPT;
+
+    /// Arithmetic (modulo 2^256).
+    constexpr fixed_uint256& operator+=(const fixed_uint256& other) NOEXCEPT;
+    constexpr fixed_uint256& operator-=(const fixed_uint256& other) NOEXCEPT;
+    constexpr fixed_uint256& operator*=(const fixed_uint256& other) NOEXCEPT;
+    constexpr fixed_uint256& operator*=(uint64_t multiplier) NOEXCEPT;
+    constexpr fixed_uint256& operator/=(const fixed_uint256& other) NOEXCEPT;
+    constexpr fixed_uint256& operator++() NOEXCEPT;
+    constexpr fixed_uint256& operator--() NOEXCEPT;
+
+    /// Divide in place by a 32 bit divisor, returning the remainder.
+    constexpr uint32_t divide(uint32_t divisor) NOEXCEPT;
+
+    /// Bitwise.
+    constexpr fixed_uint256& operator<<=(size_t shift) NOEXCEPT;
+    constexpr fixed_uint256& operator>>=(size_t shift) NOEXCEPT;
+    constexpr fixed_uint256 operator~() const NOEXCEPT;
+
+    /// Comparison.
+    constexpr bool operator==(const fixed_uint256&) const NOEXCEPT = default;
+    constexpr std::strong_ordering operator<=>(
+        const fixed_uint256& other) const NOEXCEPT;
+
+protected:
+#if defined(HAVE_INT128)
+    __extension__ typedef unsigned __int128 uint128_native_t;
+#endif
+
+    /// Quotient of left / right (remainder is not computed).
+    static constexpr fixed_uint256 long_divide(const fixed_uint256& left,
+        const fixed_uint256& right) NOEXCEPT;
+
+    /// Long division over 32 or 64 bit digits (left >= right).
+    template <typename Digit, typename Wide>
+    static constexpr fixed_uint256 knuth_divide(const fixed_uint256& left,
+        const fixed_uint256& right) NOEXCEPT;
+
+    template <typename Digit, typename Wide>
+    static constexpr void estimate_digit(Wide& quotient, Wide& remainder,
+        Digit high, Digit low, Digit divisor) NOEXCEPT;
+
+    /// Limb primitives, intrinsic when available and not constant evaluated.
+    static constexpr uint64_t add_carry(uint64_t left, uint64_t right,
+        bool& carry) NOEXCEPT;
+    static constexpr uint64_t subtract_borrow(uint64_t left, uint64_t right,
+        bool& borrow) NOEXCEPT;
+    static constexpr uint64_t multiply(uint64_t left, uint64_t right,
+        uint64_t& high) NOEXCEPT;
+
+private:
+    limbs_type limbs_;
+};
+
+constexpr fixed_uint256 operator+(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator-(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator*(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator*(fixed_uint256 left,
+    uint64_t right) NOEXCEPT;
+constexpr fixed_uint256 operator/(fixed_uint256 left,
+    const fixed_uint256& right) NOEXCEPT;
+constexpr fixed_uint256 operator<<(fixed_uint256 left, size_t shift) NOEXCEPT;
+constexpr fixed_uint256 operator>>(fixed_uint256 left, size_t shift) NOEXCEPT;
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/math/fixed_uint256.ipp>
+
+#endif
@@ -25,6 +25,7 @@
 #include <bitcoin/system/math/byteswap.hpp>
 #include <bitcoin/system/math/cast.hpp>
 #include <bitcoin/system/math/division.hpp>
+#include <bitcoin/system/math/fixed_uint256.hpp>
 #include <bitcoin/system/math/functional.hpp>
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/math/logarithm.hpp>
@@ -40,6 +41,7 @@
 // byteswap   -> cast
 // functional -> cast, rotate
 // division   -> sign
+// fixed_uint256 -> cast, bits, bytes, division
 // overflow   -> sign, cast
 // bits       -> sign, cast,           logarithm (for bit_width(clog2))
 // bytes      -> sign, cast,           logarithm (for byte_width(clog256))
@@ -29,10 +29,16 @@ namespace system {
 BC_API bool is_base58(const char character) NOEXCEPT;
 BC_API bool is_base58(const std::string& text) NOEXCEPT;
 
+/// Encode fixed size data as base58 (such as checked addresses and keys).
+/// @return the base58 encoded string.
+template <size_t Size>
+SCONSTEXPR std::string encode_base58(const data_array<Size>& unencoded) NOEXCEPT;
+
 /// Converts a base58 string to a number of bytes.
 /// @return false if the input is malformed, or the wrong length.
 template <size_t Size>
-bool decode_base58(data_array<Size>& out, const std::string& in) NOEXCEPT;
+SCONSTEXPR bool decode_base58(data_array<Size>& out,
+    const std::string& in) NOEXCEPT;
 
 /// Converts a base58 string literal to a data array.
 template <size_t Size>
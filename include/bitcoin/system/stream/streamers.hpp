@@ -35,6 +35,7 @@
 #include <bitcoin/system/stream/streamers/byte_flipper.hpp>
 #include <bitcoin/system/stream/streamers/byte_reader.hpp>
 #include <bitcoin/system/stream/streamers/byte_writer.hpp>
+#include <bitcoin/system/stream/streamers/gather_writer.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/byteflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitreader.hpp>
@@ -42,7 +43,10 @@
 #include <bitcoin/system/stream/streamers/interfaces/bitwriter.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bytewriter.hpp>
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
+#include <bitcoin/system/stream/streamers/sha256x2_reader.hpp>
 #include <bitcoin/system/stream/streamers/sha256x2_writer.hpp>
+#include <bitcoin/system/stream/streamers/slab_writer.hpp>
+#include <bitcoin/system/stream/streamers/slice_reader.hpp>
 
 // Stream Exceptions:
 // ============================================================================
@@ -72,6 +76,9 @@ namespace read
 
         /// A byte reader that copies data from a data_reference.
         using copy = make_streamer<copy_source<data_reference>, byte_reader>;
+
+        /// A byte reader that reads data directly from a data_slice.
+        using fast = slice_reader;
     }
 
     namespace bits
@@ -94,6 +101,12 @@ namespace write
         /// A byte writer that copies data to a data_slab.
         using copy = make_streamer<copy_sink<data_slab>, byte_writer>;
 
+        /// A byte writer that writes data directly to a data_slab.
+        using fast = slab_writer;
+
+        /// A byte writer that emits slices, referencing large byte writes.
+        using gather = gather_writer;
+
         /// A byte writer that inserts data into a container.
         template <typename Container>
         using push = make_streamer<push_sink<Container>, byte_writer>;
@@ -157,6 +170,9 @@ namespace hash
 
     namespace sha256x2
     {
+        /// A byte reader that bitcoin hashes bytes read from a std::istream.
+        using istream = sha256x2_reader<std::istream>;
+
         /// A hash writer that writes a bitcoin hash to a std::ostream.
         using ostream = sha256x2_writer<std::ostream>;
 
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_GATHER_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_GATHER_WRITER_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/stream/streamers/interfaces/bytewriter.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A byte writer that emits an ordered list of slices (scatter/gather, as
+/// for writev) in place of a contiguous buffer. Byte writes of at least
+/// 'reference' bytes are referenced in place, not copied, so the written
+/// memory (e.g. script push data and witness elements of a chain object) must
+/// remain valid for the lifetime of the slices. All other writes, including
+/// integers and strings, are copied into storage owned by the writer, and
+/// adjacent copies coalesce into a single slice. Slices are invalidated by
+/// destruction of the writer (move preserves them).
+class gather_writer final
+  : public bytewriter
+{
+public:
+    /// Default minimum size of a referenced (not copied) byte write.
+    static constexpr size_t default_reference = 64;
+
+    /// Constructors.
+    inline gather_writer(size_t reference=default_reference) NOEXCEPT;
+
+    /// Copy would invalidate slices.
+    gather_writer(gather_writer&&) = default;
+    gather_writer(const gather_writer&) = delete;
+    gather_writer& operator=(gather_writer&&) = default;
+    gather_writer& operator=(const gather_writer&) = delete;
+    ~gather_writer() = default;
+
+    /// Type-inferenced integer writers.
+    template <typename Integer, if_integer<Integer> = true>
+    inline void write_big_endian(Integer value) NOEXCEPT;
+    template <typename Integer, if_integer<Integer> = true>
+    inline void write_little_endian(Integer value) NOEXCEPT;
+
+    /// Write big endian integers.
+    inline void write_2_bytes_big_endian(uint16_t value) NOEXCEPT override;
+    inline void write_4_bytes_big_endian(uint32_t value) NOEXCEPT override;
+    inline void write_8_bytes_big_endian(uint64_t value) NOEXCEPT override;
+
+    /// Write little endian integers.
+    inline void write_2_bytes_little_endian(uint16_t value) NOEXCEPT override;
+    inline void write_4_bytes_little_endian(uint32_t value) NOEXCEPT override;
+    inline void write_8_bytes_little_endian(uint64_t value) NOEXCEPT override;
+
+    /// Write Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline void write_variable(uint64_t value) NOEXCEPT override;
+
+    /// Call write_4_bytes_little_endian with integer value of error code.
+    inline void write_error_code(const code& ec) NOEXCEPT override;
+
+    /// Write into buffer until stream is exhausted (copied).
+    inline std::istream& write(std::istream& in) NOEXCEPT override;
+
+    /// Write one byte.
+    inline void write_byte(uint8_t value) NOEXCEPT override;
+
+    /// Write all bytes (referenced if at least reference bytes).
+    inline void write_bytes(const data_slice& data) NOEXCEPT override;
+
+    /// Write size bytes (referenced if at least reference bytes).
+    inline void write_bytes(const uint8_t* data, size_t size) NOEXCEPT override;
+
+    /// Write Bitcoin length-prefixed string (copied).
+    inline void write_string(const std::string& value) NOEXCEPT override;
+
+    /// Write string to specified length, padded with nulls (copied).
+    inline void write_string_buffer(const std::string& value, size_t size)
+        NOEXCEPT override;
+
+    /// Flush the buffer (no-op).
+    inline void flush() NOEXCEPT override;
+
+    /// Get the current absolute position (total bytes written).
+    inline size_t get_position() NOEXCEPT override;
+
+    /// The stream is valid (always).
+    inline operator bool() const NOEXCEPT override;
+
+    /// The stream is invalid (never).
+    inline bool operator!() const NOEXCEPT override;
+
+    /// The written slices, in order.
+    inline const std::vector<data_slice>& slices() const NOEXCEPT;
+
+    /// Copy the slices into a contiguous buffer.
+    inline data_chunk to_chunk() const NOEXCEPT;
+
+private:
+    static constexpr uint8_t pad() { return 0x00; };
+    static constexpr size_t segment = 4096;
+
+    inline void do_copy_bytes(const uint8_t* data, size_t size) NOEXCEPT;
+    inline void do_fill_bytes(size_t size) NOEXCEPT;
+    inline data_chunk& allocate(size_t size) NOEXCEPT;
+    inline void append(const uint8_t* begin, size_t size,
+        bool owned) NOEXCEPT;
+
+    size_t reference_;
+    size_t position_;
+    bool owned_;
+    std::vector<data_chunk> segments_;
+    std::vector<data_slice> slices_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/gather_writer.ipp>
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SHA256X2_READER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SHA256X2_READER_HPP
+
+#include <iostream>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/streamers/byte_reader.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A byte reader that accepts an istream and tees each consumed byte into two
+/// bitcoin hash (double sha256) contexts, one of which excludes bytes consumed
+/// while the witness section is set (i.e. transaction txid and wtxid). Skipped
+/// bytes are read and hashed. Peek does not consume. Each byte is hashed once,
+/// so bytes re-read after a rewind are not hashed again. Rewind before the
+/// hash reset position invalidates.
+template <typename IStream = std::istream>
+class sha256x2_reader
+  : public byte_reader<IStream>
+{
+public:
+    /// Constructors.
+    sha256x2_reader(IStream& source) NOEXCEPT;
+
+    /// Copy/move/destruct.
+    sha256x2_reader(sha256x2_reader&&) = default;
+    sha256x2_reader(const sha256x2_reader&) = default;
+    sha256x2_reader& operator=(sha256x2_reader&&) = default;
+    sha256x2_reader& operator=(const sha256x2_reader&) = default;
+    ~sha256x2_reader() override = default;
+
+    /// Restart both hashes and clear the witness section.
+    void reset_hashes() NOEXCEPT;
+
+    /// Exclude subsequently consumed bytes from the nominal hash (or not).
+    void set_witness(bool witness) NOEXCEPT;
+
+    /// Hash of bytes consumed since reset, excluding witness sections.
+    hash_digest nominal_hash() const NOEXCEPT;
+
+    /// Hash of all bytes consumed since reset.
+    hash_digest witness_hash() const NOEXCEPT;
+
+protected:
+    void do_read_bytes(uint8_t* buffer, size_t size) NOEXCEPT override;
+    void do_skip_bytes(size_t size) NOEXCEPT override;
+    void do_rewind_bytes(size_t size) NOEXCEPT override;
+
+private:
+    void hasher(const uint8_t* data, size_t size) NOEXCEPT;
+
+    bool witness_{};
+    size_t consumed_{};
+    size_t hashed_{};
+    accumulator<sha256> nominal_{};
+    accumulator<sha256> witnessed_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/sha256x2_reader.ipp>
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLAB_WRITER_HPP
+
+#include <iostream>
+#include <string>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/stream/streamers/interfaces/bytewriter.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A byte writer that writes directly to contiguous memory (data_slab).
+/// Behavior is consistent with byte_writer over copy_sink, but there is no
+/// std::ostream and no stream state. The class is final, so calls made on a
+/// slab_writer (not a writer reference) are not virtually dispatched.
+/// The slab must remain valid for the lifetime of the writer.
+class slab_writer final
+  : public bytewriter
+{
+public:
+    /// Constructors.
+    inline slab_writer(const data_slab& data) NOEXCEPT;
+
+    /// Defaults.
+    slab_writer(slab_writer&&) = default;
+    slab_writer(const slab_writer&) = default;
+    slab_writer& operator=(slab_writer&&) = default;
+    slab_writer& operator=(const slab_writer&) = default;
+    ~slab_writer() = default;
+
+    /// Type-inferenced integer writers.
+    template <typename Integer, if_integer<Integer> = true>
+    inline void write_big_endian(Integer value) NOEXCEPT;
+    template <typename Integer, if_integer<Integer> = true>
+    inline void write_little_endian(Integer value) NOEXCEPT;
+
+    /// Write big endian integers.
+    inline void write_2_bytes_big_endian(uint16_t value) NOEXCEPT override;
+    inline void write_4_bytes_big_endian(uint32_t value) NOEXCEPT override;
+    inline void write_8_bytes_big_endian(uint64_t value) NOEXCEPT override;
+
+    /// Write little endian integers.
+    inline void write_2_bytes_little_endian(uint16_t value) NOEXCEPT override;
+    inline void write_4_bytes_little_endian(uint32_t value) NOEXCEPT override;
+    inline void write_8_bytes_little_endian(uint64_t value) NOEXCEPT override;
+
+    /// Write Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline void write_variable(uint64_t value) NOEXCEPT override;
+
+    /// Call write_4_bytes_little_endian with integer value of error code.
+    inline void write_error_code(const code& ec) NOEXCEPT override;
+
+    /// Write into buffer until stream is exhausted.
+    inline std::istream& write(std::istream& in) NOEXCEPT override;
+
+    /// Write one byte.
+    inline void write_byte(uint8_t value) NOEXCEPT override;
+
+    /// Write all bytes.
+    inline void write_bytes(const data_slice& data) NOEXCEPT override;
+
+    /// Write size bytes.
+    inline void write_bytes(const uint8_t* data, size_t size) NOEXCEPT override;
+
+    /// Write Bitcoin length-prefixed string (prefixed by write_variable).
+    inline void write_string(const std::string& value) NOEXCEPT override;
+
+    /// This is only used for writing Bitcoin command command text.
+    /// Write string to specified length, padded with nulls as required.
+    inline void write_string_buffer(const std::string& value, size_t size)
+        NOEXCEPT override;
+
+    /// Flush the buffer (no-op).
+    inline void flush() NOEXCEPT override;
+
+    /// Get the current absolute position.
+    inline size_t get_position() NOEXCEPT override;
+
+    /// The stream is valid.
+    inline operator bool() const NOEXCEPT override;
+
+    /// The stream is invalid.
+    inline bool operator!() const NOEXCEPT override;
+
+private:
+    static constexpr uint8_t pad() { return 0x00; };
+
+    inline size_t remaining() const NOEXCEPT;
+    inline bool limiter(size_t size) NOEXCEPT;
+    inline void do_write_bytes(const uint8_t* data, size_t size) NOEXCEPT;
+
+    data_slab::pointer begin_;
+    data_slab::pointer position_;
+    data_slab::pointer end_;
+    bool valid_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/slab_writer.ipp>
+
+#endif
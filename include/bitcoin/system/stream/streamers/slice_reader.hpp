@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_SLICE_READER_HPP
+
+#include <iostream>
+#include <string>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/streamers/interfaces/bytereader.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A byte reader that reads directly from contiguous memory (data_slice).
+/// Behavior is consistent with byte_reader over copy_source, but there is no
+/// std::istream and no stream state. The class is final, so calls made on a
+/// slice_reader (not a reader reference) are not virtually dispatched.
+/// The slice must remain valid for the lifetime of the reader.
+class slice_reader final
+  : public bytereader
+{
+public:
+    /// Constructors.
+    inline slice_reader(const data_slice& data) NOEXCEPT;
+
+    /// Defaults.
+    slice_reader(slice_reader&&) = default;
+    slice_reader(const slice_reader&) = default;
+    slice_reader& operator=(slice_reader&&) = default;
+    slice_reader& operator=(const slice_reader&) = default;
+    ~slice_reader() = default;
+
+    /// Read integer, size determined from parameter type.
+    template <typename Integer, if_integer<Integer> = true>
+    inline Integer read_big_endian() NOEXCEPT;
+    template <typename Integer, if_integer<Integer> = true>
+    inline Integer read_little_endian() NOEXCEPT;
+
+    /// Read big endian (explicit specializations of read_big_endian).
+    inline uint16_t read_2_bytes_big_endian() NOEXCEPT override;
+    inline uint32_t read_4_bytes_big_endian() NOEXCEPT override;
+    inline uint64_t read_8_bytes_big_endian() NOEXCEPT override;
+
+    /// Little endian integer readers (specializations of read_little_endian).
+    inline uint16_t read_2_bytes_little_endian() NOEXCEPT override;
+    inline uint32_t read_4_bytes_little_endian() NOEXCEPT override;
+    inline uint64_t read_8_bytes_little_endian() NOEXCEPT override;
+
+    /// Read Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline uint64_t read_variable() NOEXCEPT override;
+
+    /// Cast read_variable to size_t, facilitates read_bytes(read_size()).
+    /// Returns zero and invalidates stream if would exceed read limit.
+    inline size_t read_size(size_t limit=max_size_t) NOEXCEPT override;
+
+    /// Convert read_4_bytes_little_endian to an error code.
+    inline code read_error_code() NOEXCEPT override;
+
+    /// Read size bytes into array.
+    template <size_t Size>
+    inline data_array<Size> read_forward() NOEXCEPT;
+    template <size_t Size>
+    inline data_array<Size> read_reverse() NOEXCEPT;
+
+    /// Read into stream until buffer is exhausted.
+    inline std::ostream& read(std::ostream& out) NOEXCEPT override;
+
+    /// Read hash (explicit specializations of read_forward).
+    inline mini_hash read_mini_hash() NOEXCEPT override;
+    inline short_hash read_short_hash() NOEXCEPT override;
+    inline hash_digest read_hash() NOEXCEPT override;
+    inline long_hash read_long_hash() NOEXCEPT override;
+
+    /// Read/peek one byte (invalidates an empty stream).
+    inline uint8_t peek_byte() NOEXCEPT override;
+    inline uint8_t read_byte() NOEXCEPT override;
+
+    /// Read all remaining bytes.
+    inline data_chunk read_bytes() NOEXCEPT override;
+
+    /// Read size bytes, return size is guaranteed.
+    inline data_chunk read_bytes(size_t size) NOEXCEPT override;
+    inline void read_bytes(uint8_t* buffer, size_t size) NOEXCEPT override;
+
+    /// Read Bitcoin length-prefixed string.
+    /// Returns empty and invalidates stream if would exceed read limit.
+    inline std::string read_string(size_t limit=max_size_t) NOEXCEPT override;
+
+    /// Read string, truncated at size or first null.
+    /// This is only used for reading Bitcoin heading command text.
+    inline std::string read_string_buffer(size_t size) NOEXCEPT override;
+
+    /// Advance the iterator.
+    inline void skip_byte() NOEXCEPT override;
+    inline void skip_bytes(size_t size) NOEXCEPT override;
+
+    /// Rewind the iterator.
+    inline void rewind_byte() NOEXCEPT override;
+    inline void rewind_bytes(size_t size) NOEXCEPT override;
+
+    /// The stream is empty (or invalid).
+    inline bool is_exhausted() const NOEXCEPT override;
+
+    /// Get the current absolute position.
+    inline size_t get_position() NOEXCEPT override;
+
+    /// The bytes between two absolute positions, empty if not in the slice.
+    /// This allows consumed bytes to be hashed in place (without copying).
+    inline data_slice get_slice(size_t first, size_t last) const NOEXCEPT;
+
+    /// Clear invalid state and set absolute position.
+    inline void set_position(size_t absolute) NOEXCEPT override;
+
+    /// Limit stream upper bound to current position plus size (default resets).
+    inline void set_limit(size_t size=max_size_t) NOEXCEPT override;
+
+    /// Invalidate the stream.
+    inline void invalidate() NOEXCEPT override;
+
+    /// The stream is valid.
+    inline operator bool() const NOEXCEPT override;
+
+    /// The stream is invalid.
+    inline bool operator!() const NOEXCEPT override;
+
+private:
+    static constexpr uint8_t pad() { return 0x00; };
+
+    inline size_t remaining() const NOEXCEPT;
+    inline bool limiter(size_t size) NOEXCEPT;
+    inline void do_read_bytes(uint8_t* buffer, size_t size) NOEXCEPT;
+
+    data_slice::pointer begin_;
+    data_slice::pointer position_;
+    data_slice::pointer end_;
+    data_slice::pointer limit_;
+    bool valid_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/slice_reader.ipp>
+
+#endif
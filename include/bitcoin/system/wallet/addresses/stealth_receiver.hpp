@@ -53,6 +53,8 @@ public:
         const ec_compressed& ephemeral_public) const NOEXCEPT;
 
 private:
+    friend class stealth_scanner;
+
     const uint8_t version_;
     const ec_secret scan_private_;
     const ec_secret spend_private_;
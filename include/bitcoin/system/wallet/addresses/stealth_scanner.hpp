@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_STEALTH_SCANNER_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_STEALTH_SCANNER_HPP
+
+#include <vector>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// Matches the stealth rows of a block against a set of receivers.
+/// Receiver scan secrets, spend keys and filters are captured on construct,
+/// and each (row x receiver) pair of the matrix is evaluated in parallel.
+class BC_API stealth_scanner
+{
+public:
+    /// A stealth payment: [ephemeral key] [payee p2kh hash] [stealth prefix].
+    struct row
+    {
+        ec_compressed ephemeral_public;
+        short_hash payee;
+        uint32_t prefix;
+    };
+
+    /// A row that pays a receiver (indexes into each collection).
+    struct match
+    {
+        size_t row;
+        size_t receiver;
+    };
+
+    typedef std::vector<row> rows;
+    typedef std::vector<match> matches;
+
+    /// Invalid receivers are retained (for indexation) but never match.
+    stealth_scanner(const std::vector<stealth_receiver>& receivers) NOEXCEPT;
+
+    /// Number of receivers.
+    size_t size() const NOEXCEPT;
+
+    /// Matches are ordered by receiver and then by row.
+    matches scan(const rows& rows) const NOEXCEPT;
+
+private:
+    struct watch
+    {
+        bool valid;
+        ec_secret scan_private;
+        ec_compressed spend_public;
+        binary filter;
+    };
+
+    std::vector<watch> watches_;
+};
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_VANITY_SEARCH_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_VANITY_SEARCH_HPP
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/addresses/witness_address.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// Searches secrets for a compressed key p2kh (payment_address) or p2wpkh
+/// (witness_address) address that begins with a pattern, such as "1Love".
+/// The pattern is reduced on construct to ranges of the public key hash, so
+/// candidates are compared as hashes and only hits are encoded. Each lane
+/// steps its key by point addition (P + G) from an offset of the seed.
+class BC_API vanity_search
+{
+public:
+    /// A found secret and its address.
+    struct hit
+    {
+        ec_secret secret;
+        std::string address;
+    };
+
+    /// Search totals, passed to the progress handler.
+    struct progress
+    {
+        uint64_t keys;
+        double rate;
+        size_t hits;
+    };
+
+    typedef std::vector<hit> hits;
+
+    /// Invoked on the calling thread after each round of batches (rate is
+    /// keys per second over the search). Return false to stop the search.
+    typedef std::function<bool(const progress&)> handler;
+
+    /// Keys searched by a lane in each round (between handler invocations).
+    static const size_t batch_size;
+
+    /// Pattern is a base58 address prefix, with the address version prefix.
+    static vanity_search from_payment(const std::string& pattern,
+        uint8_t prefix=payment_address::mainnet_p2kh) NOEXCEPT;
+
+    /// Pattern is a lower case bech32 address prefix, with the address prefix.
+    static vanity_search from_witness(const std::string& pattern,
+        const std::string& prefix=witness_address::mainnet) NOEXCEPT;
+
+    /// False if no address of the type can begin with the pattern.
+    operator bool() const NOEXCEPT;
+
+    /// The pattern.
+    const std::string& pattern() const NOEXCEPT;
+
+    /// True if the address of the key hash may begin with the pattern.
+    /// False positives are limited to p2kh range bounds (checksum dependent).
+    bool is_candidate(const short_hash& hash) const NOEXCEPT;
+
+    /// The address of the public key if it begins with the pattern (or empty).
+    std::string match(const ec_compressed& point) const NOEXCEPT;
+
+    /// Search for up to limit hits from the seed, over the number of key lanes
+    /// (at least one), or until the handler returns false. Each round searches
+    /// one batch of each lane in parallel, and hits are ordered by round and
+    /// then by lane. Lane n starts at seed + (n << 64).
+    hits search(const ec_secret& seed, size_t lanes, size_t limit,
+        const handler& handler) const NOEXCEPT;
+
+protected:
+    /// Inclusive ranges of the public key hash.
+    typedef std::pair<short_hash, short_hash> range;
+    typedef std::vector<range> ranges;
+
+    vanity_search(const std::string& pattern, ranges&& ranges, bool witness,
+        uint8_t version, const std::string& prefix) NOEXCEPT;
+
+    std::string encode(const short_hash& hash) const NOEXCEPT;
+
+private:
+    std::string pattern_;
+    ranges ranges_;
+    bool witness_;
+    uint8_t version_;
+    std::string prefix_;
+};
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -110,6 +110,14 @@ class BC_API witness_address
         uint8_t& out_version, data_chunk& out_program,
         const std::string& address, bool strict=false) NOEXCEPT;
 
+    /// Batch converters (lax), between serialized witness output scripts and
+    /// addresses of the prefix. Each is coded in a fixed buffer, see
+    /// bech32_encode and bech32_decode. Results are empty where invalid.
+    static string_list to_addresses(const data_stack& scripts,
+        const std::string& prefix=mainnet) NOEXCEPT;
+    static data_stack to_scripts(const string_list& addresses,
+        const std::string& prefix=mainnet) NOEXCEPT;
+
     /// Constructors.
     witness_address() NOEXCEPT;
     witness_address(witness_address&& other) NOEXCEPT;
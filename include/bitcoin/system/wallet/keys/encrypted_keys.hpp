@@ -20,9 +20,11 @@
 #define LIBBITCOIN_SYSTEM_WALLET_KEYS_ENCRYPTED_KEYS_HPP
 
 #include <string>
+#include <vector>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/wallet/addresses/payment_address.hpp>
 
 namespace libbitcoin {
@@ -66,6 +68,27 @@ typedef data_array<encrypted_token_decoded_size> encrypted_token;
 static constexpr size_t ek_private_encoded_size = 58;
 static constexpr size_t ek_private_decoded_size = 43;
 typedef data_array<ek_private_decoded_size> encrypted_private;
+typedef std::vector<encrypted_private> encrypted_privates;
+
+/**
+ * The default memory bound of batched encryption and decryption (scrypt),
+ * that of the concurrent derivation of a single key.
+ */
+static constexpr uint64_t ek_maximum_memory =
+    scrypt<16384, 8, 8>::maximum_memory;
+
+/**
+ * The result of decryption of an encrypted private key in a batch.
+ */
+struct ek_decryption
+{
+    ec_secret secret;
+    uint8_t version;
+    bool compressed;
+    bool valid;
+};
+
+typedef std::vector<ek_decryption> ek_decryptions;
 
 /**
  * DEPRECATED
@@ -162,6 +185,23 @@ BC_API bool encrypt(encrypted_private& out_private, const ec_secret& secret,
     const std::string& passphrase, uint8_t version,
     bool compressed=true) NOEXCEPT;
 
+/**
+ * Encrypt the ec secrets to encrypted private keys using the passphrase.
+ * Key derivations (scrypt) are batched, with concurrency bounded by memory.
+ * @param[out] out_privates  The new encrypted private keys, in secret order.
+ * @param[in]  secrets       The ec secrets to encrypt.
+ * @param[in]  passphrase    A passphrase for use in the encryption.
+ * @param[in]  version       The coin address version byte.
+ * @param[in]  compressed    Set true to associate ec public key compression.
+ * @param[in]  memory        The memory bound of concurrent derivations.
+ * @return false if a secret could not be converted to a public key or if
+ * out of memory.
+ */
+BC_API bool encrypt(encrypted_privates& out_privates,
+    const std::vector<ec_secret>& secrets, const std::string& passphrase,
+    uint8_t version, bool compressed=true,
+    uint64_t memory=ek_maximum_memory) NOEXCEPT;
+
 /**
  * Decrypt the ec secret associated with the encrypted private key.
  * @param[out] out_secret      The decrypted ec secret.
@@ -175,6 +215,20 @@ BC_API bool decrypt(ec_secret& out_secret, uint8_t& out_version,
     bool& out_compressed, const encrypted_private& key,
     const std::string& passphrase) NOEXCEPT;
 
+/**
+ * Decrypt the ec secrets associated with the encrypted private keys.
+ * Key derivations (scrypt) are batched, with concurrency bounded by memory.
+ * @param[out] out         The decryption of each key, in key order, not valid
+ *                         if the key checksum or passphrase is not valid.
+ * @param[in]  keys        The encrypted private keys.
+ * @param[in]  passphrase  The passphrase from the encryption or token.
+ * @param[in]  memory      The memory bound of concurrent derivations.
+ * @return false if out of memory.
+ */
+BC_API bool decrypt(ek_decryptions& out, const encrypted_privates& keys,
+    const std::string& passphrase,
+    uint64_t memory=ek_maximum_memory) NOEXCEPT;
+
 /**
  * DEPRECATED (scenario)
  * Decrypt the ec point associated with the encrypted public key.
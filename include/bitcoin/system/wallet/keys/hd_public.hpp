@@ -24,6 +24,7 @@
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/wallet/keys/ec_public.hpp>
 
@@ -101,6 +102,20 @@ public:
     hd_key to_hd_key() const NOEXCEPT;
     hd_public derive_public(uint32_t index) const NOEXCEPT;
 
+    /// Derive the public keys (or their hash160s) of count consecutive
+    /// non-hardened children from first, such as for address gap scanning.
+    /// The hmac key (chain code) midstates are computed once for the range,
+    /// and children are derived in parallel.
+    /// False if the range includes a hardened index or any invalid child, in
+    /// which case the output is empty (no partial result). A child is invalid
+    /// with probability ~2^-127, but unlike BIP32 (which skips to the next
+    /// index) one invalid child fails the whole range. Callers that must
+    /// tolerate this should fall back to derive_public for the range.
+    bool derive_range(compressed_list& out, uint32_t first,
+        size_t count) const NOEXCEPT;
+    bool derive_range(short_hashes& out, uint32_t first,
+        size_t count) const NOEXCEPT;
+
 protected:
     /// Factories.
     static hd_public from_secret(const ec_secret& secret,
@@ -35,6 +35,9 @@ BC_API bool is_stealth_script(const chain::script& script) NOEXCEPT;
 BC_API bool to_stealth_prefix(uint32_t& out_prefix,
     const chain::script& script) NOEXCEPT;
 
+/// Determine if the stealth prefix begins with the filter.
+BC_API bool is_stealth_filtered(const binary& filter, uint32_t prefix) NOEXCEPT;
+
 /// Create a valid stealth ephemeral private key from the provided seed.
 BC_API bool create_ephemeral_key(ec_secret& out_secret,
     const data_chunk& seed) NOEXCEPT;
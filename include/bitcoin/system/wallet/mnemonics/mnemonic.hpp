@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_WALLET_MNEMONICS_MNEMONIC_HPP
 
 #include <string>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -42,6 +43,7 @@ class BC_API mnemonic
 public:
     typedef words::mnemonic::catalog dictionary;
     typedef words::mnemonic::catalogs dictionaries;
+    typedef std::vector<mnemonic> list;
 
     /// Supports 128 to 256 bits of entropy, in multiples of 32.
     static constexpr size_t entropy_multiple = 4;
@@ -68,6 +70,17 @@ public:
     /// Valid word counts (12, 15, 18, 21, or 24 words).
     static bool is_valid_word_count(size_t count) NOEXCEPT;
 
+    /// Construct from each sentence, in parallel and in order.
+    /// Validity of each result should be checked after construction.
+    static list from_sentences(const string_list& sentences,
+        language identifier=language::none) NOEXCEPT;
+
+    /// Derive the seed of each mnemonic, in parallel and in order.
+    /// The passphrase is normalized once for all seeds.
+    /// Null result for each invalid mnemonic, as with to_seed().
+    static long_hashes to_seeds(const list& mnemonics,
+        const std::string& passphrase="") NOEXCEPT;
+
     mnemonic() NOEXCEPT;
     ////mnemonic(const mnemonic& other) NOEXCEPT;
 
@@ -130,6 +143,10 @@ protected:
         language identifier) NOEXCEPT;
     static long_hash seeder(const string_list& words,
         const std::string& passphrase) NOEXCEPT;
+    static bool salter(std::string& salt,
+        const std::string& passphrase) NOEXCEPT;
+    static long_hash stretcher(const string_list& words,
+        const std::string& salt) NOEXCEPT;
 
     static mnemonic from_words(const string_list& words,
         language identifier) NOEXCEPT;
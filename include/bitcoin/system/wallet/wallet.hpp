@@ -25,10 +25,12 @@
 #include <bitcoin/system/wallet/addresses/qr_code.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_address.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_scanner.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_sender.hpp>
 #include <bitcoin/system/wallet/addresses/tiff.hpp>
 #include <bitcoin/system/wallet/addresses/uri.hpp>
 #include <bitcoin/system/wallet/addresses/uri_reader.hpp>
+#include <bitcoin/system/wallet/addresses/vanity_search.hpp>
 #include <bitcoin/system/wallet/addresses/witness_address.hpp>
 #include <bitcoin/system/wallet/context.hpp>
 #include <bitcoin/system/wallet/keys/ec_point.hpp>
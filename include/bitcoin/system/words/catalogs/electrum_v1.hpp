@@ -33,6 +33,10 @@ typedef words::dictionary<1626> catalog;
 extern const catalog::words en;
 extern const catalog::words pt;
 
+// Perfect hash tables of the word lists, each built on first use.
+const catalog::table& en_table() NOEXCEPT;
+const catalog::table& pt_table() NOEXCEPT;
+
 typedef words::dictionaries<2, catalog::size()> catalogs;
 
 } // namespace electrum_v1
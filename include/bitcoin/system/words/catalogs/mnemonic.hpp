@@ -41,6 +41,18 @@ extern const catalog::words ko;
 extern const catalog::words zh_Hans;
 extern const catalog::words zh_Hant;
 
+// Perfect hash tables of the word lists, each built on first use.
+const catalog::table& en_table() NOEXCEPT;
+const catalog::table& es_table() NOEXCEPT;
+const catalog::table& it_table() NOEXCEPT;
+const catalog::table& fr_table() NOEXCEPT;
+const catalog::table& cs_table() NOEXCEPT;
+const catalog::table& pt_table() NOEXCEPT;
+const catalog::table& ja_table() NOEXCEPT;
+const catalog::table& ko_table() NOEXCEPT;
+const catalog::table& zh_Hans_table() NOEXCEPT;
+const catalog::table& zh_Hant_table() NOEXCEPT;
+
 typedef words::dictionaries<10, catalog::size()> catalogs;
 
 } // namespace mnemonic
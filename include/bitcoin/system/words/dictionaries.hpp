@@ -24,6 +24,7 @@
 /// DELETECSTDINT
 #include <iterator>
 #include <string>
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/words/dictionary.hpp>
@@ -35,6 +36,8 @@ namespace words {
 
 // Search container for a set of dictionaries with POD word lists.
 // POD dictionaries wrapper with per dictionary O(n) search and O(1) index.
+// Search is O(1) per dictionary for dictionaries with perfect hash tables,
+// and a word is hashed once for search across all dictionaries.
 // Search order is guaranteed, always returns first match.
 template<size_t Count, size_t Size>
 class dictionaries
@@ -44,6 +47,7 @@ public:
     typedef typename dictionary<Size>::search search;
     typedef typename dictionary<Size>::result result;
     typedef std::array<dictionary<Size>, Count> list;
+    typedef std::pair<language, int32_t> location;
 
     /// The number of dictionaries.
     static constexpr size_t count() NOEXCEPT { return Count; };
@@ -84,6 +88,10 @@ public:
     /// Empty list if language does not exist.
     result index(const string_list& words, language identifier) const NOEXCEPT;
 
+    /// The first dictionary that contains the word and the word's index.
+    /// {language::none, -1} if the word is not found in any dictionary.
+    location locate(const std::string& word) const NOEXCEPT;
+
     /// The language that contains the specified word, or language::none.
     /// If language::none is specified all dictionaries are searched.
     /// If any other language is specified the search is limited to it.
@@ -29,6 +29,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/words/language.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -36,6 +37,8 @@ namespace words {
 
 // Search container for a dictionary of lexically-sorted words.
 // POD dictionary wrapper with O(n) search and O(1) index.
+// Search is O(1) when constructed with a perfect hash table of the words,
+// which is obtained (and so built) on the first search that uses it.
 // Search order is guaranteed, always returns first match.
 template<size_t Size>
 class dictionary
@@ -44,13 +47,18 @@ public:
     typedef std::vector<size_t> search;
     typedef std::vector<int32_t> result;
     typedef struct { bool sorted; std::array<const char*, Size> word; } words;
+    typedef perfect_hash<Size> table;
+    typedef typename table::key key;
+    typedef const table&(*table_getter)() NOEXCEPT;
     static_assert(Size <= possible_narrow_sign_cast<size_t>(max_int32));
 
     /// The number of words in the dictionary.
     static constexpr size_t size() NOEXCEPT { return Size; };
 
-    /// Constructor.
+    /// Constructors, table must be constructed from the same words.
     dictionary(language identifier, const words& words) NOEXCEPT;
+    dictionary(language identifier, const words& words,
+        table_getter table) NOEXCEPT;
 
     /// The language identifier of the dictionary.
     language identifier() const NOEXCEPT;
@@ -69,6 +77,10 @@ public:
     /// -1 if word is not found.
     int32_t index(const std::string& word) const NOEXCEPT;
 
+    /// -1 if word is not found, key is table::to_key(word).
+    /// The key is independent of dictionary, so may be reused across them.
+    int32_t index(const std::string& word, key key) const NOEXCEPT;
+
     /// -1 for any word that is not found.
     result index(const string_list& words) const NOEXCEPT;
 
@@ -79,7 +91,9 @@ public:
     bool contains(const string_list& words) const NOEXCEPT;
 
 private:
-    // This dictionary creates only this one word of state.
+    bool is_hashed() const NOEXCEPT;
+
+    // This dictionary creates only this one word of state (and table_).
     const language identifier_;
 
     // Arrays of words are declared statically and held by reference here.
@@ -87,6 +101,9 @@ private:
     // this wrapper dictionary object is created for each word list, for
     // each dictionaries object constructed by various mnemonic classes.
     const words& words_;
+
+    // Tables are function-local statics (with words), or null if none.
+    const table_getter table_;
 };
 
 } // namespace words
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_HPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_HPP
+
+#include <array>
+#include <string_view>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+// Minimal perfect hash table over a list of unique words (hash, displace).
+// Each word maps to a distinct index in [0, Size), in O(1). Any other string
+// also maps to some index, so the word at that index must be compared.
+// Constructible in constant evaluation, for tables over constexpr word lists.
+template<size_t Size>
+class perfect_hash
+{
+public:
+    typedef uint64_t key;
+    typedef std::array<const char*, Size> words;
+
+    /// The number of words in the table.
+    static constexpr size_t size() NOEXCEPT { return Size; };
+
+    /// The table-independent hash of a word, to probe any number of tables.
+    static constexpr key to_key(const std::string_view& word) NOEXCEPT;
+
+    /// Constructor, placement fails for duplicate (or colliding) words.
+    constexpr perfect_hash(const words& words) NOEXCEPT;
+
+    /// True if all words were placed, otherwise the table is not usable.
+    constexpr operator bool() const NOEXCEPT;
+
+    /// The only index at which the keyed word may exist (table must be valid).
+    constexpr size_t at(key key) const NOEXCEPT;
+
+private:
+    // One key per bucket (average) minimizes placement work in compilation.
+    static constexpr size_t buckets = Size;
+    static constexpr size_t displacement_limit = add1<size_t>(max_uint16);
+
+    static constexpr size_t to_bucket(key key) NOEXCEPT;
+    static constexpr size_t to_index(key key, size_t displacement) NOEXCEPT;
+
+    bool valid_;
+    std::array<uint16_t, buckets> displacements_;
+    std::array<uint16_t, Size> indexes_;
+};
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/words/perfect_hash.ipp>
+
+#endif
@@ -72,9 +72,7 @@ block::block(const chain::header::cptr& header,
 }
 
 block::block(const data_slice& data, bool witness) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : block(stream::in::copy(data), witness)
-    BC_POP_WARNING()
+  : block(read::bytes::fast(data), witness)
 {
 }
 
@@ -99,10 +97,22 @@ block::block(reader& source, bool witness) NOEXCEPT
 {
 }
 
+block::block(slice_reader&& source, bool witness) NOEXCEPT
+  : block(from_data(source, witness))
+{
+}
+
+block::block(slice_reader& source, bool witness) NOEXCEPT
+  : block(from_data(source, witness))
+{
+}
+
 // protected
 block::block(const chain::header::cptr& header,
     const chain::transactions_cptr& txs, bool valid) NOEXCEPT
-  : header_(header), txs_(txs), valid_(valid)
+  : header_(header), txs_(txs), valid_(valid),
+    nominal_size_(serialized_size(*txs_, false)),
+    witness_size_(serialized_size(*txs_, true))
 {
 }
 
@@ -124,9 +134,10 @@ bool block::operator!=(const block& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-block block::from_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+block block::from_data(Source& source, bool witness) NOEXCEPT
 {
-    const auto read_transactions = [witness](reader& source) NOEXCEPT
+    const auto read_transactions = [witness](Source& source) NOEXCEPT
     {
         BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
         auto txs = std::make_shared<transaction_ptrs>();
@@ -164,13 +175,10 @@ block block::from_data(reader& source, bool witness) NOEXCEPT
 
 data_chunk block::to_data(bool witness) const NOEXCEPT
 {
+    // Exactly sized (cached), written without a stream.
     data_chunk data(serialized_size(witness));
-
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream::out::copy ostream(data);
-    BC_POP_WARNING()
-
-    to_data(ostream, witness);
+    write::bytes::fast sink(data);
+    to_data(sink, witness);
     return data;
 }
 
@@ -240,6 +248,14 @@ hash_digest block::hash() const NOEXCEPT
 }
 
 size_t block::serialized_size(bool witness) const NOEXCEPT
+{
+    // Sizes are cached on construction.
+    return witness ? witness_size_ : nominal_size_;
+}
+
+// static/private
+size_t block::serialized_size(const transaction_ptrs& txs,
+    bool witness) NOEXCEPT
 {
     // Overflow returns max_size_t.
     const auto sum = [witness](size_t total, const transaction::cptr& tx) NOEXCEPT
@@ -248,9 +264,8 @@ size_t block::serialized_size(bool witness) const NOEXCEPT
     };
 
     return header::serialized_size()
-        + variable_size(txs_->size())
-        + std::accumulate(txs_->begin(), txs_->end(), zero, sum);
-
+        + variable_size(txs.size())
+        + std::accumulate(txs.begin(), txs.end(), zero, sum);
 }
 
 // Connect.
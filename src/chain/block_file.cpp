@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_file.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <ios>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+#include <bitcoin/system/unicode/utf8_everywhere/environment.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+using namespace boost::iostreams;
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+block_file::block_file(const std::filesystem::path& path,
+    uint32_t magic) NOEXCEPT
+  : file_(), index_(), valid_(false)
+{
+    // An empty file cannot be mapped, but is a valid file of no records.
+    std::error_code ec;
+    const auto length = std::filesystem::file_size(to_extended_path(path), ec);
+    if (ec)
+        return;
+
+    if (is_zero(length))
+    {
+        valid_ = true;
+        return;
+    }
+
+    // mapped_file_source does not honor BOOST_EXCEPTION_DISABLE.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    try
+    {
+        file_ = std::make_shared<mapped_file_source>(to_extended_path(path));
+    }
+    catch (const std::ios_base::failure&)
+    {
+        file_.reset();
+        return;
+    }
+    BC_POP_WARNING()
+
+    valid_ = split(magic);
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool block_file::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+size_t block_file::size() const NOEXCEPT
+{
+    return file_ ? file_->size() : zero;
+}
+
+const block_file::records& block_file::index() const NOEXCEPT
+{
+    return index_;
+}
+
+data_slice block_file::at(size_t index) const NOEXCEPT
+{
+    if (index >= index_.size())
+        return {};
+
+    const auto begin = pointer_cast<const uint8_t>(file_->data());
+
+    const auto& item = index_.at(index);
+    const auto first = std::next(begin, item.offset);
+    return { first, std::next(first, item.size) };
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+bool block_file::scan(const handler& handler, bool witness,
+    size_t batch) const NOEXCEPT
+{
+    struct checked
+    {
+        block::cptr value;
+        code ec;
+    };
+
+    const auto parse = [&](size_t position) NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        const auto value = to_shared(block{ at(position), witness });
+        BC_POP_WARNING()
+
+        // Check is not invoked for a block that failed to deserialize.
+        const auto ec = value->is_valid() ? value->check() : code{};
+        return checked{ value, ec };
+    };
+
+    // At most one batch of blocks is retained at any time (plus any retained
+    // by the handler). Mapped pages are file-backed, so the operating system
+    // reclaims them under pressure without writing to swap.
+    const auto count = std::max(batch, one);
+    std::vector<size_t> positions(std::min(count, index_.size()));
+    std::vector<checked> blocks(positions.size());
+
+    for (size_t first = zero; first < index_.size(); first += count)
+    {
+        const auto size = std::min(count, index_.size() - first);
+        positions.resize(size);
+        blocks.resize(size);
+        std::iota(positions.begin(), positions.end(), first);
+        std_transform(bc::par_unseq, positions.begin(), positions.end(),
+            blocks.begin(), parse);
+
+        for (size_t offset = zero; offset < size; ++offset)
+        {
+            const auto& item = blocks.at(offset);
+            if (!item.value->is_valid() ||
+                !handler(item.value, item.ec, first + offset))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// private
+bool block_file::split(uint32_t magic) NOEXCEPT
+{
+    const auto begin = pointer_cast<const uint8_t>(file_->data());
+
+    const data_slice data{ begin, std::next(begin, file_->size()) };
+    read::bytes::fast source(data);
+
+    while (!source.is_exhausted())
+    {
+        const auto start = source.get_position();
+        const auto value = source.read_4_bytes_little_endian();
+        const auto size = source.read_4_bytes_little_endian();
+
+        // Files are preallocated in zero-filled chunks, so a short prefix or
+        // a prefix that is not a record terminates the records if all of the
+        // remaining bytes are zero. Otherwise the file is invalid.
+        if (!source || value != magic || is_zero(size))
+            return is_padding(data, start);
+
+        if (size > max_block_weight)
+            return false;
+
+        const auto offset = source.get_position();
+        source.skip_bytes(size);
+        if (!source)
+            return false;
+
+        index_.push_back({ offset, size });
+    }
+
+    return true;
+}
+
+// private
+bool block_file::is_padding(const data_slice& data, size_t start) NOEXCEPT
+{
+    return std::all_of(std::next(data.begin(), start), data.end(),
+        [](uint8_t byte) NOEXCEPT
+        {
+            return is_zero(byte);
+        });
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_parser.hpp>
+
+#include <iterator>
+#include <memory>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+block_parser::block_parser(bool witness) NOEXCEPT
+  : witness_(witness),
+    invalid_(false),
+    counted_(false),
+    expected_(zero),
+    offset_(zero),
+    required_(zero),
+    header_(),
+    txs_(to_shared<transaction_ptrs>()),
+    buffer_()
+{
+}
+
+block_parser::block_parser(const block_parser& other) NOEXCEPT
+  : witness_(other.witness_),
+    invalid_(other.invalid_),
+    counted_(other.counted_),
+    expected_(other.expected_),
+    offset_(other.offset_),
+    required_(other.required_),
+    header_(other.header_),
+    txs_(copy(*other.txs_)),
+    buffer_(other.buffer_)
+{
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+block_parser& block_parser::operator=(const block_parser& other) NOEXCEPT
+{
+    witness_ = other.witness_;
+    invalid_ = other.invalid_;
+    counted_ = other.counted_;
+    expected_ = other.expected_;
+    offset_ = other.offset_;
+    required_ = other.required_;
+    header_ = other.header_;
+    txs_ = copy(*other.txs_);
+    buffer_ = other.buffer_;
+    return *this;
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+// static/private
+// Transactions are immutable, so only the vector of pointers is copied.
+std::shared_ptr<transaction_ptrs> block_parser::copy(
+    const transaction_ptrs& txs) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    return std::make_shared<transaction_ptrs>(txs);
+    BC_POP_WARNING()
+}
+
+bool block_parser::push(const data_slice& chunk) NOEXCEPT
+{
+    if (invalid_)
+        return false;
+
+    // Bytes past the end of the block.
+    if (is_complete())
+    {
+        invalid_ = !chunk.empty();
+        return !invalid_;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    buffer_.insert(buffer_.end(), chunk.begin(), chunk.end());
+    BC_POP_WARNING()
+
+    // Parse all completed elements.
+    while (parse(buffer_, offset_));
+
+    // Drop parsed bytes only once they are at least half of the buffer, so
+    // that the cost of moving unparsed bytes is amortized over parsed bytes.
+    if (offset_ >= pending())
+    {
+        buffer_.erase(buffer_.begin(), std::next(buffer_.begin(), offset_));
+        offset_ = zero;
+    }
+
+    // Bytes past the end of the block, or a block that cannot complete.
+    if ((is_complete() && !is_zero(pending())) ||
+        pending() > max_block_weight)
+        invalid_ = true;
+
+    return !invalid_;
+}
+
+// Parse one element from the front of the unparsed data, false if none.
+bool block_parser::parse(const data_slice& data, size_t& offset) NOEXCEPT
+{
+    if (invalid_ || is_complete())
+        return false;
+
+    const data_slice remaining{ std::next(data.begin(), offset), data.end() };
+
+    if (!header_)
+    {
+        if (remaining.size() < header::serialized_size())
+            return false;
+
+        BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        header_ = to_shared(new header{ remaining });
+        BC_POP_WARNING()
+        BC_POP_WARNING()
+
+        offset += header::serialized_size();
+        return true;
+    }
+
+    if (!counted_)
+    {
+        read::bytes::fast source(remaining);
+        const auto count = source.read_variable();
+
+        // Incomplete variable integer.
+        if (!source)
+            return false;
+
+        if (count > max_block_size)
+        {
+            invalid_ = true;
+            return false;
+        }
+
+        expected_ = possible_narrow_cast<size_t>(count);
+        counted_ = true;
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        txs_->reserve(expected_);
+        BC_POP_WARNING()
+
+        offset += source.get_position();
+        return true;
+    }
+
+    // An incomplete transaction is not sized again until it may be complete.
+    if (remaining.size() < required_)
+        return false;
+
+    // Size the transaction without allocation, zero if incomplete or invalid.
+    const auto size = transaction_size(remaining, invalid_, required_);
+    if (is_zero(size))
+        return false;
+
+    required_ = zero;
+
+    const data_slice bytes{ remaining.begin(),
+        std::next(remaining.begin(), size) };
+    read::bytes::fast source(bytes);
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto tx = to_shared(new transaction{ source, witness_ });
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    if (!tx->is_valid())
+    {
+        invalid_ = true;
+        return false;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    txs_->push_back(tx);
+    BC_POP_WARNING()
+
+    offset += size;
+    return true;
+}
+
+// static
+size_t block_parser::transaction_size(const data_slice& data,
+    bool& invalid) NOEXCEPT
+{
+    auto required = zero;
+    return transaction_size(data, invalid, required);
+}
+
+// static
+size_t block_parser::transaction_size(const data_slice& data, bool& invalid,
+    size_t& required) NOEXCEPT
+{
+    read::bytes::fast source(data);
+
+    // Bytes required by the next read (retained by the read that fails).
+    const auto need = [&](size_t size) NOEXCEPT
+    {
+        if (source)
+            required = ceilinged_add(source.get_position(), size);
+    };
+
+    const auto skip = [&](size_t size) NOEXCEPT
+    {
+        need(size);
+        source.skip_bytes(size);
+    };
+
+    // Counts and sizes that cannot fit in a block are invalid, not incomplete.
+    const auto read_size = [&](size_t limit) NOEXCEPT
+    {
+        need(one);
+        const auto size = source.read_variable();
+        if (size > limit)
+        {
+            invalid = true;
+            source.invalidate();
+            return zero;
+        }
+
+        return possible_narrow_cast<size_t>(size);
+    };
+
+    skip(sizeof(uint32_t));
+    auto inputs = read_size(max_block_size);
+
+    // Detect witness as no inputs (marker) and expected flag (bip144).
+    // Peek past end invalidates the source, which is an incomplete result.
+    need(one);
+    const auto segregated =
+        inputs == witness_marker &&
+        source.peek_byte() == witness_enabled;
+
+    if (segregated)
+    {
+        skip(one);
+        inputs = read_size(max_block_size);
+    }
+
+    for (auto input = zero; input < inputs && source; ++input)
+    {
+        skip(point::serialized_size());
+        skip(read_size(max_block_weight));
+        skip(sizeof(uint32_t));
+    }
+
+    const auto outputs = read_size(max_block_size);
+    for (auto output = zero; output < outputs && source; ++output)
+    {
+        skip(sizeof(uint64_t));
+        skip(read_size(max_block_weight));
+    }
+
+    if (segregated)
+    {
+        for (auto input = zero; input < inputs && source; ++input)
+        {
+            const auto elements = read_size(max_block_weight);
+            for (auto element = zero; element < elements && source; ++element)
+                skip(read_size(max_block_weight));
+        }
+    }
+
+    skip(sizeof(uint32_t));
+    return source ? source.get_position() : zero;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool block_parser::is_complete() const NOEXCEPT
+{
+    return !invalid_ && counted_ && txs_->size() == expected_;
+}
+
+bool block_parser::is_invalid() const NOEXCEPT
+{
+    return invalid_;
+}
+
+size_t block_parser::pending() const NOEXCEPT
+{
+    return buffer_.size() - offset_;
+}
+
+size_t block_parser::expected() const NOEXCEPT
+{
+    return expected_;
+}
+
+const header::cptr& block_parser::header_ptr() const NOEXCEPT
+{
+    return header_;
+}
+
+const transaction_ptrs& block_parser::transactions() const NOEXCEPT
+{
+    return *txs_;
+}
+
+block block_parser::to_block() const NOEXCEPT
+{
+    // Parser is complete so transactions are no longer modified.
+    return is_complete() ? block{ header_, txs_ } : block{};
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -21,6 +21,9 @@
 #include <algorithm>
 #include <chrono>
 #include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
 #include <bitcoin/system/chain/block.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
@@ -348,8 +351,14 @@ uint32_t chain_state::retarget_timespan(const data& values,
     return limit(timespan, minimum_timespan, maximum_timespan);
 }
 
-constexpr bool patch_timewarp(uint32_t forks, const uint256_t& limit,
-    const uint256_t& target) NOEXCEPT
+// floored_log2 of a fixed width value (zero for zero).
+constexpr size_t floored_log2(const fixed_uint256& value) NOEXCEPT
+{
+    return is_zero(value) ? zero : sub1(value.bit_width());
+}
+
+constexpr bool patch_timewarp(uint32_t forks, const fixed_uint256& limit,
+    const fixed_uint256& target) NOEXCEPT
 {
     return script::is_enabled(forks, forks::retarget_overflow_patch) &&
         floored_log2(target) >= floored_log2(limit);
@@ -359,20 +368,21 @@ uint32_t chain_state::work_required_retarget(const data& values, uint32_t forks,
     uint32_t proof_of_work_limit, uint32_t minimum_timespan,
     uint32_t maximum_timespan, uint32_t retargeting_interval_seconds) NOEXCEPT
 {
-    static const auto limit = compact::expand(proof_of_work_limit);
-    auto target = compact::expand(bits_high(values));
+    const auto limit = compact::expand_fixed(proof_of_work_limit);
+    auto target = compact::expand_fixed(bits_high(values));
 
     // Conditionally implement retarget overflow patch (e.g. Litecoin).
-    const auto timewarp = to_int(patch_timewarp(forks, limit, target));
+    const auto timewarp = to_int<size_t>(patch_timewarp(forks, limit, target));
 
     target >>= timewarp;
     target *= retarget_timespan(values, minimum_timespan, maximum_timespan);
-    target /= retargeting_interval_seconds;
+    target.divide(retargeting_interval_seconds);
     target <<= timewarp;
 
     // Disallow target from falling below minimum configured.
     // All targets are a bits value normalized by compress here.
-    return target > limit ? proof_of_work_limit : compact::compress(target);
+    return target > limit ? proof_of_work_limit :
+        compact::compress_fixed(target);
 }
 
 // A retarget height, or a block that does not have proof_of_work_limit bits.
@@ -510,19 +520,13 @@ uint32_t chain_state::median_time_past(const data& values, uint32_t) NOEXCEPT
     BC_POP_WARNING()
 }
 
-// This is promotion from a preceding height to the next.
-chain_state::data chain_state::to_pool(const chain_state& top,
+// This is promotion from a preceding height to the next (in place).
+void chain_state::promote(data& data, uint32_t forks,
     const system::settings& settings) NOEXCEPT
 {
-    // Alias configured forks.
-    const auto forks = top.forks_;
-
     // Retargeting is only activated via configuration.
     const auto retarget = script::is_enabled(forks, forks::retarget);
 
-    // Copy data from presumed previous-height block state.
-    chain_state::data data{ top.data_ };
-
     // If this overflows height is zero and result is handled as invalid.
     const auto height = add1(data.height);
     
@@ -566,6 +570,15 @@ chain_state::data chain_state::to_pool(const chain_state& top,
     data.hash = null_hash;
     data.bits.self = 0;
     data.version.self = signal_version(forks, settings);
+}
+
+// This is promotion from a preceding height to the next.
+chain_state::data chain_state::to_pool(const chain_state& top,
+    const system::settings& settings) NOEXCEPT
+{
+    // Copy data from presumed previous-height block state.
+    chain_state::data data{ top.data_ };
+    promote(data, top.forks_, settings);
     return data;
 }
 
@@ -624,17 +637,20 @@ chain_state::chain_state(const chain_state& pool, const block& block,
 {
 }
 
-chain_state::data chain_state::to_header(const chain_state& parent,
-    const header& header, const system::settings& settings) NOEXCEPT
+// This is promotion from pool state to header state (in place).
+void chain_state::promote(data& data, const header& header,
+    const system::settings& settings) NOEXCEPT
 {
-    BC_ASSERT(header.previous_block_hash() == parent.hash());
-
-    // Copy and promote data from presumed parent-height header/block state.
-    auto data = to_pool(parent, settings);
+    promote(data, header, header.hash(), settings);
+}
 
+// This is promotion from pool state to header state (in place).
+void chain_state::promote(data& data, const header& header,
+    const hash_digest& hash, const system::settings& settings) NOEXCEPT
+{
     // Replace the pool (empty) current block state with given header state.
     // Preserve data.timestamp.retarget promotion.
-    data.hash = header.hash();
+    data.hash = hash;
     data.bits.self = header.bits();
     data.version.self = header.version();
     data.timestamp.self = header.timestamp();
@@ -646,7 +662,16 @@ chain_state::data chain_state::to_header(const chain_state& parent,
     // Cache hash of bip9 bit1 height block, otherwise use preceding state.
     if (data.height == settings.bip9_bit1_active_checkpoint.height())
         data.bip9_bit1_hash = data.hash;
+}
+
+chain_state::data chain_state::to_header(const chain_state& parent,
+    const header& header, const system::settings& settings) NOEXCEPT
+{
+    BC_ASSERT(header.previous_block_hash() == parent.hash());
 
+    // Copy and promote data from presumed parent-height header/block state.
+    auto data = to_pool(parent, settings);
+    promote(data, header, settings);
     return data;
 }
 
@@ -767,16 +792,22 @@ bool chain_state::is_valid() const NOEXCEPT
 // Checkpoints.
 // ----------------------------------------------------------------------------
 
-bool chain_state::is_checkpoint_conflict(
-    const hash_digest& hash) const NOEXCEPT
+bool chain_state::is_checkpoint_conflict(const checkpoints& checkpoints,
+    size_t height, const hash_digest& hash) NOEXCEPT
 {
-    const auto it = std::find_if(checkpoints_.begin(), checkpoints_.end(),
+    const auto it = std::find_if(checkpoints.begin(), checkpoints.end(),
         [&](const checkpoint& item) NOEXCEPT
         {
-            return data_.height == item.height();
+            return height == item.height();
         });
     
-    return it != checkpoints_.end() && it->hash() == hash;
+    return it != checkpoints.end() && it->hash() == hash;
+}
+
+bool chain_state::is_checkpoint_conflict(
+    const hash_digest& hash) const NOEXCEPT
+{
+    return is_checkpoint_conflict(checkpoints_, data_.height, hash);
 }
 
 bool chain_state::is_under_checkpoint() const NOEXCEPT
@@ -790,6 +821,79 @@ bool chain_state::is_under_checkpoint() const NOEXCEPT
         });
 }
 
+// Bulk validation.
+// ----------------------------------------------------------------------------
+
+chain_state::ptr chain_state::validate(code& ec, size_t& index,
+    const header_cptrs& headers, const system::settings& settings,
+    bool scrypt) const NOEXCEPT
+{
+    const auto count = headers.size();
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    hashes identities(count);
+    std::vector<code> checks(count);
+    std::vector<size_t> indexes(count);
+    BC_POP_WARNING()
+
+    // Context free, headers are shared so their hash caches are not written.
+    const auto check = [&](size_t position) NOEXCEPT
+    {
+        const auto& header = *headers.at(position);
+        auto& identity = identities.at(position);
+        identity = header.hash(header.midstate(), header.timestamp(),
+            header.nonce());
+        checks.at(position) = header.check(identity,
+            settings.timestamp_limit_seconds, settings.proof_of_work_limit,
+            scrypt);
+    };
+
+    std::iota(indexes.begin(), indexes.end(), zero);
+    std_for_each(bc::par_unseq, indexes.begin(), indexes.end(), check);
+
+    // Contextual, promoting a copy of the last valid values for each header.
+    auto values = data_;
+    auto next = data_;
+    for (index = zero; index < count; ++index)
+    {
+        const auto& header = *headers.at(index);
+        const auto& identity = identities.at(index);
+        if ((ec = checks.at(index)))
+            break;
+
+        if (header.previous_block_hash() != values.hash)
+        {
+            ec = error::orphan_header;
+            break;
+        }
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        next = values;
+        BC_POP_WARNING()
+
+        promote(next, forks_, settings);
+        promote(next, header, identity, settings);
+
+        ec = header.accept(
+            is_checkpoint_conflict(checkpoints_, next.height, next.hash),
+            activation(next, forks_, settings).minimum_block_version,
+            median_time_past(next, forks_),
+            work_required(next, forks_, settings));
+
+        if (ec)
+            break;
+
+        std::swap(values, next);
+    }
+
+    if (index == count)
+        ec = error::success;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    return std::make_shared<chain_state>(std::move(values), checkpoints_,
+        forks_, stale_seconds_, settings);
+    BC_POP_WARNING()
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -60,9 +60,7 @@ header::header(uint32_t version, const hash_digest& previous_block_hash,
 }
 
 header::header(const data_slice& data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : header(stream::in::copy(data))
-    BC_POP_WARNING()
+  : header(read::bytes::fast(data))
 {
 }
 
@@ -86,6 +84,16 @@ header::header(reader& source) NOEXCEPT
 {
 }
 
+header::header(slice_reader&& source) NOEXCEPT
+  : header(from_data(source))
+{
+}
+
+header::header(slice_reader& source) NOEXCEPT
+  : header(from_data(source))
+{
+}
+
 // protected
 header::header(uint32_t version, hash_digest&& previous_block_hash,
     hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
@@ -136,7 +144,8 @@ bool header::operator!=(const header& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-header header::from_data(reader& source) NOEXCEPT
+template <typename Source>
+header header::from_data(Source& source) NOEXCEPT
 {
     return
     {
@@ -222,17 +231,75 @@ uint32_t header::nonce() const NOEXCEPT
 // computed
 hash_digest header::hash() const NOEXCEPT
 {
-    hash_digest digest{};
-    hash::sha256x2::copy sink(digest);
-    to_data(sink);
-    sink.flush();
-    return digest;
+    return get_hash();
+}
+
+// Cache.
+// ----------------------------------------------------------------------------
+
+// Not thread safe, the cache is written on first call.
+const hash_digest& header::get_hash() const NOEXCEPT
+{
+    if (!hash_)
+        hash_ = to_shared(hash(midstate(), timestamp_, nonce_));
+
+    return *hash_;
+}
+
+// Midstate hashing.
+// ----------------------------------------------------------------------------
+
+// The first block ends within the merkle root.
+constexpr auto merkle_head = array_count<sha256::block_t> -
+    (sizeof(uint32_t) + hash_size);
+constexpr auto merkle_tail = hash_size - merkle_head;
+
+sha256::state_t header::midstate() const NOEXCEPT
+{
+    sha256::block_t block{};
+    write::bytes::copy sink(block);
+    sink.write_4_bytes_little_endian(version_);
+    sink.write_bytes(previous_block_hash_);
+    sink.write_bytes(merkle_root_.data(), merkle_head);
+    return sha256::midstate(block);
+}
+
+// private
+sha256::quarter_t header::quarter(uint32_t timestamp,
+    uint32_t nonce) const NOEXCEPT
+{
+    const auto tail = std::next(merkle_root_.data(), merkle_head);
+    sha256::quarter_t quarter{};
+    write::bytes::copy sink(quarter);
+    sink.write_bytes(tail, merkle_tail);
+    sink.write_4_bytes_little_endian(timestamp);
+    sink.write_4_bytes_little_endian(bits_);
+    sink.write_4_bytes_little_endian(nonce);
+    return quarter;
+}
+
+hash_digest header::hash(const sha256::state_t& midstate, uint32_t timestamp,
+    uint32_t nonce) const NOEXCEPT
+{
+    return sha256::midstate_hash(midstate, quarter(timestamp, nonce));
+}
+
+void header::hash(hashes& out, const sha256::state_t& midstate,
+    uint32_t timestamp, uint32_t nonce) const NOEXCEPT
+{
+    sha256::midstate_hash(out, midstate, quarter(timestamp, nonce));
 }
 
 // static/private
 uint256_t header::difficulty(uint32_t bits) NOEXCEPT
 {
-    auto target = compact::expand(bits);
+    return work(bits).to_uintx();
+}
+
+// static
+fixed_uint256 header::work(uint32_t bits) NOEXCEPT
+{
+    const auto target = compact::expand_fixed(bits);
 
     //*************************************************************************
     // CONSENSUS: bits may be overflowed, which is guarded here.
@@ -260,11 +327,26 @@ uint256_t header::difficulty() const NOEXCEPT
     return difficulty(bits_);
 }
 
+// computed
+fixed_uint256 header::work() const NOEXCEPT
+{
+    // Returns zero if bits_ mantissa is less than one or bits_ is overflowed.
+    return work(bits_);
+}
+
 // Check.
 // ----------------------------------------------------------------------------
 
 bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
     bool scrypt) const NOEXCEPT
+{
+    // The scrypt proof of work does not use the identity hash.
+    return is_invalid_proof_of_work(scrypt ? null_hash : hash(),
+        proof_of_work_limit, scrypt);
+}
+
+bool header::is_invalid_proof_of_work(const hash_digest& hash,
+    uint32_t proof_of_work_limit, bool scrypt) const NOEXCEPT
 {
     static const auto limit = compact::expand(proof_of_work_limit);
     const auto target = compact::expand(bits_);
@@ -281,7 +363,7 @@ bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
         return true;
 
     // Conditionally use scrypt proof of work (e.g. Litecoin).
-    return to_uintx(scrypt ? scrypt_hash(to_data()) : hash()) > target;
+    return to_uintx(scrypt ? scrypt_hash(to_data()) : hash) > target;
 }
 
 // ****************************************************************************
@@ -312,20 +394,40 @@ code header::check(uint32_t timestamp_limit_seconds,
     return error::success;
 }
 
+code header::check(const hash_digest& hash, uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, bool scrypt) const NOEXCEPT
+{
+    if (is_invalid_proof_of_work(hash, proof_of_work_limit, scrypt))
+        return error::invalid_proof_of_work;
+
+    if (is_invalid_timestamp(timestamp_limit_seconds))
+        return error::futuristic_timestamp;
+
+    return error::success;
+}
+
 code header::accept(const chain_state& state) const NOEXCEPT
 {
-    if (state.is_checkpoint_conflict(hash()))
+    return accept(state.is_checkpoint_conflict(hash()),
+        state.minimum_block_version(), state.median_time_past(),
+        state.work_required());
+}
+
+code header::accept(bool checkpoint_conflict, uint32_t minimum_block_version,
+    uint32_t median_time_past, uint32_t work_required) const NOEXCEPT
+{
+    if (checkpoint_conflict)
         return error::checkpoints_failed;
 
-    if (version_ < state.minimum_block_version())
+    if (version_ < minimum_block_version)
         return error::invalid_block_version;
 
-    if (timestamp_ <= state.median_time_past())
+    if (timestamp_ <= median_time_past)
         return error::timestamp_too_early;
 
     // This is the only consensus direct comparison of the header.bits value.
     // All other work comparisons performed on expanded/normalized bits values.
-    if (bits_ != state.work_required())
+    if (bits_ != work_required)
         return error::incorrect_proof_of_work;
 
     return error::success;
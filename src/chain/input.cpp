@@ -106,9 +106,7 @@ input::input(const chain::point::cptr& point, const chain::script::cptr& script,
 }
 
 input::input(const data_slice& data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : input(stream::in::copy(data))
-    BC_POP_WARNING()
+  : input(read::bytes::fast(data))
 {
 }
 
@@ -132,6 +130,16 @@ input::input(reader& source) NOEXCEPT
 {
 }
 
+input::input(slice_reader&& source) NOEXCEPT
+  : input(from_data(source))
+{
+}
+
+input::input(slice_reader& source) NOEXCEPT
+  : input(from_data(source))
+{
+}
+
 // protected
 input::input(const chain::point::cptr& point, const chain::script::cptr& script,
     const chain::witness::cptr& witness, uint32_t sequence, bool valid,
@@ -165,7 +173,8 @@ bool input::operator!=(const input& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-input input::from_data(reader& source) NOEXCEPT
+template <typename Source>
+input input::from_data(Source& source) NOEXCEPT
 {
     // Witness is deserialized by transaction.
     return
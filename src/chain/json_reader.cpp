@@ -0,0 +1,710 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/json_reader.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/radix/radix.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Property names match the boost::json convertors (tag_invoke) of each chain
+// object. Each found member sets a bit, all bits are required once parsed.
+
+constexpr bool is_digit(uint8_t character) NOEXCEPT
+{
+    return character >= '0' && character <= '9';
+}
+
+constexpr bool is_space(uint8_t character) NOEXCEPT
+{
+    return character == ' ' || character == '\t' || character == '\n' ||
+        character == '\r';
+}
+
+constexpr bool is_scalar(uint8_t character) NOEXCEPT
+{
+    return is_digit(character) || (character >= 'a' && character <= 'z') ||
+        character == '-' || character == '+' || character == '.' ||
+        character == 'E';
+}
+
+json_reader::json_reader(reader& source) NOEXCEPT
+  : source_(source)
+{
+}
+
+// Chain objects.
+// ----------------------------------------------------------------------------
+
+block json_reader::read_block() NOEXCEPT
+{
+    header::cptr header{};
+    const auto txs = to_shared<transaction_ptrs>();
+
+    const auto on_header = [&](const header::cptr& value) NOEXCEPT
+    {
+        header = value;
+        return true;
+    };
+
+    const auto on_transaction = [&](const transaction::cptr& tx) NOEXCEPT
+    {
+        txs->push_back(tx);
+        return true;
+    };
+
+    if (!read_block(on_header, on_transaction))
+        return {};
+
+    return { header, txs };
+}
+
+bool json_reader::read_block(const header_handler& on_header,
+    const transaction_handler& on_transaction) NOEXCEPT
+{
+    uint8_t found{};
+    const auto parsed = read_object([&](const std::string& name) NOEXCEPT
+    {
+        if (name == "header")
+        {
+            found |= 0x01;
+            const auto header = to_shared(read_header());
+            return source_ && on_header(header);
+        }
+
+        if (name == "transactions")
+        {
+            // Transactions cannot be dispatched until the header is known.
+            if (is_zero(found & 0x01))
+                return false;
+
+            found |= 0x02;
+            return read_array([&]() NOEXCEPT
+            {
+                const auto tx = to_shared(read_transaction());
+                return source_ && on_transaction(tx);
+            });
+        }
+
+        return skip_value();
+    });
+
+    return (parsed && found == 0x03) || fail();
+}
+
+header json_reader::read_header() NOEXCEPT
+{
+    uint8_t found{};
+    uint32_t version{};
+    hash_digest previous{};
+    hash_digest merkle_root{};
+    uint32_t timestamp{};
+    uint32_t bits{};
+    uint32_t nonce{};
+
+    const auto parsed = read_object([&](const std::string& name) NOEXCEPT
+    {
+        if (name == "version")
+        {
+            found |= 0x01;
+            return read_number(version);
+        }
+
+        if (name == "previous")
+        {
+            found |= 0x02;
+            return read_hash(previous);
+        }
+
+        if (name == "merkle_root")
+        {
+            found |= 0x04;
+            return read_hash(merkle_root);
+        }
+
+        if (name == "timestamp")
+        {
+            found |= 0x08;
+            return read_number(timestamp);
+        }
+
+        if (name == "bits")
+        {
+            found |= 0x10;
+            return read_number(bits);
+        }
+
+        if (name == "nonce")
+        {
+            found |= 0x20;
+            return read_number(nonce);
+        }
+
+        return skip_value();
+    });
+
+    if (!parsed || found != 0x3f)
+    {
+        fail();
+        return {};
+    }
+
+    return
+    {
+        version,
+        std::move(previous),
+        std::move(merkle_root),
+        timestamp,
+        bits,
+        nonce
+    };
+}
+
+transaction json_reader::read_transaction() NOEXCEPT
+{
+    uint8_t found{};
+    uint32_t version{};
+    chain::inputs inputs{};
+    chain::outputs outputs{};
+    uint32_t locktime{};
+
+    const auto parsed = read_object([&](const std::string& name) NOEXCEPT
+    {
+        if (name == "version")
+        {
+            found |= 0x01;
+            return read_number(version);
+        }
+
+        if (name == "inputs")
+        {
+            found |= 0x02;
+            return read_array([&]() NOEXCEPT
+            {
+                inputs.push_back(read_input());
+                return !!source_;
+            });
+        }
+
+        if (name == "outputs")
+        {
+            found |= 0x04;
+            return read_array([&]() NOEXCEPT
+            {
+                outputs.push_back(read_output());
+                return !!source_;
+            });
+        }
+
+        if (name == "locktime")
+        {
+            found |= 0x08;
+            return read_number(locktime);
+        }
+
+        return skip_value();
+    });
+
+    if (!parsed || found != 0x0f)
+    {
+        fail();
+        return {};
+    }
+
+    return { version, std::move(inputs), std::move(outputs), locktime };
+}
+
+input json_reader::read_input() NOEXCEPT
+{
+    uint8_t found{};
+    chain::point point{};
+    chain::script script{};
+    chain::witness witness{};
+    uint32_t sequence{};
+
+    const auto parsed = read_object([&](const std::string& name) NOEXCEPT
+    {
+        if (name == "point")
+        {
+            found |= 0x01;
+            point = read_point();
+            return !!source_;
+        }
+
+        if (name == "script")
+        {
+            found |= 0x02;
+            script = read_script();
+            return !!source_;
+        }
+
+        if (name == "witness")
+        {
+            found |= 0x04;
+            witness = read_witness();
+            return !!source_;
+        }
+
+        if (name == "sequence")
+        {
+            found |= 0x08;
+            return read_number(sequence);
+        }
+
+        return skip_value();
+    });
+
+    if (!parsed || found != 0x0f)
+    {
+        fail();
+        return {};
+    }
+
+    return
+    {
+        std::move(point),
+        std::move(script),
+        std::move(witness),
+        sequence
+    };
+}
+
+output json_reader::read_output() NOEXCEPT
+{
+    uint8_t found{};
+    uint64_t value{};
+    chain::script script{};
+
+    const auto parsed = read_object([&](const std::string& name) NOEXCEPT
+    {
+        if (name == "value")
+        {
+            found |= 0x01;
+            return read_number(value);
+        }
+
+        if (name == "script")
+        {
+            found |= 0x02;
+            script = read_script();
+            return !!source_;
+        }
+
+        return skip_value();
+    });
+
+    if (!parsed || found != 0x03)
+    {
+        fail();
+        return {};
+    }
+
+    return { value, std::move(script) };
+}
+
+point json_reader::read_point() NOEXCEPT
+{
+    uint8_t found{};
+    hash_digest hash{};
+    uint32_t index{};
+
+    const auto parsed = read_object([&](const std::string& name) NOEXCEPT
+    {
+        if (name == "hash")
+        {
+            found |= 0x01;
+            return read_hash(hash);
+        }
+
+        if (name == "index")
+        {
+            found |= 0x02;
+            return read_number(index);
+        }
+
+        return skip_value();
+    });
+
+    if (!parsed || found != 0x03)
+    {
+        fail();
+        return {};
+    }
+
+    return { std::move(hash), index };
+}
+
+script json_reader::read_script() NOEXCEPT
+{
+    std::string text{};
+    if (!read_string(text))
+        return {};
+
+    return script{ text };
+}
+
+witness json_reader::read_witness() NOEXCEPT
+{
+    std::string text{};
+    if (!read_string(text))
+        return {};
+
+    return witness{ text };
+}
+
+// Source.
+// ----------------------------------------------------------------------------
+
+json_reader::operator bool() const NOEXCEPT
+{
+    return source_;
+}
+
+bool json_reader::operator!() const NOEXCEPT
+{
+    return !source_;
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+bool json_reader::read_object(const member_handler& on_member) NOEXCEPT
+{
+    if (!read_literal('{'))
+        return false;
+
+    if (peek_token() == '}')
+    {
+        source_.skip_byte();
+        return true;
+    }
+
+    std::string name{};
+    while (true)
+    {
+        if (!read_string(name) || !read_literal(':') || !on_member(name))
+            return fail();
+
+        const auto token = peek_token();
+        source_.skip_byte();
+        if (token == '}')
+            return true;
+
+        if (token != ',')
+            return fail();
+    }
+}
+
+bool json_reader::read_array(const element_handler& on_element) NOEXCEPT
+{
+    if (!read_literal('['))
+        return false;
+
+    if (peek_token() == ']')
+    {
+        source_.skip_byte();
+        return true;
+    }
+
+    while (true)
+    {
+        if (!on_element())
+            return fail();
+
+        const auto token = peek_token();
+        source_.skip_byte();
+        if (token == ']')
+            return true;
+
+        if (token != ',')
+            return fail();
+    }
+}
+
+bool json_reader::read_string(std::string& out) NOEXCEPT
+{
+    if (!read_literal('"'))
+        return false;
+
+    out.clear();
+    while (true)
+    {
+        const auto character = source_.read_byte();
+        if (!source_ || character < 0x20)
+            return fail();
+
+        if (character == '"')
+            return true;
+
+        if (character == '\\')
+        {
+            if (!read_escape(out))
+                return false;
+        }
+        else
+        {
+            out.push_back(static_cast<char>(character));
+        }
+    }
+}
+
+// Numbers are unsigned integers (as produced by the convertors).
+bool json_reader::read_number(uint64_t& out) NOEXCEPT
+{
+    if (!is_digit(peek_token()))
+        return fail();
+
+    out = zero;
+    size_t digits{};
+    const auto leading = source_.peek_byte();
+    while (is_digit(source_.peek_byte()))
+    {
+        const uint64_t digit = source_.read_byte() - '0';
+        if (out > (max_uint64 - digit) / 10u)
+            return fail();
+
+        out = out * 10u + digit;
+        ++digits;
+    }
+
+    // Leading zeros, fractions and exponents are not integers.
+    const auto next = source_.peek_byte();
+    if ((leading == '0' && digits > one) || next == '.' || next == 'e' ||
+        next == 'E')
+        return fail();
+
+    return true;
+}
+
+bool json_reader::read_number(uint32_t& out) NOEXCEPT
+{
+    uint64_t value{};
+    if (!read_number(value) || value > max_uint32)
+        return fail();
+
+    out = narrow_cast<uint32_t>(value);
+    return true;
+}
+
+bool json_reader::read_hash(hash_digest& out) NOEXCEPT
+{
+    std::string text{};
+    return read_string(text) && (decode_hash(out, text) || fail());
+}
+
+bool json_reader::skip_value() NOEXCEPT
+{
+    const auto token = peek_token();
+    if (token == '{' || token == '[')
+        return skip_container();
+
+    if (token == '"')
+    {
+        std::string ignored{};
+        return read_string(ignored);
+    }
+
+    if (!is_scalar(token))
+        return fail();
+
+    while (is_scalar(source_.peek_byte()))
+        source_.skip_byte();
+
+    return true;
+}
+
+bool json_reader::read_literal(char expected) NOEXCEPT
+{
+    skip_space();
+    return source_.read_byte() == static_cast<uint8_t>(expected) || fail();
+}
+
+uint8_t json_reader::peek_token() NOEXCEPT
+{
+    skip_space();
+    return source_.peek_byte();
+}
+
+bool json_reader::fail() NOEXCEPT
+{
+    source_.invalidate();
+    return false;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+bool json_reader::read_escape(std::string& out) NOEXCEPT
+{
+    switch (source_.read_byte())
+    {
+        case '"': out.push_back('"'); return true;
+        case '\\': out.push_back('\\'); return true;
+        case '/': out.push_back('/'); return true;
+        case 'b': out.push_back('\b'); return true;
+        case 'f': out.push_back('\f'); return true;
+        case 'n': out.push_back('\n'); return true;
+        case 'r': out.push_back('\r'); return true;
+        case 't': out.push_back('\t'); return true;
+        case 'u': break;
+        default: return fail();
+    }
+
+    uint32_t point{};
+    if (!read_code_point(point))
+        return false;
+
+    // A high surrogate must be followed by an escaped low surrogate.
+    if (point >= 0xd800 && point <= 0xdbff)
+    {
+        uint32_t low{};
+        if (source_.read_byte() != '\\' || source_.read_byte() != 'u' ||
+            !read_code_point(low) || low < 0xdc00 || low > 0xdfff)
+            return fail();
+
+        point = 0x10000 + (((point - 0xd800) << 10) | (low - 0xdc00));
+    }
+    else if (point >= 0xdc00 && point <= 0xdfff)
+    {
+        return fail();
+    }
+
+    // UTF8 encoding of the code point.
+    if (point < 0x80)
+    {
+        out.push_back(static_cast<char>(point));
+    }
+    else if (point < 0x800)
+    {
+        out.push_back(static_cast<char>(0xc0 | (point >> 6)));
+        out.push_back(static_cast<char>(0x80 | (point & 0x3f)));
+    }
+    else if (point < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xe0 | (point >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((point >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (point & 0x3f)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xf0 | (point >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((point >> 12) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | ((point >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (point & 0x3f)));
+    }
+
+    return true;
+}
+
+bool json_reader::read_code_point(uint32_t& out) NOEXCEPT
+{
+    out = 0;
+    for (auto digit = 0; digit < 4; ++digit)
+    {
+        const auto character = source_.read_byte();
+        uint32_t value{};
+        if (is_digit(character))
+            value = character - '0';
+        else if (character >= 'a' && character <= 'f')
+            value = character - 'a' + 10u;
+        else if (character >= 'A' && character <= 'F')
+            value = character - 'A' + 10u;
+        else
+            return fail();
+
+        out = (out << 4) | value;
+    }
+
+    return true;
+}
+
+// Iterative, so that nesting depth does not consume the call stack.
+// Container structure is checked but delimiter placement is not.
+bool json_reader::skip_container() NOEXCEPT
+{
+    std::string closers{};
+    std::string ignored{};
+
+    do
+    {
+        const auto token = peek_token();
+        switch (token)
+        {
+            case '{':
+                source_.skip_byte();
+                closers.push_back('}');
+                break;
+            case '[':
+                source_.skip_byte();
+                closers.push_back(']');
+                break;
+            case '}':
+            case ']':
+                if (closers.empty() ||
+                    static_cast<uint8_t>(closers.back()) != token)
+                    return fail();
+
+                source_.skip_byte();
+                closers.pop_back();
+                break;
+            case '"':
+                if (!read_string(ignored))
+                    return false;
+
+                break;
+            case ',':
+            case ':':
+                source_.skip_byte();
+                break;
+            default:
+                if (!is_scalar(token))
+                    return fail();
+
+                while (is_scalar(source_.peek_byte()))
+                    source_.skip_byte();
+        }
+    } while (!closers.empty());
+
+    return true;
+}
+
+void json_reader::skip_space() NOEXCEPT
+{
+    while (source_ && is_space(source_.peek_byte()))
+        source_.skip_byte();
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,295 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/json_writer.hpp>
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/forks.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Property names and delimiters match the boost::json convertors (tag_invoke)
+// of each chain object, which produce compact (whitespace-free) output.
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+constexpr char hex_digits[] = "0123456789abcdef";
+
+json_writer::json_writer(writer& sink) NOEXCEPT
+  : sink_(sink)
+{
+}
+
+// Chain objects.
+// ----------------------------------------------------------------------------
+
+void json_writer::write(const block& block) NOEXCEPT
+{
+    write_text("{\"header\":");
+    write(block.header());
+    write_text(",\"transactions\":[");
+
+    auto first = true;
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        if (!first) write_text(",");
+        write(*tx);
+        first = false;
+    }
+
+    write_text("]}");
+}
+
+void json_writer::write(const header& header) NOEXCEPT
+{
+    write_text("{\"version\":");
+    write_number(header.version());
+    write_text(",\"previous\":");
+    write_hash(header.previous_block_hash());
+    write_text(",\"merkle_root\":");
+    write_hash(header.merkle_root());
+    write_text(",\"timestamp\":");
+    write_number(header.timestamp());
+    write_text(",\"bits\":");
+    write_number(header.bits());
+    write_text(",\"nonce\":");
+    write_number(header.nonce());
+    write_text("}");
+}
+
+void json_writer::write(const transaction& tx) NOEXCEPT
+{
+    write_text("{\"version\":");
+    write_number(tx.version());
+    write_text(",\"inputs\":[");
+
+    auto first = true;
+    for (const auto& input: *tx.inputs_ptr())
+    {
+        if (!first) write_text(",");
+        write(*input);
+        first = false;
+    }
+
+    write_text("],\"outputs\":[");
+
+    first = true;
+    for (const auto& output: *tx.outputs_ptr())
+    {
+        if (!first) write_text(",");
+        write(*output);
+        first = false;
+    }
+
+    write_text("],\"locktime\":");
+    write_number(tx.locktime());
+    write_text("}");
+}
+
+void json_writer::write(const input& input) NOEXCEPT
+{
+    write_text("{\"point\":");
+    write(input.point());
+    write_text(",\"script\":");
+    write(input.script());
+    write_text(",\"witness\":");
+    write(input.witness());
+    write_text(",\"sequence\":");
+    write_number(input.sequence());
+    write_text("}");
+}
+
+void json_writer::write(const output& output) NOEXCEPT
+{
+    write_text("{\"value\":");
+    write_number(output.value());
+    write_text(",\"script\":");
+    write(output.script());
+    write_text("}");
+}
+
+void json_writer::write(const point& point) NOEXCEPT
+{
+    write_text("{\"hash\":");
+    write_hash(point.hash());
+    write_text(",\"index\":");
+    write_number(point.index());
+    write_text("}");
+}
+
+void json_writer::write(const script& script) NOEXCEPT
+{
+    write_string(script.to_string(forks::all_rules));
+}
+
+void json_writer::write(const witness& witness) NOEXCEPT
+{
+    write_string(witness.to_string());
+}
+
+// Sink.
+// ----------------------------------------------------------------------------
+
+void json_writer::flush() NOEXCEPT
+{
+    sink_.flush();
+}
+
+json_writer::operator bool() const NOEXCEPT
+{
+    return sink_;
+}
+
+bool json_writer::operator!() const NOEXCEPT
+{
+    return !sink_;
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+void json_writer::write_text(const std::string_view& text) NOEXCEPT
+{
+    sink_.write_bytes(pointer_cast<const uint8_t>(text.data()), text.size());
+}
+
+void json_writer::write_number(uint64_t value) NOEXCEPT
+{
+    // Sufficient for max_uint64 (20 decimal digits).
+    char buffer[20]{};
+    const auto end = std::to_chars(&buffer[0], &buffer[20], value).ptr;
+    write_text({ &buffer[0], to_unsigned(std::distance(&buffer[0], end)) });
+}
+
+// Hashes are encoded in reversed byte order (as encode_hash).
+void json_writer::write_hash(const hash_digest& hash) NOEXCEPT
+{
+    char buffer[add1(add1(two * hash_size))]{};
+    auto out = &buffer[0];
+    *out++ = '"';
+
+    for (auto byte = hash.rbegin(); byte != hash.rend(); ++byte)
+    {
+        *out++ = hex_digits[shift_right(*byte, 4u)];
+        *out++ = hex_digits[bit_and<uint8_t>(*byte, 0x0f)];
+    }
+
+    *out = '"';
+    write_text({ &buffer[0], sizeof(buffer) });
+}
+
+// Escaping matches boost::json::serialize (quote, backslash and controls).
+void json_writer::write_string(const std::string& text) NOEXCEPT
+{
+    write_text("\"");
+
+    auto run = text.begin();
+    for (auto it = text.begin(); it != text.end(); ++it)
+    {
+        const auto character = static_cast<uint8_t>(*it);
+        if (character != '"' && character != '\\' && character >= 0x20)
+            continue;
+
+        write_text({ run, it });
+        run = std::next(it);
+
+        switch (character)
+        {
+            case '"': write_text("\\\""); break;
+            case '\\': write_text("\\\\"); break;
+            case '\b': write_text("\\b"); break;
+            case '\f': write_text("\\f"); break;
+            case '\n': write_text("\\n"); break;
+            case '\r': write_text("\\r"); break;
+            case '\t': write_text("\\t"); break;
+            default:
+            {
+                const char escape[]
+                {
+                    '\\', 'u', '0', '0',
+                    hex_digits[shift_right(character, 4u)],
+                    hex_digits[bit_and<uint8_t>(character, 0x0f)]
+                };
+
+                write_text({ &escape[0], sizeof(escape) });
+            }
+        }
+    }
+
+    write_text({ run, text.end() });
+    write_text("\"");
+}
+
+BC_POP_WARNING()
+
+// Text serialization.
+// ----------------------------------------------------------------------------
+
+template <typename Object>
+static std::string to_text(const Object& object) NOEXCEPT
+{
+    std::string out{};
+    write::bytes::text sink(out);
+    json_writer(sink).write(object);
+    sink.flush();
+    return out;
+}
+
+std::string to_json(const block& block) NOEXCEPT
+{
+    return to_text(block);
+}
+
+std::string to_json(const header& header) NOEXCEPT
+{
+    return to_text(header);
+}
+
+std::string to_json(const transaction& tx) NOEXCEPT
+{
+    return to_text(tx);
+}
+
+std::string to_json(const input& input) NOEXCEPT
+{
+    return to_text(input);
+}
+
+std::string to_json(const output& output) NOEXCEPT
+{
+    return to_text(output);
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
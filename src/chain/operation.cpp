@@ -82,9 +82,7 @@ operation::operation(const chunk_cptr& push_data, bool minimal) NOEXCEPT
 }
 
 operation::operation(const data_slice& op_data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : operation(stream::in::copy(op_data))
-    BC_POP_WARNING()
+  : operation(read::bytes::fast(op_data))
 {
 }
 
@@ -108,6 +106,16 @@ operation::operation(reader& source) NOEXCEPT
 {
 }
 
+operation::operation(slice_reader&& source) NOEXCEPT
+  : operation(from_data(source))
+{
+}
+
+operation::operation(slice_reader& source) NOEXCEPT
+  : operation(from_data(source))
+{
+}
+
 operation::operation(const std::string& mnemonic) NOEXCEPT
   : operation(from_string(mnemonic))
 {
@@ -139,7 +147,8 @@ bool operation::operator!=(const operation& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-operation operation::from_data(reader& source) NOEXCEPT
+template <typename Source>
+operation operation::from_data(Source& source) NOEXCEPT
 {
     // Guard against resetting a previously-invalid stream.
     if (!source)
@@ -476,21 +485,8 @@ size_t operation::serialized_size() const NOEXCEPT
 // Utilities.
 // ----------------------------------------------------------------------------
 
-// static/private
-// Advances stream, returns true unless exhausted.
-// Does not advance to end position in the case of underflow operation.
-bool operation::count_op(reader& source) NOEXCEPT
-{
-    if (source.is_exhausted())
-        return false;
-
-    const auto code = static_cast<opcode>(source.read_byte());
-    source.skip_bytes(read_data_size(code, source));
-    return true;
-}
-
-// static/private
-uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
+template <typename Source>
+static uint32_t do_read_data_size(opcode code, Source& source) NOEXCEPT
 {
     constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
 
@@ -508,6 +504,43 @@ uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
     }
 }
 
+// Advances stream, returns true unless exhausted.
+// Does not advance to end position in the case of underflow operation.
+template <typename Source>
+static bool do_count_op(Source& source) NOEXCEPT
+{
+    if (source.is_exhausted())
+        return false;
+
+    const auto code = static_cast<opcode>(source.read_byte());
+    source.skip_bytes(do_read_data_size(code, source));
+    return true;
+}
+
+// static/private
+bool operation::count_op(reader& source) NOEXCEPT
+{
+    return do_count_op(source);
+}
+
+// static/private
+bool operation::count_op(slice_reader& source) NOEXCEPT
+{
+    return do_count_op(source);
+}
+
+// static/private
+uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
+{
+    return do_read_data_size(code, source);
+}
+
+// static/private
+uint32_t operation::read_data_size(opcode code, slice_reader& source) NOEXCEPT
+{
+    return do_read_data_size(code, source);
+}
+
 // Categories of operations.
 // ----------------------------------------------------------------------------
 
@@ -59,9 +59,7 @@ output::output(uint64_t value, const chain::script::cptr& script) NOEXCEPT
 }
 
 output::output(const data_slice& data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : output(stream::in::copy(data))
-    BC_POP_WARNING()
+  : output(read::bytes::fast(data))
 {
 }
 
@@ -85,6 +83,16 @@ output::output(reader& source) NOEXCEPT
 {
 }
 
+output::output(slice_reader&& source) NOEXCEPT
+  : output(from_data(source))
+{
+}
+
+output::output(slice_reader& source) NOEXCEPT
+  : output(from_data(source))
+{
+}
+
 // protected
 output::output(uint64_t value, const chain::script::cptr& script,
     bool valid) NOEXCEPT
@@ -110,7 +118,8 @@ bool output::operator!=(const output& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-output output::from_data(reader& source) NOEXCEPT
+template <typename Source>
+output output::from_data(Source& source) NOEXCEPT
 {
     return
     {
@@ -52,9 +52,7 @@ point::point(const hash_digest& hash, uint32_t index) NOEXCEPT
 }
 
 point::point(const data_slice& data) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : point(stream::in::copy(data))
-    BC_POP_WARNING()
+  : point(read::bytes::fast(data))
 {
 }
 
@@ -78,6 +76,16 @@ point::point(reader& source) NOEXCEPT
 {
 }
 
+point::point(slice_reader&& source) NOEXCEPT
+  : point(from_data(source))
+{
+}
+
+point::point(slice_reader& source) NOEXCEPT
+  : point(from_data(source))
+{
+}
+
 // protected
 point::point(hash_digest&& hash, uint32_t index, bool valid) NOEXCEPT
   : hash_(std::move(hash)), index_(index), valid_(valid)
@@ -115,7 +123,8 @@ bool operator<(const point& left, const point& right) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-point point::from_data(reader& source) NOEXCEPT
+template <typename Source>
+point point::from_data(Source& source) NOEXCEPT
 {
     return
     {
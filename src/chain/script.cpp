@@ -103,9 +103,7 @@ script::script(const operations& ops, bool prefail) NOEXCEPT
 }
 
 script::script(const data_slice& data, bool prefix) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : script(stream::in::copy(data), prefix)
-    BC_POP_WARNING()
+  : script(read::bytes::fast(data), prefix)
 {
 }
 
@@ -129,6 +127,16 @@ script::script(reader& source, bool prefix) NOEXCEPT
 {
 }
 
+script::script(slice_reader&& source, bool prefix) NOEXCEPT
+  : script(from_data(source, prefix))
+{
+}
+
+script::script(slice_reader& source, bool prefix) NOEXCEPT
+  : script(from_data(source, prefix))
+{
+}
+
 script::script(const std::string& mnemonic) NOEXCEPT
   : script(from_string(mnemonic))
 {
@@ -136,13 +144,15 @@ script::script(const std::string& mnemonic) NOEXCEPT
 
 // protected
 script::script(operations&& ops, bool valid, bool prefail) NOEXCEPT
-  : ops_(std::move(ops)), valid_(valid), prefail_(prefail), offset(ops_.begin())
+  : ops_(std::move(ops)), valid_(valid), prefail_(prefail),
+    size_(operations_size(ops_.begin(), ops_.end())), offset(ops_.begin())
 {
 }
 
 // protected
 script::script(const operations& ops, bool valid, bool prefail) NOEXCEPT
-  : ops_(ops), valid_(valid), prefail_(prefail), offset(ops_.begin())
+  : ops_(ops), valid_(valid), prefail_(prefail),
+    size_(operations_size(ops_.begin(), ops_.end())), offset(ops_.begin())
 {
 }
 
@@ -154,6 +164,7 @@ script& script::operator=(script&& other) NOEXCEPT
     ops_ = std::move(other.ops_);
     valid_ = other.valid_;
     prefail_ = other.prefail_;
+    size_ = other.size_;
     offset = ops_.begin();
     return *this;
 }
@@ -163,6 +174,7 @@ script& script::operator=(const script& other) NOEXCEPT
     ops_ = other.ops_;
     valid_ = other.valid_;
     prefail_ = other.prefail_;
+    size_ = other.size_;
     offset = ops_.begin();
     return *this;
 }
@@ -181,7 +193,8 @@ bool script::operator!=(const script& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-size_t script::op_count(reader& source) NOEXCEPT
+template <typename Source>
+size_t script::op_count(Source& source) NOEXCEPT
 {
     const auto start = source.get_position();
     auto count = zero;
@@ -195,7 +208,8 @@ size_t script::op_count(reader& source) NOEXCEPT
 }
 
 // static/private
-script script::from_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+script script::from_data(Source& source, bool prefix) NOEXCEPT
 {
     auto size = zero;
     auto start = zero;
@@ -266,13 +280,10 @@ script script::from_string(const std::string& mnemonic) NOEXCEPT
 
 data_chunk script::to_data(bool prefix) const NOEXCEPT
 {
+    // Exactly sized (cached), written without a stream.
     data_chunk data(serialized_size(prefix));
-
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream::out::copy ostream(data);
-    BC_POP_WARNING()
-
-    to_data(ostream, prefix);
+    write::bytes::fast sink(data);
+    to_data(sink, prefix);
     return data;
 }
 
@@ -347,14 +358,10 @@ hash_digest script::hash() const NOEXCEPT
 
 size_t script::serialized_size(bool prefix) const NOEXCEPT
 {
-    const auto op_size = [](size_t total, const operation& op) NOEXCEPT
-    {
-        return total + op.serialized_size();
-    };
-
     // Data serialization is affected by offset metadata.
     ////auto size = std::accumulate(ops_.begin(), ops_.end(), zero, op_size);
-    auto size = std::accumulate(offset, ops_.end(), zero, op_size);
+    auto size = (offset == ops_.begin()) ? size_ :
+        operations_size(offset, ops_.end());
 
     if (prefix)
         size += variable_size(size);
@@ -362,6 +369,18 @@ size_t script::serialized_size(bool prefix) const NOEXCEPT
     return size;
 }
 
+// static/private
+size_t script::operations_size(const iterator& begin,
+    const iterator& end) NOEXCEPT
+{
+    const auto op_size = [](size_t total, const operation& op) NOEXCEPT
+    {
+        return total + op.serialized_size();
+    };
+
+    return std::accumulate(begin, end, zero, op_size);
+}
+
 // Utilities.
 // ----------------------------------------------------------------------------
 
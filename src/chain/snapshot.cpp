@@ -0,0 +1,473 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/snapshot.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <ios>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+#include <bitcoin/system/unicode/utf8_everywhere/environment.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+using namespace boost::iostreams;
+
+// Transaction flags.
+constexpr uint8_t flag_segregated = 0x01;
+
+// Script flags.
+constexpr uint8_t flag_prefail = 0x01;
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+snapshot::snapshot(const std::filesystem::path& path) NOEXCEPT
+  : file_(), index_(), valid_(false)
+{
+    // An empty file cannot be mapped, but is a valid file of no records.
+    std::error_code ec;
+    const auto length = std::filesystem::file_size(to_extended_path(path), ec);
+    if (ec)
+        return;
+
+    if (is_zero(length))
+    {
+        valid_ = true;
+        return;
+    }
+
+    // mapped_file_source does not honor BOOST_EXCEPTION_DISABLE.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    try
+    {
+        file_ = std::make_shared<mapped_file_source>(to_extended_path(path));
+    }
+    catch (const std::ios_base::failure&)
+    {
+        file_.reset();
+        return;
+    }
+    BC_POP_WARNING()
+
+    valid_ = split();
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool snapshot::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+size_t snapshot::size() const NOEXCEPT
+{
+    return file_ ? file_->size() : zero;
+}
+
+const snapshot::records& snapshot::index() const NOEXCEPT
+{
+    return index_;
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+transaction::cptr snapshot::get_transaction(size_t index) const NOEXCEPT
+{
+    if (index >= index_.size() || index_.at(index).kind != kind::transaction)
+        return {};
+
+    read::bytes::fast source(at(index));
+    const auto tx = read_transaction(source);
+    return source.is_exhausted() ? tx : nullptr;
+}
+
+block::cptr snapshot::get_block(size_t index) const NOEXCEPT
+{
+    if (index >= index_.size() || index_.at(index).kind != kind::block)
+        return {};
+
+    read::bytes::fast source(at(index));
+    const auto header = to_shared(chain::header{ source });
+    const auto txs = to_shared<transaction_ptrs>();
+
+    // Subsequent emplace is non-allocating, but still THROWS.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    txs->reserve(source.read_size(max_block_size));
+    BC_POP_WARNING()
+
+    for (auto tx = zero; tx < txs->capacity(); ++tx)
+    {
+        const auto value = read_transaction(source);
+        if (!value)
+            return {};
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        txs->push_back(value);
+        BC_POP_WARNING()
+    }
+
+    if (!source.is_exhausted())
+        return {};
+
+    return to_shared(block{ header, txs });
+}
+
+bool snapshot::scan(const block_handler& on_block,
+    const transaction_handler& on_transaction, size_t batch) const NOEXCEPT
+{
+    struct loaded
+    {
+        block::cptr block_ptr;
+        transaction::cptr tx_ptr;
+    };
+
+    const auto load = [&](size_t position) NOEXCEPT
+    {
+        return index_.at(position).kind == kind::block ?
+            loaded{ get_block(position), {} } :
+            loaded{ {}, get_transaction(position) };
+    };
+
+    // At most one batch of objects is retained at any time (plus any
+    // retained by the handlers).
+    const auto count = std::max(batch, one);
+    std::vector<size_t> positions(std::min(count, index_.size()));
+    std::vector<loaded> objects(positions.size());
+
+    for (size_t first = zero; first < index_.size(); first += count)
+    {
+        const auto size = std::min(count, index_.size() - first);
+        positions.resize(size);
+        objects.resize(size);
+        std::iota(positions.begin(), positions.end(), first);
+        std_transform(bc::par_unseq, positions.begin(), positions.end(),
+            objects.begin(), load);
+
+        for (size_t offset = zero; offset < size; ++offset)
+        {
+            const auto position = first + offset;
+            const auto sigops = index_.at(position).sigops;
+            const auto& item = objects.at(offset);
+
+            if (item.block_ptr)
+            {
+                if (!on_block(item.block_ptr, sigops, position))
+                    return false;
+            }
+            else if (item.tx_ptr)
+            {
+                if (!on_transaction(item.tx_ptr, sigops, position))
+                    return false;
+            }
+            else
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Serialization.
+// ----------------------------------------------------------------------------
+
+void snapshot::write_prefix(writer& sink) NOEXCEPT
+{
+    sink.write_4_bytes_little_endian(magic);
+    sink.write_4_bytes_little_endian(version);
+}
+
+void snapshot::write(writer& sink, const transaction& tx,
+    size_t sigops) NOEXCEPT
+{
+    data_chunk body{};
+    write::bytes::data out(body);
+    write_transaction(out, tx);
+    out.flush();
+
+    write_record(sink, kind::transaction, sigops, body);
+}
+
+void snapshot::write(writer& sink, const block& block,
+    size_t sigops) NOEXCEPT
+{
+    data_chunk body{};
+    write::bytes::data out(body);
+    block.header().to_data(out);
+    out.write_variable(block.transactions_ptr()->size());
+    for (const auto& tx: *block.transactions_ptr())
+        write_transaction(out, *tx);
+
+    out.flush();
+    write_record(sink, kind::block, sigops, body);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+void snapshot::write_record(writer& sink, kind type, size_t sigops,
+    const data_chunk& body) NOEXCEPT
+{
+    sink.write_byte(static_cast<uint8_t>(type));
+    sink.write_4_bytes_little_endian(possible_narrow_cast<uint32_t>(
+        body.size()));
+    sink.write_4_bytes_little_endian(possible_narrow_cast<uint32_t>(sigops));
+    sink.write_bytes(body);
+}
+
+// Identity hashes and sizes precede the transaction, as the cached values.
+void snapshot::write_transaction(writer& sink,
+    const transaction& tx) NOEXCEPT
+{
+    sink.write_bytes(tx.hash(false));
+    sink.write_bytes(tx.hash(true));
+    sink.write_4_bytes_little_endian(possible_narrow_cast<uint32_t>(
+        tx.nominal_size_));
+    sink.write_4_bytes_little_endian(possible_narrow_cast<uint32_t>(
+        tx.witness_size_));
+    sink.write_byte(tx.segregated_ ? flag_segregated : 0x00);
+    sink.write_4_bytes_little_endian(tx.version_);
+    sink.write_4_bytes_little_endian(tx.locktime_);
+
+    sink.write_variable(tx.inputs_->size());
+    for (const auto& input: *tx.inputs_)
+    {
+        sink.write_bytes(input->point().hash());
+        sink.write_4_bytes_little_endian(input->point().index());
+        sink.write_4_bytes_little_endian(input->sequence());
+        write_script(sink, input->script());
+        write_witness(sink, input->witness());
+    }
+
+    sink.write_variable(tx.outputs_->size());
+    for (const auto& output: *tx.outputs_)
+    {
+        sink.write_8_bytes_little_endian(output->value());
+        write_script(sink, output->script());
+    }
+}
+
+// Operations are written as (opcode, underflow, data), so that no opcode is
+// interpreted when read.
+void snapshot::write_script(writer& sink, const script& script) NOEXCEPT
+{
+    sink.write_byte(script.is_prefail() ? flag_prefail : 0x00);
+    sink.write_variable(script.ops().size());
+    for (const auto& op: script.ops())
+    {
+        sink.write_byte(static_cast<uint8_t>(op.code()));
+        sink.write_byte(op.is_underflow() ? 0x01 : 0x00);
+        sink.write_variable(op.data().size());
+        sink.write_bytes(op.data());
+    }
+}
+
+void snapshot::write_witness(writer& sink, const witness& witness) NOEXCEPT
+{
+    sink.write_variable(witness.stack().size());
+    for (const auto& element: witness.stack())
+    {
+        sink.write_variable(element->size());
+        sink.write_bytes(*element);
+    }
+}
+
+transaction::cptr snapshot::read_transaction(slice_reader& source) NOEXCEPT
+{
+    const auto txid = source.read_hash();
+    const auto wtxid = source.read_hash();
+    const auto nominal_size = source.read_4_bytes_little_endian();
+    const auto witness_size = source.read_4_bytes_little_endian();
+    const auto segregated = to_bool(source.read_byte() & flag_segregated);
+    const auto version = source.read_4_bytes_little_endian();
+    const auto locktime = source.read_4_bytes_little_endian();
+
+    const auto inputs = to_shared<input_cptrs>();
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    inputs->reserve(source.read_size(max_block_size));
+    BC_POP_WARNING()
+
+    for (auto in = zero; in < inputs->capacity(); ++in)
+    {
+        auto hash = source.read_hash();
+        const auto index = source.read_4_bytes_little_endian();
+        const auto sequence = source.read_4_bytes_little_endian();
+        const auto script = read_script(source);
+        const auto witness = read_witness(source);
+        if (!source)
+            return {};
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        inputs->push_back(to_shared(input
+        {
+            to_shared(point{ std::move(hash), index }), script, witness,
+            sequence
+        }));
+        BC_POP_WARNING()
+    }
+
+    const auto outputs = to_shared<output_cptrs>();
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    outputs->reserve(source.read_size(max_block_size));
+    BC_POP_WARNING()
+
+    for (auto out = zero; out < outputs->capacity(); ++out)
+    {
+        const auto value = source.read_8_bytes_little_endian();
+        const auto script = read_script(source);
+        if (!source)
+            return {};
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        outputs->push_back(to_shared(output{ value, script }));
+        BC_POP_WARNING()
+    }
+
+    if (!source)
+        return {};
+
+    // Sizes are restored, not recomputed.
+    transaction tx
+    {
+        version, inputs, outputs, locktime, segregated, true, nominal_size,
+        witness_size
+    };
+
+    // The witness hash is cached only if segregated (as deserialization).
+    tx.nominal_hash_ = to_shared(txid);
+    if (segregated)
+        tx.witness_hash_ = to_shared(wtxid);
+
+    return to_shared(std::move(tx));
+}
+
+script::cptr snapshot::read_script(slice_reader& source) NOEXCEPT
+{
+    const auto prefail = to_bool(source.read_byte() & flag_prefail);
+
+    operations ops{};
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    ops.reserve(source.read_size(max_block_size));
+    BC_POP_WARNING()
+
+    for (auto op = zero; op < ops.capacity(); ++op)
+    {
+        const auto code = static_cast<opcode>(source.read_byte());
+        const auto underflow = to_bool(source.read_byte());
+        const auto size = source.read_size(max_block_size);
+        const auto data = is_zero(size) ? operation::no_data_ptr() :
+            to_shared(source.read_bytes(size));
+
+        if (!source)
+            return {};
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        ops.push_back(operation{ code, data, underflow });
+        BC_POP_WARNING()
+    }
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    return to_shared(new script{ std::move(ops), true, prefail });
+    BC_POP_WARNING()
+}
+
+witness::cptr snapshot::read_witness(slice_reader& source) NOEXCEPT
+{
+    chunk_cptrs stack{};
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stack.reserve(source.read_size(max_block_size));
+    BC_POP_WARNING()
+
+    for (auto element = zero; element < stack.capacity(); ++element)
+    {
+        const auto size = source.read_size(max_block_size);
+        if (!source)
+            return {};
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        stack.push_back(to_shared(source.read_bytes(size)));
+        BC_POP_WARNING()
+    }
+
+    return to_shared(witness{ std::move(stack) });
+}
+
+data_slice snapshot::at(size_t index) const NOEXCEPT
+{
+    const auto begin = pointer_cast<const uint8_t>(file_->data());
+
+    const auto& item = index_.at(index);
+    const auto first = std::next(begin, item.offset);
+    return { first, std::next(first, item.size) };
+}
+
+bool snapshot::split() NOEXCEPT
+{
+    const auto begin = pointer_cast<const uint8_t>(file_->data());
+
+    const data_slice data{ begin, std::next(begin, file_->size()) };
+    read::bytes::fast source(data);
+
+    if (source.read_4_bytes_little_endian() != magic ||
+        source.read_4_bytes_little_endian() != version)
+        return false;
+
+    while (!source.is_exhausted())
+    {
+        const auto type = static_cast<kind>(source.read_byte());
+        const auto size = source.read_4_bytes_little_endian();
+        const auto sigops = source.read_4_bytes_little_endian();
+        if (!source || (type != kind::transaction && type != kind::block))
+            return false;
+
+        const auto offset = source.get_position();
+        source.skip_bytes(size);
+        if (!source)
+            return false;
+
+        index_.push_back({ type, sigops, offset, size });
+    }
+
+    return true;
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -86,7 +86,8 @@ transaction::transaction(transaction&& other) NOEXCEPT
 {
 }
 
-// Cache not copied or moved.
+// Signature hash cache (cache_) is not copied, it is rebuilt on demand.
+// Identity hashes (nominal_hash_, witness_hash_) are shared, sizes copied.
 transaction::transaction(const transaction& other) NOEXCEPT
   : transaction(
       other.version_,
@@ -94,8 +95,12 @@ transaction::transaction(const transaction& other) NOEXCEPT
       other.outputs_,
       other.locktime_,
       other.segregated_,
-      other.valid_)
+      other.valid_,
+      other.nominal_size_,
+      other.witness_size_)
 {
+    nominal_hash_ = other.nominal_hash_;
+    witness_hash_ = other.witness_hash_;
 }
 
 transaction::transaction(uint32_t version, chain::inputs&& inputs,
@@ -121,9 +126,7 @@ transaction::transaction(uint32_t version, const chain::inputs_cptr& inputs,
 }
 
 transaction::transaction(const data_slice& data, bool witness) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : transaction(stream::in::copy(data), witness)
-    BC_POP_WARNING()
+  : transaction(read::bytes::fast(data), witness)
 {
 }
 
@@ -147,6 +150,28 @@ transaction::transaction(reader& source, bool witness) NOEXCEPT
 {
 }
 
+transaction::transaction(slice_reader&& source, bool witness) NOEXCEPT
+  : transaction(from_data(source, witness))
+{
+}
+
+transaction::transaction(slice_reader& source, bool witness) NOEXCEPT
+  : transaction(from_data(source, witness))
+{
+}
+
+transaction::transaction(hash::sha256x2::istream&& source,
+    bool witness) NOEXCEPT
+  : transaction(from_data(source, witness))
+{
+}
+
+transaction::transaction(hash::sha256x2::istream& source,
+    bool witness) NOEXCEPT
+  : transaction(from_data(source, witness))
+{
+}
+
 // protected
 transaction::transaction(uint32_t version,
     const chain::inputs_cptr& inputs, const chain::outputs_cptr& outputs,
@@ -156,7 +181,25 @@ transaction::transaction(uint32_t version,
     outputs_(outputs ? outputs : to_shared<output_cptrs>()),
     locktime_(locktime),
     segregated_(segregated),
-    valid_(valid)
+    valid_(valid),
+    nominal_size_(serialized_size(*inputs_, *outputs_, false)),
+    witness_size_(serialized_size(*inputs_, *outputs_, true))
+{
+}
+
+// protected
+transaction::transaction(uint32_t version,
+    const chain::inputs_cptr& inputs, const chain::outputs_cptr& outputs,
+    uint32_t locktime, bool segregated, bool valid, size_t nominal_size,
+    size_t witness_size) NOEXCEPT
+  : version_(version),
+    inputs_(inputs ? inputs : to_shared<input_cptrs>()),
+    outputs_(outputs ? outputs : to_shared<output_cptrs>()),
+    locktime_(locktime),
+    segregated_(segregated),
+    valid_(valid),
+    nominal_size_(nominal_size),
+    witness_size_(witness_size)
 {
 }
 
@@ -171,13 +214,20 @@ transaction& transaction::operator=(transaction&& other) NOEXCEPT
 
 transaction& transaction::operator=(const transaction& other) NOEXCEPT
 {
-    // Cache not assigned.
+    // Signature hash cache (cache_) is reset, as it derives from the prior
+    // inputs and outputs. Identity hashes (nominal_hash_, witness_hash_) are
+    // shared, sizes copied.
     version_ = other.version_;
     inputs_ = other.inputs_;
     outputs_ = other.outputs_;
     locktime_ = other.locktime_;
     segregated_ = other.segregated_;
     valid_ = other.valid_;
+    nominal_size_ = other.nominal_size_;
+    witness_size_ = other.witness_size_;
+    nominal_hash_ = other.nominal_hash_;
+    witness_hash_ = other.witness_hash_;
+    cache_.reset();
     return *this;
 }
 
@@ -226,10 +276,34 @@ read_puts(Source& source) NOEXCEPT
 }
 
 // static/private
-transaction transaction::from_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+transaction transaction::from_data(Source& source, bool witness) NOEXCEPT
 {
+    // A hashing source tees the bytes read here into txid and wtxid hashes.
+    // A slice source retains the bytes read here, so they are hashed in place.
+    constexpr auto hashing = is_same_type<Source, hash::sha256x2::istream>;
+    constexpr auto in_place = is_same_type<Source, slice_reader>;
+    auto marked = false;
+
+    // Positions that delimit the marker, flag and witnesses, which are
+    // excluded from the nominal hash (bip144).
+    size_t start{}, inputs_start{}, outputs_end{}, witness_end{};
+
+    if constexpr (hashing)
+        source.reset_hashes();
+
+    if constexpr (in_place)
+        start = source.get_position();
+
     const auto version = source.read_4_bytes_little_endian();
 
+    // The witness marker is excluded from the nominal hash (bip144).
+    if constexpr (hashing)
+    {
+        marked = source.peek_byte() == witness_marker;
+        source.set_witness(marked);
+    }
+
     // Inputs must be non-const so that they may assign the witness.
     auto inputs = read_puts<input>(source);
     chain::outputs_cptr outputs;
@@ -245,10 +319,22 @@ transaction transaction::from_data(reader& source, bool witness) NOEXCEPT
         // Skip over the peeked witness flag.
         source.skip_byte();
 
+        if constexpr (hashing)
+            source.set_witness(false);
+
+        if constexpr (in_place)
+            inputs_start = source.get_position();
+
         // Inputs and outputs are constructed on a vector of const pointers.
         inputs = read_puts<input>(source);
         outputs = read_puts<output>(source);
 
+        if constexpr (in_place)
+            outputs_end = source.get_position();
+
+        if constexpr (hashing)
+            source.set_witness(true);
+
         // Read or skip witnesses as specified.
         for (auto& input: *inputs)
         {
@@ -270,15 +356,76 @@ transaction transaction::from_data(reader& source, bool witness) NOEXCEPT
                 source.skip_bytes(input->witness().serialized_size(true));
             }
         }
+
+        if constexpr (hashing)
+            source.set_witness(false);
+
+        if constexpr (in_place)
+            witness_end = source.get_position();
     }
     else
     {
+        if constexpr (hashing)
+            source.set_witness(false);
+
         // Default witness is populated on input construct.
         outputs = read_puts<const output>(source);
     }
 
     const auto locktime = source.read_4_bytes_little_endian();
-    return { version, inputs, outputs, locktime, segregated, source };
+    transaction tx{ version, inputs, outputs, locktime, segregated, source };
+
+    // An empty input count that is not a marker was excluded from the nominal
+    // hash, so in that case (invalid transaction) neither hash is cached.
+    if constexpr (hashing)
+    {
+        if (tx.valid_ && (segregated || !marked))
+        {
+            tx.nominal_hash_ = to_shared(source.nominal_hash());
+
+            // The witness hash is cached only if witnesses are retained.
+            if (segregated && witness)
+                tx.witness_hash_ = to_shared(source.witness_hash());
+        }
+    }
+
+    if constexpr (in_place)
+    {
+        if (tx.valid_)
+        {
+            const auto end = source.get_position();
+            if (segregated)
+            {
+                accumulator<sha256> context{};
+                const auto write = [&](size_t first, size_t last) NOEXCEPT
+                {
+                    const auto bytes = source.get_slice(first, last);
+                    context.write(bytes.size(), bytes.data());
+                };
+
+                write(start, start + sizeof(uint32_t));
+                write(inputs_start, outputs_end);
+                write(witness_end, end);
+                tx.nominal_hash_ = to_shared(context.double_flush());
+
+                // The witness hash is cached only if witnesses are retained.
+                if (witness)
+                {
+                    const auto bytes = source.get_slice(start, end);
+                    tx.witness_hash_ = to_shared(bitcoin_hash(bytes.size(),
+                        bytes.data()));
+                }
+            }
+            else
+            {
+                const auto bytes = source.get_slice(start, end);
+                tx.nominal_hash_ = to_shared(bitcoin_hash(bytes.size(),
+                    bytes.data()));
+            }
+        }
+    }
+
+    return tx;
 }
 
 // Serialization.
@@ -290,13 +437,10 @@ data_chunk transaction::to_data(bool witness) const NOEXCEPT
 {
     witness &= segregated_;
 
+    // Exactly sized (cached), written without a stream.
     data_chunk data(serialized_size(witness));
-
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream::out::copy ostream(data);
-    BC_POP_WARNING()
-
-    to_data(ostream, witness);
+    write::bytes::fast sink(data);
+    to_data(sink, witness);
     return data;
 }
 
@@ -337,8 +481,14 @@ void transaction::to_data(writer& sink, bool witness) const NOEXCEPT
 
 size_t transaction::serialized_size(bool witness) const NOEXCEPT
 {
-    witness &= segregated_;
+    // Sizes are cached on construction (witness size includes marker/flag).
+    return witness && segregated_ ? witness_size_ : nominal_size_;
+}
 
+// static/private
+size_t transaction::serialized_size(const input_cptrs& inputs,
+    const output_cptrs& outputs, bool witness) NOEXCEPT
+{
     const auto ins = [=](size_t total, const auto& input) NOEXCEPT
     {
         // Inputs account for witness bytes. 
@@ -350,13 +500,13 @@ size_t transaction::serialized_size(bool witness) const NOEXCEPT
         return total + output->serialized_size();
     };
 
-    return sizeof(version_)
+    return sizeof(uint32_t)
         + (witness ? sizeof(witness_marker) + sizeof(witness_enabled) : zero)
-        + variable_size(inputs_->size())
-        + std::accumulate(inputs_->begin(), inputs_->end(), zero, ins)
-        + variable_size(outputs_->size())
-        + std::accumulate(outputs_->begin(), outputs_->end(), zero, outs)
-        + sizeof(locktime_);
+        + variable_size(inputs.size())
+        + std::accumulate(inputs.begin(), inputs.end(), zero, ins)
+        + variable_size(outputs.size())
+        + std::accumulate(outputs.begin(), outputs.end(), zero, outs)
+        + sizeof(uint32_t);
 }
 
 // Properties.
@@ -400,6 +550,17 @@ hash_digest transaction::hash(bool witness) const NOEXCEPT
     if (witness && segregated_ && is_coinbase())
         return null_hash;
 
+    // Set when deserialized from a hashing reader.
+    if (witness && segregated_)
+    {
+        if (witness_hash_)
+            return *witness_hash_;
+    }
+    else if (nominal_hash_)
+    {
+        return *nominal_hash_;
+    }
+
     // This is an out parameter.
     BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
     hash_digest digest;
@@ -69,9 +69,7 @@ witness::witness(const chunk_cptrs& stack) NOEXCEPT
 }
 
 witness::witness(const data_slice& data, bool prefix) NOEXCEPT
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-  : witness(stream::in::copy(data), prefix)
-    BC_POP_WARNING()
+  : witness(read::bytes::fast(data), prefix)
 {
 }
 
@@ -95,6 +93,16 @@ witness::witness(reader& source, bool prefix) NOEXCEPT
 {
 }
 
+witness::witness(slice_reader&& source, bool prefix) NOEXCEPT
+  : witness(from_data(source, prefix))
+{
+}
+
+witness::witness(slice_reader& source, bool prefix) NOEXCEPT
+  : witness(from_data(source, prefix))
+{
+}
+
 witness::witness(const std::string& mnemonic) NOEXCEPT
   : witness(from_string(mnemonic))
 {
@@ -128,14 +136,16 @@ bool witness::operator!=(const witness& other) const NOEXCEPT
 // Deserialization.
 // ----------------------------------------------------------------------------
 
-static data_chunk read_element(reader& source) NOEXCEPT
+template <typename Source>
+static data_chunk read_element(Source& source) NOEXCEPT
 {
     // Each witness encoded as variable integer prefixed byte array (bip144).
     return source.read_bytes(source.read_size(max_block_weight));
 }
 
 // static/private
-witness witness::from_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+witness witness::from_data(Source& source, bool prefix) NOEXCEPT
 {
     chunk_cptrs stack;
 
@@ -27,13 +27,6 @@ namespace libbitcoin {
 namespace system {
 namespace aes256 {
 
-struct context
-{
-    secret key;
-    secret enckey;
-    secret deckey;
-};
-
 constexpr size_t rounds = 14;
 
 constexpr data_array<to_bits(secret_size)> sbox
@@ -317,7 +310,7 @@ constexpr void expand_key_inverse(secret& key, uint8_t& round) NOEXCEPT
 BC_POP_WARNING()
 BC_POP_WARNING()
 
-constexpr void initialize(aes256::context& context, const secret& key) NOEXCEPT
+constexpr void schedule(aes256::context& context, const secret& key) NOEXCEPT
 {
     context.deckey = key;
     context.enckey = key;
@@ -396,7 +389,7 @@ constexpr void decrypt_block(aes256::context& context, block& bytes) NOEXCEPT
 void encrypt(block& bytes, const secret& key) NOEXCEPT
 {
     aes256::context context;
-    initialize(context, key);
+    schedule(context, key);
     encrypt_block(context, bytes);
     ////zeroize(context);
 }
@@ -404,11 +397,26 @@ void encrypt(block& bytes, const secret& key) NOEXCEPT
 void decrypt(block& bytes, const secret& key) NOEXCEPT
 {
     aes256::context context;
-    initialize(context, key);
+    schedule(context, key);
     decrypt_block(context, bytes);
     ////zeroize(context);
 }
 
+void initialize(context& context, const secret& key) NOEXCEPT
+{
+    schedule(context, key);
+}
+
+void encrypt(block& bytes, context& context) NOEXCEPT
+{
+    encrypt_block(context, bytes);
+}
+
+void decrypt(block& bytes, context& context) NOEXCEPT
+{
+    decrypt_block(context, bytes);
+}
+
 } // namespace aes256
 } // namespace system
 } // namespace libbitcoin
@@ -55,11 +55,16 @@ static uint64_t decode(bitreader& source, uint8_t modulo_exponent) NOEXCEPT
     return ((quotient << modulo_exponent) + remainder);
 }
 
+inline uint64_t to_range(uint64_t hash, uint64_t bound) NOEXCEPT
+{
+    const auto product = uint128_t(hash) * uint128_t(bound);
+    return (product >> bits<uint64_t>).convert_to<uint64_t>();
+}
+
 inline uint64_t hash_to_range(const data_slice& item, uint64_t bound,
     const siphash_key& key) NOEXCEPT
 {
-    const auto product = uint128_t(siphash(key, item)) * uint128_t(bound);
-    return (product >> bits<uint64_t>).convert_to<uint64_t>();
+    return to_range(siphash(key, item), bound);
 }
 
 static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
@@ -71,14 +76,13 @@ static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
         return {};
 
     const auto bound = target_false_positive_rate * set_size;
-    std::vector<uint64_t> hashes(items.size());
 
-    // C++17: parallel policy for std::transform.
-    std::transform(items.begin(), items.end(), hashes.begin(),
-        [&](const data_chunk& item) NOEXCEPT
-        {
-            return hash_to_range(item, bound, key);
-        });
+    // Batch siphash (vectorized), mapped to range in place.
+    auto hashes = siphash(key, items);
+    std::for_each(hashes.begin(), hashes.end(), [&](uint64_t& hash) NOEXCEPT
+    {
+        hash = to_range(hash, bound);
+    });
 
     return sort(std::move(hashes));
 }
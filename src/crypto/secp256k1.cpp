@@ -19,7 +19,10 @@
 #include <bitcoin/system/crypto/secp256k1.hpp>
 
 #include <algorithm>
+#include <array>
+#include <numeric>
 #include <utility>
+#include <vector>
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 #include <bitcoin/system/crypto/der_parser.hpp>
@@ -245,6 +248,98 @@ bool ec_multiply(ec_secret& left, const ec_secret& right) NOEXCEPT
         right.data()) == ec_success;
 }
 
+// Prepared point
+// ----------------------------------------------------------------------------
+
+constexpr auto parsed_size = sizeof(secp256k1_pubkey);
+constexpr auto window_mask = sub1(power2(ec_prepared_point::window_bits));
+constexpr auto table_size = ec_prepared_point::windows *
+    ec_prepared_point::multiples;
+
+ec_prepared_point::ec_prepared_point(const ec_compressed& point) NOEXCEPT
+  : point_(point), table_(prepare(point))
+{
+}
+
+// table[window * multiples + sub1(digit)] = digit * 16^window * point.
+data_chunk ec_prepared_point::prepare(const ec_compressed& point) NOEXCEPT
+{
+    auto const* context = ec_context_verify::context();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    data_chunk table(table_size * parsed_size);
+    BC_POP_WARNING()
+
+    const auto entries = pointer_cast<secp256k1_pubkey>(table.data());
+    if (!parse(context, entries[0], point))
+        return {};
+
+    // Each multiple is its predecessor plus the window base (digit one).
+    // Each window base is the prior window's last multiple (15) plus its base.
+    for (size_t entry = 1; entry < table_size; ++entry)
+    {
+        const auto digit = entry % multiples;
+        const auto base = is_zero(digit) ? entry - multiples : entry - digit;
+        const std::array<const secp256k1_pubkey*, two> pair
+        {
+            &entries[sub1(entry)], &entries[base]
+        };
+
+        if (secp256k1_ec_pubkey_combine(context, &entries[entry], pair.data(),
+            pair.size()) != ec_success)
+            return {};
+    }
+
+    return table;
+}
+
+ec_prepared_point::operator bool() const NOEXCEPT
+{
+    return !table_.empty();
+}
+
+const ec_compressed& ec_prepared_point::point() const NOEXCEPT
+{
+    return point_;
+}
+
+bool ec_prepared_point::multiply_vartime(ec_compressed& out,
+    const ec_secret& scalar) const NOEXCEPT
+{
+    auto const* context = ec_context_verify::context();
+
+    // Reject zero and overflowed scalars, as does secp256k1_ec_pubkey_tweak_mul.
+    if (table_.empty() ||
+        secp256k1_ec_seckey_verify(context, scalar.data()) != ec_success)
+        return false;
+
+    // Select one entry for each non-zero window of the (big endian) scalar.
+    // Zero windows are skipped and the sum is variable time (public scalars).
+    const auto entries = pointer_cast<const secp256k1_pubkey>(table_.data());
+    std::array<const secp256k1_pubkey*, windows> selected{};
+    size_t count{};
+
+    for (size_t window = 0; window < windows; ++window)
+    {
+        const auto byte = scalar[sub1(ec_secret_size) - to_half(window)];
+        const auto shift = is_odd(window) ? window_bits : zero;
+        const auto digit = (byte >> shift) & window_mask;
+
+        if (!is_zero(digit))
+            selected[count++] = &entries[window * multiples + sub1(digit)];
+    }
+
+    secp256k1_pubkey product;
+    return secp256k1_ec_pubkey_combine(context, &product, selected.data(),
+        count) == ec_success && serialize(context, out, product);
+}
+
+bool ec_multiply_vartime(ec_compressed& out, const ec_prepared_point& point,
+    const ec_secret& scalar) NOEXCEPT
+{
+    return point.multiply_vartime(out, scalar);
+}
+
 // Negate EC values
 // ----------------------------------------------------------------------------
 
@@ -296,6 +391,103 @@ bool secret_to_public(ec_uncompressed& out, const ec_secret& secret) NOEXCEPT
     return secret_to_public(context, out, secret);
 }
 
+// Batch EC values
+// ----------------------------------------------------------------------------
+// A failed element is set to null, which is never a valid point.
+
+static bool is_batch_valid(const compressed_list& points) NOEXCEPT
+{
+    return std::none_of(points.begin(), points.end(),
+        [](const ec_compressed& point) NOEXCEPT
+        {
+            return point == null_ec_compressed;
+        });
+}
+
+bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.resize(scalars.size());
+    BC_POP_WARNING()
+
+    auto const* context = ec_context_verify::context();
+
+    secp256k1_pubkey parsed;
+    if (!parse(context, parsed, point))
+        return false;
+
+    // Each sum is tweaked from a copy of the parsed point.
+    const auto add = [&](const ec_secret& scalar) NOEXCEPT
+    {
+        auto pubkey = parsed;
+        ec_compressed sum{};
+        return secp256k1_ec_pubkey_tweak_add(context, &pubkey, scalar.data())
+            == ec_success && serialize(context, sum, pubkey) ? sum :
+            null_ec_compressed;
+    };
+
+    std_transform(bc::par_unseq, scalars.begin(), scalars.end(), out.begin(),
+        add);
+
+    return is_batch_valid(out);
+}
+
+bool ec_add(compressed_list& points, const secret_list& scalars) NOEXCEPT
+{
+    if (points.size() != scalars.size())
+        return false;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<size_t> indexes(points.size());
+    BC_POP_WARNING()
+
+    auto const* context = ec_context_verify::context();
+    const auto add = [&](size_t index) NOEXCEPT
+    {
+        auto& point = points.at(index);
+        if (!ec_add(context, point, scalars.at(index)))
+            point = null_ec_compressed;
+    };
+
+    std::iota(indexes.begin(), indexes.end(), zero);
+    std_for_each(bc::par_unseq, indexes.begin(), indexes.end(), add);
+    return is_batch_valid(points);
+}
+
+bool ec_multiply(compressed_list& points, const ec_secret& scalar) NOEXCEPT
+{
+    auto const* context = ec_context_verify::context();
+    const auto multiply = [&](ec_compressed& point) NOEXCEPT
+    {
+        if (!ec_multiply(context, point, scalar))
+            point = null_ec_compressed;
+    };
+
+    std_for_each(bc::par_unseq, points.begin(), points.end(), multiply);
+    return is_batch_valid(points);
+}
+
+bool secret_to_public(compressed_list& out, const secret_list& secrets) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.resize(secrets.size());
+    BC_POP_WARNING()
+
+    auto const* context = ec_context_sign::context();
+    const auto create = [&](const ec_secret& secret) NOEXCEPT
+    {
+        ec_compressed point{};
+        return secret_to_public(context, point, secret) ? point :
+            null_ec_compressed;
+    };
+
+    std_transform(bc::par_unseq, secrets.begin(), secrets.end(), out.begin(),
+        create);
+
+    return is_batch_valid(out);
+}
+
 // Verify keys
 // ----------------------------------------------------------------------------
 
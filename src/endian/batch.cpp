@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/endian/batch.hpp>
+
+#include <algorithm>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/swaps.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+constexpr auto have_x128 = with_sse41 && !build_x32;
+constexpr auto have_x256 = with_avx2 && !build_x32;
+
+// Swap whole vectors while sufficient, advancing out, in and count.
+template <typename xWord, typename Word, if_extended<xWord> = true>
+static void byteswaps_v(Word*& out, const Word*& in, size_t& count) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, Word>;
+
+    if (count < lanes || !have<xWord>())
+        return;
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    do
+    {
+        store(pointer_cast<uint8_t>(out), byteswap<Word>(
+            load<xWord>(pointer_cast<const uint8_t>(in))));
+
+        out += lanes;
+        in += lanes;
+        count -= lanes;
+    }
+    while (count >= lanes);
+    BC_POP_WARNING()
+}
+
+template <typename Word>
+static void byteswaps_(Word* out, const Word* in, size_t count) NOEXCEPT
+{
+    if constexpr (have_x256)
+        byteswaps_v<xint256_t>(out, in, count);
+    if constexpr (have_x128)
+        byteswaps_v<xint128_t>(out, in, count);
+
+    // Complete remainder using normal form.
+    std::transform(in, std::next(in, count), out, [](Word value) NOEXCEPT
+    {
+        return byteswap(value);
+    });
+}
+
+void byteswaps(uint16_t* out, const uint16_t* in, size_t count) NOEXCEPT
+{
+    byteswaps_(out, in, count);
+}
+
+void byteswaps(uint32_t* out, const uint32_t* in, size_t count) NOEXCEPT
+{
+    byteswaps_(out, in, count);
+}
+
+void byteswaps(uint64_t* out, const uint64_t* in, size_t count) NOEXCEPT
+{
+    byteswaps_(out, in, count);
+}
+
+} // namespace system
+} // namespace libbitcoin
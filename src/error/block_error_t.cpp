@@ -58,7 +58,10 @@ DEFINE_ERROR_T_MESSAGE_MAP(block_error)
     { invalid_witness_commitment, "invalid witness commitment" },
     { block_weight_limit, "block weight limit exceeded" },
     { temporary_hash_limit, "block contains too many hashes" },
-    { unspent_coinbase_collision, "unspent coinbase collision" }
+    { unspent_coinbase_collision, "unspent coinbase collision" },
+
+    // accept header (appended)
+    { orphan_header, "header does not link to its predecessor" }
 };
 
 DEFINE_ERROR_T_CATEGORY(block_error, "block", "block code")
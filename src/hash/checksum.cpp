@@ -18,12 +18,15 @@
  */
 #include <bitcoin/system/hash/checksum.hpp>
 
+#include <algorithm>
+#include <array>
+#include <string_view>
 #include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/radix/radix.hpp>
-#include <bitcoin/system/unicode/ascii.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -71,21 +74,84 @@ bool verify_checksum(const data_chunk& data) NOEXCEPT
 static const size_t bech32_version_size = 1;
 static const size_t bech32_checksum_size = 6;
 
-static base32_chunk bech32_expand_prefix(const std::string& prefix) NOEXCEPT
+constexpr char bech32_separator = '1';
+constexpr auto bech32_bits = 5_size;
+constexpr auto bech32_invalid = 0xff_u8;
+constexpr std::string_view bech32_characters
 {
-    const auto size = prefix.size();
-    const auto lower = ascii_to_lower(prefix);
-    base32_chunk out(add1(2u * size), 0x00);
+    "qpzry9x8gf2tvdw0s3jn54khce6mua7l"
+};
 
-    for (size_t index = 0; index < size; ++index)
+constexpr char bech32_lower(char character) NOEXCEPT
+{
+    return (character >= 'A' && character <= 'Z') ?
+        static_cast<char>(character + ('a' - 'A')) : character;
+}
+
+constexpr char bech32_upper(char character) NOEXCEPT
+{
+    return (character >= 'a' && character <= 'z') ?
+        static_cast<char>(character - ('a' - 'A')) : character;
+}
+
+// BIP173 generator, the xor of the generator of each set coefficient bit.
+constexpr std::array<uint32_t, 32> bech32_generators = []() NOEXCEPT
+{
+    constexpr std::array<uint32_t, 5> generator
+    {
+        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
+    };
+
+    std::array<uint32_t, 32> table{};
+    for (size_t coefficient = 0; coefficient < table.size(); ++coefficient)
+        for (size_t bit = 0; bit < generator.size(); ++bit)
+            if (get_right(coefficient, bit))
+                table.at(coefficient) ^= generator.at(bit);
+
+    return table;
+}();
+
+constexpr std::array<uint8_t, 256> bech32_values = []() NOEXCEPT
+{
+    std::array<uint8_t, 256> values{};
+    values.fill(bech32_invalid);
+    for (size_t value = 0; value < bech32_characters.size(); ++value)
     {
-        const char character = lower[index];
-        out[index] = character >> 5;
-        out[size + 1u + index] = character;
+        const auto character = bech32_characters.at(value);
+        values.at(static_cast<uint8_t>(character)) =
+            narrow_cast<uint8_t>(value);
+        values.at(static_cast<uint8_t>(bech32_upper(character))) =
+            narrow_cast<uint8_t>(value);
     }
 
-    out[size] = 0x00;
-    return out;
+    return values;
+}();
+
+// One step of the polymod, the coefficient selects the generator.
+constexpr uint32_t bech32_polymod(uint32_t checksum, uint8_t value) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return bech32_generators[checksum >> 25] ^
+        ((checksum & 0x01ffffff) << bech32_bits) ^ value;
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+}
+
+// The polymod of the expanded prefix (high bits, zero, low bits).
+static uint32_t bech32_prefix_checksum(const std::string_view& prefix) NOEXCEPT
+{
+    uint32_t checksum = 1;
+    for (const auto character: prefix)
+        checksum = bech32_polymod(checksum, static_cast<uint8_t>(
+            bech32_lower(character)) >> bech32_bits);
+
+    checksum = bech32_polymod(checksum, 0x00);
+    for (const auto character: prefix)
+        checksum = bech32_polymod(checksum, static_cast<uint8_t>(
+            bech32_lower(character)) & 0x1f);
+
+    return checksum;
 }
 
 static base32_chunk bech32_expand_checksum(uint32_t checksum) NOEXCEPT
@@ -100,21 +166,12 @@ static base32_chunk bech32_expand_checksum(uint32_t checksum) NOEXCEPT
     return out;
 }
 
-static uint32_t bech32_checksum(const base32_chunk& data) NOEXCEPT
+static uint32_t bech32_checksum(const base32_chunk& data,
+    const std::string& prefix) NOEXCEPT
 {
-    uint32_t checksum = 1;
-
+    auto checksum = bech32_prefix_checksum(prefix);
     for (const auto& value: data)
-    {
-        const uint32_t coeficient = (checksum >> 25);
-        checksum = ((checksum & 0x01ffffff) << 5) ^ value.convert_to<uint8_t>();
-
-        if (coeficient & 0x01) checksum ^= 0x3b6a57b2;
-        if (coeficient & 0x02) checksum ^= 0x26508e6d;
-        if (coeficient & 0x04) checksum ^= 0x1ea119fa;
-        if (coeficient & 0x08) checksum ^= 0x3d4233dd;
-        if (coeficient & 0x10) checksum ^= 0x2a1462b3;
-    }
+        checksum = bech32_polymod(checksum, value.convert_to<uint8_t>());
 
     return checksum;
 }
@@ -126,30 +183,22 @@ constexpr uint32_t bech32_constant(uint8_t version) NOEXCEPT
     return is_zero(version) ? 0x00000001 : 0x2bc830a3;
 }
 
-static void bech32_prepend_prefix(base32_chunk& data,
-    const std::string& prefix) NOEXCEPT
-{
-    const auto expanded = bech32_expand_prefix(prefix);
-    data.insert(data.begin(), expanded.begin(), expanded.end());
-}
-
 static void bech32_append_checksum(base32_chunk& data,
     const std::string& prefix, uint8_t version) NOEXCEPT
 {
-    base32_chunk prefixed{ data };
-    bech32_prepend_prefix(prefixed, prefix);
-    prefixed.resize(prefixed.size() + bech32_checksum_size, 0x00);
-    const auto checksum = bech32_checksum(prefixed) ^ bech32_constant(version);
-    const auto checked = bech32_expand_checksum(checksum);
+    auto checksum = bech32_checksum(data, prefix);
+    for (size_t index = 0; index < bech32_checksum_size; ++index)
+        checksum = bech32_polymod(checksum, 0x00);
+
+    const auto checked = bech32_expand_checksum(checksum ^
+        bech32_constant(version));
     data.insert(data.end(), checked.begin(), checked.end());
 }
 
 static bool bech32_verify_checksum(const base32_chunk& checked,
     const std::string& prefix, uint8_t version) NOEXCEPT
 {
-    base32_chunk prefixed{ checked };
-    bech32_prepend_prefix(prefixed, prefix);
-    return bech32_checksum(prefixed) == bech32_constant(version);
+    return bech32_checksum(checked, prefix) == bech32_constant(version);
 }
 
 base32_chunk bech32_build_checked(uint8_t version, const data_chunk& program,
@@ -183,5 +232,127 @@ bool bech32_verify_checked(uint8_t& out_version, data_chunk& out_program,
     return bech32_verify_checksum(checked, prefix, out_version);
 }
 
+// bech32 fixed buffer
+// ----------------------------------------------------------------------------
+
+size_t bech32_encode(bech32_text& out, const std::string_view& prefix,
+    uint8_t version, const data_slice& program) NOEXCEPT
+{
+    const auto groups = ceilinged_divide(to_bits(program.size()), bech32_bits);
+    const auto length = prefix.size() + one + bech32_version_size + groups +
+        bech32_checksum_size;
+
+    // Version expansion would truncate a value above 5 bits.
+    if (version >= (1 << bech32_bits) || length > out.size())
+        return zero;
+
+    // The prefix is written in lower case, as it is checksummed.
+    auto checksum = bech32_prefix_checksum(prefix);
+    auto it = std::transform(prefix.begin(), prefix.end(), out.begin(),
+        bech32_lower);
+    *it++ = bech32_separator;
+
+    const auto put = [&](uint8_t value) NOEXCEPT
+    {
+        checksum = bech32_polymod(checksum, value);
+        *it++ = bech32_characters.at(value);
+    };
+
+    put(version);
+
+    // Bytes are regrouped to five bits, the last group is zero padded.
+    uint32_t accumulator = 0;
+    size_t bits = 0;
+    for (const auto byte: program)
+    {
+        accumulator = (accumulator << byte_bits) | byte;
+        for (bits += byte_bits; bits >= bech32_bits;)
+            put(narrow_cast<uint8_t>((accumulator >> (bits -= bech32_bits)) &
+                0x1f));
+    }
+
+    if (!is_zero(bits))
+        put(narrow_cast<uint8_t>((accumulator << (bech32_bits - bits)) & 0x1f));
+
+    for (size_t index = 0; index < bech32_checksum_size; ++index)
+        checksum = bech32_polymod(checksum, 0x00);
+
+    // The checksum groups are written from the high order group.
+    checksum ^= bech32_constant(version);
+    for (auto group = bech32_checksum_size; !is_zero(group); --group)
+        *it++ = bech32_characters.at((checksum >> (bech32_bits *
+            sub1(group))) & 0x1f);
+
+    return length;
+}
+
+bool bech32_decode(uint8_t& out_version, bech32_program& out_program,
+    size_t& out_size, const std::string_view& prefix,
+    const std::string_view& text) NOEXCEPT
+{
+    const auto minimum = prefix.size() + one + bech32_version_size +
+        bech32_checksum_size;
+
+    if (text.size() < minimum || text.size() > detail::bech32_maximum_length ||
+        text.at(prefix.size()) != bech32_separator)
+        return false;
+
+    // Case is uniform, the prefix matches in either case.
+    auto lower = false;
+    auto upper = false;
+    for (size_t index = 0; index < text.size(); ++index)
+    {
+        const auto character = text.at(index);
+        lower |= (character != bech32_upper(character));
+        upper |= (character != bech32_lower(character));
+        if ((lower && upper) || (index < prefix.size() &&
+            bech32_lower(character) != bech32_lower(prefix.at(index))))
+            return false;
+    }
+
+    auto checksum = bech32_prefix_checksum(prefix);
+    const auto data = text.substr(add1(prefix.size()));
+    const auto groups = data.size() - bech32_checksum_size;
+
+    uint32_t accumulator = 0;
+    size_t bits = 0;
+    out_size = zero;
+    for (size_t index = 0; index < data.size(); ++index)
+    {
+        const auto value = bech32_values.at(static_cast<uint8_t>(
+            data.at(index)));
+
+        if (value == bech32_invalid)
+            return false;
+
+        checksum = bech32_polymod(checksum, value);
+
+        // Version and checksum groups are not program.
+        if (is_zero(index))
+        {
+            out_version = value;
+        }
+        else if (index < groups)
+        {
+            accumulator = (accumulator << bech32_bits) | value;
+            if ((bits += bech32_bits) >= byte_bits)
+            {
+                if (out_size == out_program.size())
+                    return false;
+
+                out_program.at(out_size++) = narrow_cast<uint8_t>(
+                    accumulator >> (bits -= byte_bits));
+            }
+        }
+    }
+
+    // BIP173: at most four bits of zero padding.
+    if (bits >= bech32_bits || !is_zero(accumulator & unmask_right<uint32_t>(
+        bits)))
+        return false;
+
+    return checksum == bech32_constant(out_version);
+}
+
 } // namespace system
 } // namespace libbitcoin
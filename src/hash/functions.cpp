@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/hash/functions.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+constexpr auto have_x128 = with_sse41 && !build_x32;
+
+// Reverse each hash as two swapped and reversed 128 bit halves.
+template <typename xWord, if_extended<xWord> = true>
+static bool reverse_hashes_v(hash_digest* out, const hash_digest* in,
+    size_t count) NOEXCEPT
+{
+    constexpr auto half = sizeof(xWord);
+    static_assert(to_half(hash_size) == half);
+
+    if (!have<xWord>())
+        return false;
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto from = in[index].data();
+        const auto to = out[index].data();
+        const auto low = load<xWord>(from);
+        const auto high = load<xWord>(std::next(from, half));
+        store(to, reverse_bytes(high));
+        store(std::next(to, half), reverse_bytes(low));
+    }
+    BC_POP_WARNING()
+
+    return true;
+}
+
+// out may equal in.
+static void reverse_hashes(hash_digest* out, const hash_digest* in,
+    size_t count) NOEXCEPT
+{
+    if constexpr (have_x128)
+        if (reverse_hashes_v<xint128_t>(out, in, count))
+            return;
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    std::transform(in, std::next(in, count), out,
+        [](const hash_digest& hash) NOEXCEPT
+        {
+            return reverse_copy(hash);
+        });
+    BC_POP_WARNING()
+}
+
+void reverse_hashes(hashes& values) NOEXCEPT
+{
+    reverse_hashes(values.data(), values.data(), values.size());
+}
+
+hashes reverse_hashes_copy(const hashes& values) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    hashes out(values.size());
+    BC_POP_WARNING()
+
+    reverse_hashes(out.data(), values.data(), values.size());
+    return out;
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -21,11 +21,15 @@
 
 #include <bitcoin/system/hash/siphash.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 
 // This would be circular a /hash include (must stay in cpp).
 #include <bitcoin/system/stream/stream.hpp>
@@ -110,6 +114,243 @@ uint64_t siphash(const half_hash& hash,
     return siphash(to_siphash_key(hash), message);
 }
 
+// Vectorization (one message per lane).
+// ----------------------------------------------------------------------------
+// Lanes proceed in lockstep, so each pass hashes messages of equal word count.
+
+constexpr auto have_x128 = with_sse41 && !build_x32;
+constexpr auto have_x256 = with_avx2 && !build_x32;
+constexpr auto have_x512 = with_avx512 && !build_x32;
+constexpr auto vectorization = have_x128 || have_x256 || have_x512;
+
+using indexes = std::vector<size_t>;
+
+// local
+constexpr size_t word_count(const data_chunk& message) NOEXCEPT
+{
+    return message.size() / sizeof(uint64_t);
+}
+
+// local
+INLINE uint64_t word(const data_chunk& message, size_t index) NOEXCEPT
+{
+    return unsafe_from_little_endian<uint64_t>(
+        std::next(message.data(), index * sizeof(uint64_t)));
+}
+
+// local
+INLINE uint64_t last_word(const data_chunk& message) NOEXCEPT
+{
+    // Remaining (zero padded) bytes and the encoded message length.
+    constexpr auto eight = sizeof(uint64_t);
+    const auto bytes = message.size();
+    const auto start = bytes - (bytes % eight);
+
+    uint64_t last = 0;
+    for (auto byte = start; byte < bytes; ++byte)
+        last |= shift_left<uint64_t>(message[byte], to_bits(byte - start));
+
+    return last ^ ((bytes % max_encoded_byte_count) << to_bits(sub1(eight)));
+}
+
+template <typename xWord>
+INLINE void sip_round(xWord& v0, xWord& v1, xWord& v2, xWord& v3) NOEXCEPT
+{
+    constexpr auto s = bits<uint64_t>;
+
+    v0 = f::add<s>(v0, v1);
+    v2 = f::add<s>(v2, v3);
+    v1 = f::rol<13, s>(v1);
+    v3 = f::rol<16, s>(v3);
+    v1 = f::xor_(v1, v0);
+    v3 = f::xor_(v3, v2);
+
+    v0 = f::rol<32, s>(v0);
+
+    v2 = f::add<s>(v2, v1);
+    v0 = f::add<s>(v0, v3);
+    v1 = f::rol<17, s>(v1);
+    v3 = f::rol<21, s>(v3);
+    v1 = f::xor_(v1, v2);
+    v3 = f::xor_(v3, v0);
+
+    v2 = f::rol<32, s>(v2);
+}
+
+template <typename xWord>
+INLINE void compression_round(xWord& v0, xWord& v1, xWord& v2, xWord& v3,
+    xWord word) NOEXCEPT
+{
+    v3 = f::xor_(v3, word);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    v0 = f::xor_(v0, word);
+}
+
+template <typename xWord, typename Get>
+INLINE xWord pack(const data_stack& messages, indexes::const_iterator it,
+    Get&& get_word) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, uint64_t>;
+
+    if constexpr (lanes == 2)
+    {
+        return set<xWord>(
+            get_word(messages[it[0]]),
+            get_word(messages[it[1]]));
+    }
+    else if constexpr (lanes == 4)
+    {
+        return set<xWord>(
+            get_word(messages[it[0]]),
+            get_word(messages[it[1]]),
+            get_word(messages[it[2]]),
+            get_word(messages[it[3]]));
+    }
+    else if constexpr (lanes == 8)
+    {
+        return set<xWord>(
+            get_word(messages[it[0]]),
+            get_word(messages[it[1]]),
+            get_word(messages[it[2]]),
+            get_word(messages[it[3]]),
+            get_word(messages[it[4]]),
+            get_word(messages[it[5]]),
+            get_word(messages[it[6]]),
+            get_word(messages[it[7]]));
+    }
+}
+
+template <typename xWord>
+INLINE void output(std::vector<uint64_t>& out, indexes::const_iterator it,
+    xWord hash) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, uint64_t>;
+
+    out[it[0]] = get<uint64_t, 0>(hash);
+    out[it[1]] = get<uint64_t, 1>(hash);
+
+    if constexpr (lanes >= 4)
+    {
+        out[it[2]] = get<uint64_t, 2>(hash);
+        out[it[3]] = get<uint64_t, 3>(hash);
+    }
+
+    if constexpr (lanes >= 8)
+    {
+        out[it[4]] = get<uint64_t, 4>(hash);
+        out[it[5]] = get<uint64_t, 5>(hash);
+        out[it[6]] = get<uint64_t, 6>(hash);
+        out[it[7]] = get<uint64_t, 7>(hash);
+    }
+}
+
+template <typename xWord, if_extended<xWord> = true>
+static void siphash_v(std::vector<uint64_t>& out, const siphash_key& key,
+    const data_stack& messages, indexes::const_iterator& it,
+    indexes::const_iterator end) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, uint64_t>;
+    const auto remaining = [&]() NOEXCEPT
+    {
+        return possible_narrow_sign_cast<size_t>(std::distance(it, end));
+    };
+
+    if (remaining() < lanes || !have<xWord>())
+        return;
+
+    const auto k0 = broadcast<xWord>(std::get<0>(key));
+    const auto k1 = broadcast<xWord>(std::get<1>(key));
+    const auto count = word_count(messages[*it]);
+
+    do
+    {
+        auto v0 = f::xor_(broadcast<xWord>(siphash_magic_0), k0);
+        auto v1 = f::xor_(broadcast<xWord>(siphash_magic_1), k1);
+        auto v2 = f::xor_(broadcast<xWord>(siphash_magic_2), k0);
+        auto v3 = f::xor_(broadcast<xWord>(siphash_magic_3), k1);
+
+        for (size_t index = 0; index < count; ++index)
+            compression_round(v0, v1, v2, v3, pack<xWord>(messages, it,
+                [=](const data_chunk& message) NOEXCEPT
+                {
+                    return word(message, index);
+                }));
+
+        compression_round(v0, v1, v2, v3, pack<xWord>(messages, it,
+            [](const data_chunk& message) NOEXCEPT
+            {
+                return last_word(message);
+            }));
+
+        v2 = f::xor_(v2, broadcast<xWord>(finalization));
+        sip_round(v0, v1, v2, v3);
+        sip_round(v0, v1, v2, v3);
+        sip_round(v0, v1, v2, v3);
+        sip_round(v0, v1, v2, v3);
+
+        output(out, it, f::xor_(f::xor_(v0, v1), f::xor_(v2, v3)));
+        std::advance(it, lanes);
+    }
+    while (remaining() >= lanes);
+}
+
+std::vector<uint64_t> siphash(const siphash_key& key,
+    const data_stack& messages) NOEXCEPT
+{
+    std::vector<uint64_t> out(messages.size());
+
+    if constexpr (!vectorization)
+    {
+        std::transform(messages.begin(), messages.end(), out.begin(),
+            [&](const data_chunk& message) NOEXCEPT
+            {
+                return siphash(key, message);
+            });
+
+        return out;
+    }
+
+    // Message order, stably grouped by word count (lane compatibility).
+    indexes order(messages.size());
+    std::iota(order.begin(), order.end(), zero);
+    std::stable_sort(order.begin(), order.end(),
+        [&](size_t left, size_t right) NOEXCEPT
+        {
+            return word_count(messages[left]) < word_count(messages[right]);
+        });
+
+    for (auto it = order.cbegin(); it != order.cend();)
+    {
+        const auto count = word_count(messages[*it]);
+        const auto end = std::find_if(it, order.cend(),
+            [&](size_t index) NOEXCEPT
+            {
+                return word_count(messages[index]) != count;
+            });
+
+        // Vector dispatch (each advances it by lanes while sufficient).
+        if constexpr (have_x512)
+            siphash_v<xint512_t>(out, key, messages, it, end);
+        if constexpr (have_x256)
+            siphash_v<xint256_t>(out, key, messages, it, end);
+        if constexpr (have_x128)
+            siphash_v<xint128_t>(out, key, messages, it, end);
+
+        // Complete rounds using normal form.
+        for (; it != end; ++it)
+            out[*it] = siphash(key, messages[*it]);
+    }
+
+    return out;
+}
+
+std::vector<uint64_t> siphash(const half_hash& hash,
+    const data_stack& messages) NOEXCEPT
+{
+    return siphash(to_siphash_key(hash), messages);
+}
+
 // TODO: constexpr
 siphash_key to_siphash_key(const half_hash& hash) NOEXCEPT
 {
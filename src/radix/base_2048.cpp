@@ -38,16 +38,26 @@ namespace system {
 static const words::mnemonic::catalogs base2048
 {
     {
-        words::mnemonic::catalog{ language::en, words::mnemonic::en },
-        words::mnemonic::catalog{ language::es, words::mnemonic::es },
-        words::mnemonic::catalog{ language::it, words::mnemonic::it },
-        words::mnemonic::catalog{ language::fr, words::mnemonic::fr },
-        words::mnemonic::catalog{ language::cs, words::mnemonic::cs },
-        words::mnemonic::catalog{ language::pt, words::mnemonic::pt },
-        words::mnemonic::catalog{ language::ja, words::mnemonic::ja },
-        words::mnemonic::catalog{ language::ko, words::mnemonic::ko },
-        words::mnemonic::catalog{ language::zh_Hans, words::mnemonic::zh_Hans },
-        words::mnemonic::catalog{ language::zh_Hant, words::mnemonic::zh_Hant }
+        words::mnemonic::catalog{ language::en, words::mnemonic::en,
+            words::mnemonic::en_table },
+        words::mnemonic::catalog{ language::es, words::mnemonic::es,
+            words::mnemonic::es_table },
+        words::mnemonic::catalog{ language::it, words::mnemonic::it,
+            words::mnemonic::it_table },
+        words::mnemonic::catalog{ language::fr, words::mnemonic::fr,
+            words::mnemonic::fr_table },
+        words::mnemonic::catalog{ language::cs, words::mnemonic::cs,
+            words::mnemonic::cs_table },
+        words::mnemonic::catalog{ language::pt, words::mnemonic::pt,
+            words::mnemonic::pt_table },
+        words::mnemonic::catalog{ language::ja, words::mnemonic::ja,
+            words::mnemonic::ja_table },
+        words::mnemonic::catalog{ language::ko, words::mnemonic::ko,
+            words::mnemonic::ko_table },
+        words::mnemonic::catalog{ language::zh_Hans, words::mnemonic::zh_Hans,
+            words::mnemonic::zh_Hans_table },
+        words::mnemonic::catalog{ language::zh_Hant, words::mnemonic::zh_Hant,
+            words::mnemonic::zh_Hant_table }
     }
 };
 
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/addresses/stealth_scanner.hpp>
+
+#include <numeric>
+#include <vector>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+#include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
+#include <bitcoin/system/wallet/keys/stealth.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+stealth_scanner::stealth_scanner(
+    const std::vector<stealth_receiver>& receivers) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    watches_.reserve(receivers.size());
+    for (const auto& receiver: receivers)
+        watches_.push_back(
+        {
+            receiver,
+            receiver.scan_private_,
+            receiver.spend_public_,
+            receiver.address_.filter()
+        });
+    BC_POP_WARNING()
+}
+
+size_t stealth_scanner::size() const NOEXCEPT
+{
+    return watches_.size();
+}
+
+stealth_scanner::matches stealth_scanner::scan(const rows& rows) const NOEXCEPT
+{
+    const auto count = rows.size() * watches_.size();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<size_t> indexes(count);
+    std::vector<uint8_t> paid(count, false);
+    BC_POP_WARNING()
+
+    // Each (receiver x row) pair is independent, indexed by receiver then row.
+    const auto scan_pair = [&](size_t index) NOEXCEPT
+    {
+        const auto& watch = watches_.at(index / rows.size());
+        const auto& row = rows.at(index % rows.size());
+
+        ec_compressed payee{};
+        paid.at(index) = watch.valid &&
+            is_stealth_filtered(watch.filter, row.prefix) &&
+            uncover_stealth(payee, row.ephemeral_public, watch.scan_private,
+                watch.spend_public) &&
+            bitcoin_short_hash(payee) == row.payee;
+    };
+
+    std::iota(indexes.begin(), indexes.end(), zero);
+    std_for_each(bc::par_unseq, indexes.begin(), indexes.end(), scan_pair);
+
+    matches out{};
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (paid.at(index))
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            out.push_back({ index % rows.size(), index / rows.size() });
+            BC_POP_WARNING()
+        }
+    }
+
+    return out;
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
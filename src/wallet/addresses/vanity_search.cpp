@@ -0,0 +1,335 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/addresses/vanity_search.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/radix/radix.hpp>
+#include <bitcoin/system/unicode/unicode.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/addresses/witness_address.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+const size_t vanity_search::batch_size = 1024;
+
+// p2kh: [version:1][hash:20][checksum:4] as a base58 number.
+// p2wpkh: [prefix][separator:1][version:1][program:20][checksum:6] in base32.
+constexpr auto payment_size = add1(short_hash_size) + checksum_default_size;
+constexpr auto hash_bits = to_bits(short_hash_size);
+constexpr auto checksum_bits = to_bits(checksum_default_size);
+constexpr auto base32_bits = 5u;
+constexpr auto base58_base = 58u;
+constexpr auto witness_version = "1q";
+
+typedef std::pair<uintx, uintx> values;
+
+static std::pair<short_hash, short_hash> to_range(const values& hashes) NOEXCEPT
+{
+    return
+    {
+        to_big_endian_size<short_hash_size>(hashes.first),
+        to_big_endian_size<short_hash_size>(hashes.second)
+    };
+}
+
+// The scalar value << (64 * word).
+static ec_secret to_scalar(uint64_t value, size_t word) NOEXCEPT
+{
+    const uintx scalar{ value };
+    return to_big_endian_size<ec_secret_size>(
+        uintx{ scalar << (bits<uint64_t> * word) });
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+vanity_search::vanity_search(const std::string& pattern, ranges&& ranges,
+    bool witness, uint8_t version, const std::string& prefix) NOEXCEPT
+  : pattern_(pattern), ranges_(std::move(ranges)), witness_(witness),
+    version_(version), prefix_(prefix)
+{
+}
+
+// The address is a '1' for each leading zero byte of the payload, followed by
+// the base58 value of the payload. So a pattern is the set of payload values
+// with exactly its number of leading zero bytes and with its digits leading,
+// for each encoded length. These reduce to (at most two) ranges of the hash,
+// with range bounds inclusive of values that differ only by checksum.
+vanity_search vanity_search::from_payment(const std::string& pattern,
+    uint8_t prefix) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    ranges out{};
+    const auto ones = std::min(pattern.find_first_not_of('1'), pattern.size());
+    const auto digits = pattern.substr(ones);
+
+    data_chunk decoded{};
+    if (ones > payment_size || !is_base58(digits) ||
+        !decode_base58(decoded, digits))
+        return { pattern, std::move(out), false, prefix, {} };
+
+    // Payload values with the leading zero bytes (at least, if no digits).
+    const auto exact = !digits.empty() && ones < payment_size;
+    const uintx ceiling{ power2<uintx>(to_bits(payment_size - ones)) };
+    const uintx floor{ exact ?
+        power2<uintx>(to_bits(sub1(payment_size - ones))) : uintx{} };
+
+    std::vector<values> payloads{};
+    if (digits.empty())
+    {
+        payloads.emplace_back(uintx{}, uintx{ ceiling - 1 });
+    }
+    else
+    {
+        // Each additional encoded digit scales the value of the pattern.
+        const uintx value{ from_big_endian(decoded) };
+        for (size_t extra = 0;; ++extra)
+        {
+            const uintx scale{ power<base58_base, uintx>(extra) };
+            const uintx first{ value * scale };
+            if (first >= ceiling)
+                break;
+
+            const uintx last{ first + scale - 1 };
+            if (last >= floor)
+                payloads.emplace_back(std::max(first, floor),
+                    std::min(last, uintx{ ceiling - 1 }));
+        }
+    }
+
+    // Payloads of the version, reduced to hashes (checksum is truncated).
+    const uintx version{ uintx{ prefix } << (hash_bits + checksum_bits) };
+    const uintx end{ version + power2<uintx>(hash_bits + checksum_bits) };
+    const uintx maximum{ power2<uintx>(hash_bits) - 1 };
+
+    for (const auto& payload: payloads)
+    {
+        if (payload.second < version || payload.first >= end)
+            continue;
+
+        const uintx first{ payload.first <= version ? uintx{} :
+            uintx{ (payload.first - version) >> checksum_bits } };
+        const uintx last{ std::min(uintx{ (payload.second - version) >>
+            checksum_bits }, maximum) };
+
+        out.push_back(to_range({ first, last }));
+    }
+
+    return { pattern, std::move(out), false, prefix, {} };
+    BC_POP_WARNING()
+}
+
+// Each program character is five bits of the hash (bech32 is a bit mapping),
+// so a pattern is the single range of hashes with its leading bits.
+vanity_search vanity_search::from_witness(const std::string& pattern,
+    const std::string& prefix) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    ranges out{};
+    const auto head = prefix + witness_version;
+    const auto valid = witness_address::parse_prefix(prefix) ==
+        witness_address::parse_result::valid;
+
+    // A pattern within the head matches all (or no) hashes.
+    if (pattern.size() <= head.size())
+    {
+        if (valid && starts_with(head, pattern))
+            out.push_back(to_range({ uintx{},
+                uintx{ power2<uintx>(hash_bits) - 1 } }));
+
+        return { pattern, std::move(out), true, {}, prefix };
+    }
+
+    const auto program = pattern.substr(head.size());
+    base32_chunk characters{};
+    if (!valid || !starts_with(pattern, head) ||
+        program.size() > hash_bits / base32_bits ||
+        ascii_to_lower(program) != program ||
+        !decode_base32(characters, program))
+        return { pattern, std::move(out), true, {}, prefix };
+
+    uintx value{};
+    for (const auto& character: characters)
+        value = (value << base32_bits) + static_cast<uint8_t>(character);
+
+    const auto unmatched = hash_bits - base32_bits * characters.size();
+    const uintx first{ value << unmatched };
+    const uintx last{ first + power2<uintx>(unmatched) - 1 };
+    out.push_back(to_range({ first, last }));
+
+    return { pattern, std::move(out), true, {}, prefix };
+    BC_POP_WARNING()
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+vanity_search::operator bool() const NOEXCEPT
+{
+    return !ranges_.empty();
+}
+
+const std::string& vanity_search::pattern() const NOEXCEPT
+{
+    return pattern_;
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+// Hashes are big-endian numbers, so array compares are numeric compares.
+bool vanity_search::is_candidate(const short_hash& hash) const NOEXCEPT
+{
+    return std::any_of(ranges_.begin(), ranges_.end(),
+        [&](const range& range) NOEXCEPT
+        {
+            return range.first <= hash && hash <= range.second;
+        });
+}
+
+// protected
+std::string vanity_search::encode(const short_hash& hash) const NOEXCEPT
+{
+    return witness_ ? witness_address{ hash, prefix_ }.encoded() :
+        payment_address{ hash, version_ }.encoded();
+}
+
+std::string vanity_search::match(const ec_compressed& point) const NOEXCEPT
+{
+    const auto hash = bitcoin_short_hash(point);
+    if (!is_candidate(hash))
+        return {};
+
+    // Range bounds may include a p2kh payload with a non-matching checksum.
+    auto address = encode(hash);
+    return starts_with(address, pattern_) ? address : std::string{};
+}
+
+vanity_search::hits vanity_search::search(const ec_secret& seed,
+    size_t lanes, size_t limit, const handler& handler) const NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    hits out{};
+    if (!(*this) || is_zero(limit))
+        return out;
+
+    // Lane state persists across rounds, hits are collected for each round.
+    struct lane_t
+    {
+        ec_secret base{};
+        ec_compressed point{};
+        uint64_t step{};
+        size_t keys{};
+        bool valid{};
+        hits found{};
+    };
+
+    // Each lane steps through its own 2^64 keys.
+    std::vector<lane_t> state(std::max(one, lanes));
+    for (uint64_t index = 0; index < state.size(); ++index)
+    {
+        auto& next = state.at(index);
+        next.base = seed;
+        next.valid =
+            (is_zero(index) || ec_add(next.base, to_scalar(index, one))) &&
+            secret_to_public(next.point, next.base);
+    }
+
+    // A lane searches one batch, or until it has the remaining hits.
+    size_t remaining{};
+    const auto batch = [&](lane_t& lane) NOEXCEPT
+    {
+        lane.keys = zero;
+        lane.found.clear();
+        for (; lane.valid && lane.keys < batch_size &&
+            lane.found.size() < remaining; ++lane.keys, ++lane.step)
+        {
+            auto address = match(lane.point);
+            if (!address.empty())
+            {
+                // The secret is only computed for hits.
+                auto secret = lane.base;
+                if (is_zero(lane.step) ||
+                    ec_add(secret, to_scalar(lane.step, zero)))
+                    lane.found.push_back({ secret, std::move(address) });
+            }
+
+            // Point addition (P + G), the key is stepped by one.
+            lane.valid = ec_add(lane.point, ec_compressed_generator);
+        }
+    };
+
+    const auto is_valid = [](const lane_t& lane) NOEXCEPT
+    {
+        return lane.valid;
+    };
+
+    uint64_t keys{};
+    const auto start = std::chrono::steady_clock::now();
+    while (std::any_of(state.begin(), state.end(), is_valid))
+    {
+        remaining = limit - out.size();
+        std_for_each(bc::par_unseq, state.begin(), state.end(), batch);
+
+        // Hits are merged in lane order.
+        for (auto& lane: state)
+        {
+            keys += lane.keys;
+            for (auto& hit: lane.found)
+                if (out.size() < limit)
+                    out.push_back(std::move(hit));
+        }
+
+        if (out.size() == limit)
+            break;
+
+        if (handler)
+        {
+            const std::chrono::duration<double> elapsed
+            {
+                std::chrono::steady_clock::now() - start
+            };
+
+            const auto seconds = elapsed.count();
+            const auto rate = seconds > 0.0 ?
+                static_cast<double>(keys) / seconds : 0.0;
+
+            if (!handler({ keys, rate, out.size() }))
+                break;
+        }
+    }
+
+    return out;
+    BC_POP_WARNING()
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
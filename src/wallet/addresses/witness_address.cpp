@@ -277,6 +277,88 @@ witness_address::parse_result witness_address::parse_address(
     return parse_result::valid;
 }
 
+// Batch converters.
+// ----------------------------------------------------------------------------
+
+// local
+inline uint8_t to_version(uint8_t code) NOEXCEPT
+{
+    constexpr auto op_81 = static_cast<uint8_t>(chain::opcode::push_positive_1);
+    return is_zero(code) ? version_0 :
+        static_cast<uint8_t>(code - sub1(op_81));
+}
+
+// [version:1][push_size:1][program:2-40]
+string_list witness_address::to_addresses(const data_stack& scripts,
+    const std::string& prefix) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    string_list out(scripts.size());
+    BC_POP_WARNING()
+
+    if (parse_prefix(prefix) != parse_result::valid)
+        return out;
+
+    bech32_text text{};
+    for (size_t index = 0; index < scripts.size(); ++index)
+    {
+        const auto& script = scripts[index];
+        if (script.size() < two || !chain::operation::is_version(
+            static_cast<chain::opcode>(script.front())) ||
+            script[one] != script.size() - two)
+            continue;
+
+        const auto version = to_version(script.front());
+        const data_slice program(std::next(script.begin(), two), script.end());
+        if (parse_program(version, program) == program_type::invalid)
+            continue;
+
+        const auto size = bech32_encode(text, prefix, version, program);
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        out[index].assign(text.data(), size);
+        BC_POP_WARNING()
+    }
+
+    return out;
+}
+
+data_stack witness_address::to_scripts(const string_list& addresses,
+    const std::string& prefix) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    data_stack out(addresses.size());
+    BC_POP_WARNING()
+
+    if (parse_prefix(prefix) != parse_result::valid)
+        return out;
+
+    uint8_t version{};
+    size_t size{};
+    bech32_program program{};
+    for (size_t index = 0; index < addresses.size(); ++index)
+    {
+        if (!bech32_decode(version, program, size, prefix, addresses[index]))
+            continue;
+
+        const auto end = std::next(program.begin(), size);
+        if (parse_program(version, { program.begin(), end }) ==
+            program_type::invalid)
+            continue;
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        auto& script = out[index];
+        script.reserve(two + size);
+        script.push_back(static_cast<uint8_t>(
+            chain::operation::opcode_from_version(version)));
+        script.push_back(narrow_cast<uint8_t>(size));
+        script.insert(script.end(), program.begin(), end);
+        BC_POP_WARNING()
+    }
+
+    return out;
+}
+
 // Factories.
 // ----------------------------------------------------------------------------
 
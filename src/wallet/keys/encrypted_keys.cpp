@@ -142,6 +142,45 @@ static long_hash scrypt_private(const data_slice& data,
     return scrypt<16384, 8, 8, true>::hash<long_hash_size>(data, salt);
 }
 
+// The token hash is the leading half of the private hash (pbkdf2 blocks).
+static bool scrypt_privates(std_vector<long_hash>& out,
+    const data_stack& data, const data_stack& salts, uint64_t memory) NOEXCEPT
+{
+    return scrypt<16384, 8, 8, true>::hash<long_hash_size>(out, data, salts,
+        memory);
+}
+
+static bool scrypt_pairs(std_vector<long_hash>& out, const data_stack& data,
+    const data_stack& salts, uint64_t memory) NOEXCEPT
+{
+    return scrypt<1024, 1, 1, true>::hash<long_hash_size>(out, data, salts,
+        memory);
+}
+
+// aes_
+// ----------------------------------------------------------------------------
+
+// Each derived key is expanded once for its two blocks.
+template <typename Block1, typename Block2>
+static void aes_encrypt(Block1& block1, Block2& block2,
+    const hash_digest& key) NOEXCEPT
+{
+    aes256::context context{};
+    aes256::initialize(context, key);
+    aes256::encrypt(block1, context);
+    aes256::encrypt(block2, context);
+}
+
+template <typename Block1, typename Block2>
+static void aes_decrypt(Block1& block1, Block2& block2,
+    const hash_digest& key) NOEXCEPT
+{
+    aes256::context context{};
+    aes256::initialize(context, key);
+    aes256::decrypt(block1, context);
+    aes256::decrypt(block2, context);
+}
+
 // set_flags
 // ----------------------------------------------------------------------------
 
@@ -182,13 +221,16 @@ static void create_private_key(encrypted_private& out_private,
 {
     const auto prefix = parse_encrypted_private::prefix_factory(version, true);
 
+    aes256::context context{};
+    aes256::initialize(context, derived2);
+
     auto encrypt1 = xor_data<half>(seed, derived1);
-    aes256::encrypt(encrypt1, derived2);
+    aes256::encrypt(encrypt1, context);
     const auto combined = splice(slice<quarter, half>(encrypt1),
         slice<half, half + quarter>(seed));
 
     auto encrypt2 = xor_offset<half, zero, half>(combined, derived1);
-    aes256::encrypt(encrypt2, derived2);
+    aes256::encrypt(encrypt2, context);
     const auto quarter1 = slice<zero, quarter>(encrypt1);
     out_private = insert_checksum<ek_private_decoded_size>(
     {
@@ -214,10 +256,8 @@ static bool create_public_key(encrypted_public& out_public,
     const auto hash = point_hash(point);
 
     auto encrypted1 = xor_data<half>(hash, derived1);
-    aes256::encrypt(encrypted1, derived2);
-
     auto encrypted2 = xor_offset<half, half, half>(hash, derived1);
-    aes256::encrypt(encrypted2, derived2);
+    aes_encrypt(encrypted1, encrypted2, derived2);
 
     const auto sign = point_sign(point.front(), derived2);
     out_public = insert_checksum<encrypted_public_decoded_size>(
@@ -348,22 +388,17 @@ bool create_token(encrypted_token& out_token, const std::string& passphrase,
 // encrypt
 // ----------------------------------------------------------------------------
 
-bool encrypt(encrypted_private& out_private, const ec_secret& secret,
-    const std::string& passphrase, uint8_t version, bool compressed) NOEXCEPT
+static void encrypt_secret(encrypted_private& out_private,
+    const ec_secret& secret, const ek_salt& salt, const long_hash& hash,
+    uint8_t version, bool compressed) NOEXCEPT
 {
-    ek_salt salt;
-    if (!address_salt(salt, secret, version, compressed))
-        return false;
-
-    const auto derived = split(scrypt_private(normal(passphrase), salt));
+    const auto derived = split(hash);
     const auto prefix = parse_encrypted_private::prefix_factory(version,
         false);
 
     auto encrypted1 = xor_data<half>(secret, derived.first);
-    aes256::encrypt(encrypted1, derived.second);
-
     auto encrypted2 = xor_offset<half, half, half>(secret, derived.first);
-    aes256::encrypt(encrypted2, derived.second);
+    aes_encrypt(encrypted1, encrypted2, derived.second);
 
     out_private = insert_checksum<ek_private_decoded_size>(
     {
@@ -373,6 +408,52 @@ bool encrypt(encrypted_private& out_private, const ec_secret& secret,
         encrypted1,
         encrypted2
     });
+}
+
+bool encrypt(encrypted_private& out_private, const ec_secret& secret,
+    const std::string& passphrase, uint8_t version, bool compressed) NOEXCEPT
+{
+    ek_salt salt;
+    if (!address_salt(salt, secret, version, compressed))
+        return false;
+
+    encrypt_secret(out_private, secret, salt,
+        scrypt_private(normal(passphrase), salt), version, compressed);
+
+    return true;
+}
+
+bool encrypt(encrypted_privates& out_privates,
+    const std::vector<ec_secret>& secrets, const std::string& passphrase,
+    uint8_t version, bool compressed, uint64_t memory) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto count = secrets.size();
+    const data_stack passwords(count, normal(passphrase));
+    data_stack salts(count);
+    std::vector<ek_salt> address_salts(count);
+    BC_POP_WARNING()
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (!address_salt(address_salts[index], secrets[index], version,
+            compressed))
+            return false;
+
+        salts[index] = to_chunk(address_salts[index]);
+    }
+
+    std_vector<long_hash> hashes{};
+    if (!scrypt_privates(hashes, passwords, salts, memory))
+        return false;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out_privates.resize(count);
+    BC_POP_WARNING()
+
+    for (size_t index = 0; index < count; ++index)
+        encrypt_secret(out_privates[index], secrets[index],
+            address_salts[index], hashes[index], version, compressed);
 
     return true;
 }
@@ -380,34 +461,37 @@ bool encrypt(encrypted_private& out_private, const ec_secret& secret,
 // decrypt private_key
 // ----------------------------------------------------------------------------
 
-static bool decrypt_multiplied(ec_secret& out_secret,
-    const parse_encrypted_private& parse,
-    const std::string& passphrase) NOEXCEPT
+// The factor (pass) and its point (passpoint) of the token hash.
+static bool multiplied_factor(ec_secret& out_factor, ec_compressed& out_point,
+    const parse_encrypted_private& parse, const hash_digest& hash) NOEXCEPT
 {
-    auto secret = scrypt_token(normal(passphrase), parse.owner_salt());
-
+    out_factor = hash;
     if (parse.lot_sequence())
-        secret = bitcoin_hash2(secret, parse.entropy());
+        out_factor = bitcoin_hash2(out_factor, parse.entropy());
 
-    ec_compressed point;
-    if (!secret_to_public(point, secret))
-        return false;
+    return secret_to_public(out_point, out_factor);
+}
 
-    const auto salt_entropy = splice(parse.salt(), parse.entropy());
-    const auto derived = split(scrypt_pair(point, salt_entropy));
+static bool decrypt_multiplied(ec_secret& out_secret,
+    const parse_encrypted_private& parse, const ec_secret& factor,
+    const long_hash& hash) NOEXCEPT
+{
+    const auto derived = split(hash);
+    aes256::context context{};
+    aes256::initialize(context, derived.second);
 
     const auto encrypt1 = parse.data1();
     auto encrypt2 = parse.data2();
 
-    aes256::decrypt(encrypt2, derived.second);
+    aes256::decrypt(encrypt2, context);
     const auto decrypt2 = xor_offset<half, 0, half>(encrypt2, derived.first);
     const auto part = split(decrypt2);
     auto extended = splice(encrypt1, part.first);
 
-    aes256::decrypt(extended, derived.second);
+    aes256::decrypt(extended, context);
     const auto decrypt1 = xor_data<half>(extended, derived.first);
-    const auto factor = bitcoin_hash2(decrypt1, part.second);
-    if (!ec_multiply(secret, factor))
+    auto secret = factor;
+    if (!ec_multiply(secret, bitcoin_hash2(decrypt1, part.second)))
         return false;
 
     const auto compressed = parse.compressed();
@@ -419,17 +503,28 @@ static bool decrypt_multiplied(ec_secret& out_secret,
     return true;
 }
 
-static bool decrypt_secret(ec_secret& out_secret,
+static bool decrypt_multiplied(ec_secret& out_secret,
     const parse_encrypted_private& parse,
     const std::string& passphrase) NOEXCEPT
 {
+    ec_secret factor;
+    ec_compressed point;
+    const auto token = scrypt_token(normal(passphrase), parse.owner_salt());
+    if (!multiplied_factor(factor, point, parse, token))
+        return false;
+
+    const auto salt_entropy = splice(parse.salt(), parse.entropy());
+    return decrypt_multiplied(out_secret, parse, factor,
+        scrypt_pair(point, salt_entropy));
+}
+
+static bool decrypt_secret(ec_secret& out_secret,
+    const parse_encrypted_private& parse, const long_hash& hash) NOEXCEPT
+{
+    const auto derived = split(hash);
     auto encrypt1 = splice(parse.entropy(), parse.data1());
     auto encrypt2 = parse.data2();
-    const auto derived = split(scrypt_private(normal(passphrase),
-        parse.salt()));
-
-    aes256::decrypt(encrypt1, derived.second);
-    aes256::decrypt(encrypt2, derived.second);
+    aes_decrypt(encrypt1, encrypt2, derived.second);
 
     const auto encrypted = splice(encrypt1, encrypt2);
     const auto secret = xor_data<hash_size>(encrypted, derived.first);
@@ -443,6 +538,14 @@ static bool decrypt_secret(ec_secret& out_secret,
     return true;
 }
 
+static bool decrypt_secret(ec_secret& out_secret,
+    const parse_encrypted_private& parse,
+    const std::string& passphrase) NOEXCEPT
+{
+    return decrypt_secret(out_secret, parse,
+        scrypt_private(normal(passphrase), parse.salt()));
+}
+
 bool decrypt(ec_secret& out_secret, uint8_t& out_version, bool& out_compressed,
     const encrypted_private& key, const std::string& passphrase) NOEXCEPT
 {
@@ -463,6 +566,96 @@ bool decrypt(ec_secret& out_secret, uint8_t& out_version, bool& out_compressed,
     return success;
 }
 
+// Scrypt derivations of all keys are batched, those of multiplied keys in two
+// stages (token, then pair), each bounded by memory.
+bool decrypt(ek_decryptions& out, const encrypted_privates& keys,
+    const std::string& passphrase, uint64_t memory) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto count = keys.size();
+    out.assign(count, {});
+
+    std::vector<parse_encrypted_private> parses{};
+    parses.reserve(count);
+    for (const auto& key: keys)
+        parses.emplace_back(key);
+
+    const auto password = normal(passphrase);
+    data_stack passwords{};
+    data_stack salts{};
+    std::vector<size_t> indexes{};
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto& parse = parses[index];
+        if (!parse.is_valid())
+            continue;
+
+        indexes.push_back(index);
+        passwords.push_back(password);
+        salts.push_back(parse.multiplied() ? parse.owner_salt() :
+            to_chunk(parse.salt()));
+    }
+    BC_POP_WARNING()
+
+    std_vector<long_hash> hashes{};
+    if (!scrypt_privates(hashes, passwords, salts, memory))
+        return false;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<size_t> multiplied{};
+    std::vector<ec_secret> factors{};
+    data_stack points{};
+    salts.clear();
+    BC_POP_WARNING()
+
+    for (size_t item = 0; item < indexes.size(); ++item)
+    {
+        const auto index = indexes[item];
+        const auto& parse = parses[index];
+        auto& result = out[index];
+
+        if (!parse.multiplied())
+        {
+            result.valid = decrypt_secret(result.secret, parse, hashes[item]);
+            continue;
+        }
+
+        ec_secret factor;
+        ec_compressed point;
+        const auto token = slice<zero, hash_size>(hashes[item]);
+        if (!multiplied_factor(factor, point, parse, token))
+            continue;
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        multiplied.push_back(index);
+        factors.push_back(factor);
+        points.push_back(to_chunk(point));
+        salts.push_back(to_chunk(splice(parse.salt(), parse.entropy())));
+        BC_POP_WARNING()
+    }
+
+    if (!scrypt_pairs(hashes, points, salts, memory))
+        return false;
+
+    for (size_t item = 0; item < multiplied.size(); ++item)
+    {
+        auto& result = out[multiplied[item]];
+        result.valid = decrypt_multiplied(result.secret,
+            parses[multiplied[item]], factors[item], hashes[item]);
+    }
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (out[index].valid)
+        {
+            out[index].version = parses[index].address_version();
+            out[index].compressed = parses[index].compressed();
+        }
+    }
+
+    return true;
+}
+
 // decrypt public_key
 // ----------------------------------------------------------------------------
 
@@ -489,10 +682,8 @@ bool decrypt(ec_compressed& out_point, uint8_t& out_version,
     const auto derived = split(scrypt_pair(point, salt_entropy));
     auto encrypt = split(parse.data());
 
-    aes256::decrypt(encrypt.first, derived.second);
+    aes_decrypt(encrypt.first, encrypt.second, derived.second);
     const auto decrypt1 = xor_data<half>(encrypt.first, derived.first);
-
-    aes256::decrypt(encrypt.second, derived.second);
     const auto decrypt2 = xor_offset<half, zero, half>(encrypt.second, derived.first);
 
     const auto sign_byte = point_sign(parse.sign(), derived.second);
@@ -19,7 +19,9 @@
 #include <bitcoin/system/wallet/keys/hd_public.hpp>
 
 #include <iostream>
+#include <numeric>
 #include <string>
+#include <vector>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -236,6 +238,66 @@ hd_public hd_public::derive_public(uint32_t index) const NOEXCEPT
     return hd_public(child, intermediate.second, lineage);
 }
 
+bool hd_public::derive_range(compressed_list& out, uint32_t first,
+    size_t count) const NOEXCEPT
+{
+    // The output is empty on any failure.
+    out.clear();
+    if (is_zero(count))
+        return true;
+
+    if (!valid_ || lineage_.depth == max_uint8 ||
+        first >= hd_first_hardened_key || count > hd_first_hardened_key - first)
+        return false;
+
+    // The chain code is the hmac key for all children of this parent.
+    const auto midstate = hmac<sha512>::midstate(chain_);
+
+    // The child key Ki is point(parse256(IL)) + Kpar.
+    const auto tweak = [&](uint32_t index) NOEXCEPT
+    {
+        const auto data = splice(point_, to_big_endian(index));
+        return split(hmac<sha512>::code(data, midstate)).first;
+    };
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<uint32_t> indexes(count);
+    secret_list tweaks(count);
+    BC_POP_WARNING()
+
+    std::iota(indexes.begin(), indexes.end(), first);
+    std_transform(bc::par_unseq, indexes.begin(), indexes.end(),
+        tweaks.begin(), tweak);
+
+    if (ec_add(out, point_, tweaks))
+        return true;
+
+    out.clear();
+    return false;
+}
+
+bool hd_public::derive_range(short_hashes& out, uint32_t first,
+    size_t count) const NOEXCEPT
+{
+    // The output is empty on any failure.
+    out.clear();
+    compressed_list points{};
+    if (!derive_range(points, first, count))
+        return false;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out.resize(count);
+    BC_POP_WARNING()
+
+    std_transform(bc::par_unseq, points.begin(), points.end(), out.begin(),
+        [](const ec_compressed& point) NOEXCEPT
+        {
+            return bitcoin_short_hash(point);
+        });
+
+    return true;
+}
+
 // Helpers.
 // ----------------------------------------------------------------------------
 
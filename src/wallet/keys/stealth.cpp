@@ -25,6 +25,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -50,6 +51,13 @@ bool to_stealth_prefix(uint32_t& out_prefix, const script& script) NOEXCEPT
     return true;
 }
 
+// A stealth filter is a leftmost substring of the stealth prefix.
+bool is_stealth_filtered(const binary& filter, uint32_t prefix) NOEXCEPT
+{
+    return filter.bits() <= bits<uint32_t> &&
+        filter == binary(filter.bits(), to_little_endian(prefix));
+}
+
 // TODO: this can be implemented using libsecp256k1 without iteration.
 // The public key must have a sign value of 0x02 (i.e. must be even y-valued).
 bool create_ephemeral_key(ec_secret& out_secret,
@@ -129,7 +137,7 @@ bool create_stealth_script(script& out_null_data, const ec_secret& secret,
 
         // Test for match of filter to stealth script hash prefix.
         if (to_stealth_prefix(out, out_null_data) &&
-            (filter == binary(filter.bits(), to_little_endian(out))))
+            is_stealth_filtered(filter, out))
             return true;
     }
 
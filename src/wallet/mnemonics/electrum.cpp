@@ -61,16 +61,26 @@ static const auto index_bits = narrow_cast<uint8_t>(floored_log2(
 const electrum::dictionaries electrum::dictionaries_
 {
     {
-        electrum::dictionary{ language::en, words::electrum::en },
-        electrum::dictionary{ language::es, words::electrum::es },
-        electrum::dictionary{ language::it, words::electrum::it },
-        electrum::dictionary{ language::fr, words::electrum::fr },
-        electrum::dictionary{ language::cs, words::electrum::cs },
-        electrum::dictionary{ language::pt, words::electrum::pt },
-        electrum::dictionary{ language::ja, words::electrum::ja },
-        electrum::dictionary{ language::ko, words::electrum::ko },
-        electrum::dictionary{ language::zh_Hans, words::electrum::zh_Hans },
-        electrum::dictionary{ language::zh_Hant, words::electrum::zh_Hant }
+        electrum::dictionary{ language::en, words::electrum::en,
+            words::electrum::en_table },
+        electrum::dictionary{ language::es, words::electrum::es,
+            words::electrum::es_table },
+        electrum::dictionary{ language::it, words::electrum::it,
+            words::electrum::it_table },
+        electrum::dictionary{ language::fr, words::electrum::fr,
+            words::electrum::fr_table },
+        electrum::dictionary{ language::cs, words::electrum::cs,
+            words::electrum::cs_table },
+        electrum::dictionary{ language::pt, words::electrum::pt,
+            words::electrum::pt_table },
+        electrum::dictionary{ language::ja, words::electrum::ja,
+            words::electrum::ja_table },
+        electrum::dictionary{ language::ko, words::electrum::ko,
+            words::electrum::ko_table },
+        electrum::dictionary{ language::zh_Hans, words::electrum::zh_Hans,
+            words::electrum::zh_Hans_table },
+        electrum::dictionary{ language::zh_Hant, words::electrum::zh_Hant,
+            words::electrum::zh_Hant_table }
     }
 };
 
@@ -131,8 +131,10 @@ constexpr auto size2 = power<size, int64_t>(2u);
 const electrum_v1::dictionaries electrum_v1::dictionaries_
 {
     {
-        electrum_v1::dictionary{ language::en, words::electrum_v1::en },
-        electrum_v1::dictionary{ language::pt, words::electrum_v1::pt }
+        electrum_v1::dictionary{ language::en, words::electrum_v1::en,
+            words::electrum_v1::en_table },
+        electrum_v1::dictionary{ language::pt, words::electrum_v1::pt,
+            words::electrum_v1::pt_table }
     }
 };
 
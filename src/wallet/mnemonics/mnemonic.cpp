@@ -18,6 +18,7 @@
  */
 #include <bitcoin/system/wallet/mnemonics/mnemonic.hpp>
 
+#include <algorithm>
 #include <string>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -39,22 +40,36 @@ namespace wallet {
 static const auto index_bits = narrow_cast<uint8_t>(
     system::floored_log2(mnemonic::dictionary::size()));
 
+// BIP39 seed stretching parameters.
+constexpr size_t hmac_iterations = 2048;
+constexpr auto passphrase_prefix = "mnemonic";
+
 // private static
 // ----------------------------------------------------------------------------
 
 const mnemonic::dictionaries mnemonic::dictionaries_
 {
     {
-        mnemonic::dictionary{ language::en, words::mnemonic::en },
-        mnemonic::dictionary{ language::es, words::mnemonic::es },
-        mnemonic::dictionary{ language::it, words::mnemonic::it },
-        mnemonic::dictionary{ language::fr, words::mnemonic::fr },
-        mnemonic::dictionary{ language::cs, words::mnemonic::cs },
-        mnemonic::dictionary{ language::pt, words::mnemonic::pt },
-        mnemonic::dictionary{ language::ja, words::mnemonic::ja },
-        mnemonic::dictionary{ language::ko, words::mnemonic::ko },
-        mnemonic::dictionary{ language::zh_Hans, words::mnemonic::zh_Hans },
-        mnemonic::dictionary{ language::zh_Hant, words::mnemonic::zh_Hant }
+        mnemonic::dictionary{ language::en, words::mnemonic::en,
+            words::mnemonic::en_table },
+        mnemonic::dictionary{ language::es, words::mnemonic::es,
+            words::mnemonic::es_table },
+        mnemonic::dictionary{ language::it, words::mnemonic::it,
+            words::mnemonic::it_table },
+        mnemonic::dictionary{ language::fr, words::mnemonic::fr,
+            words::mnemonic::fr_table },
+        mnemonic::dictionary{ language::cs, words::mnemonic::cs,
+            words::mnemonic::cs_table },
+        mnemonic::dictionary{ language::pt, words::mnemonic::pt,
+            words::mnemonic::pt_table },
+        mnemonic::dictionary{ language::ja, words::mnemonic::ja,
+            words::mnemonic::ja_table },
+        mnemonic::dictionary{ language::ko, words::mnemonic::ko,
+            words::mnemonic::ko_table },
+        mnemonic::dictionary{ language::zh_Hans, words::mnemonic::zh_Hans,
+            words::mnemonic::zh_Hans_table },
+        mnemonic::dictionary{ language::zh_Hant, words::mnemonic::zh_Hant,
+            words::mnemonic::zh_Hant_table }
     }
 };
 
@@ -88,9 +103,16 @@ data_chunk mnemonic::decoder(const string_list& words,
 long_hash mnemonic::seeder(const string_list& words,
     const std::string& passphrase) NOEXCEPT
 {
-    constexpr size_t hmac_iterations = 2048;
-    constexpr auto passphrase_prefix = "mnemonic";
+    std::string salt{};
+    if (!salter(salt, passphrase))
+        return {};
 
+    return stretcher(words, salt);
+}
+
+bool mnemonic::salter(std::string& salt,
+    const std::string& passphrase) NOEXCEPT
+{
     // Passphrase is limited to ascii (normal) if HAVE_ICU undefind.
     std::string phrase{ passphrase };
 
@@ -98,13 +120,20 @@ long_hash mnemonic::seeder(const string_list& words,
 
     // Unlike Electrum, BIP39 does not perform any further normalization.
     if (!to_compatibility_decomposition(phrase))
-        return {};
+        return false;
 
     LCOV_EXCL_STOP()
 
+    salt = passphrase_prefix + phrase;
+    return true;
+}
+
+long_hash mnemonic::stretcher(const string_list& words,
+    const std::string& salt) NOEXCEPT
+{
     // Words are in normal (lower, nfkd) form, even without ICU.
-    return pbkd<sha512>::key<long_hash_size>(system::join(words),
-        passphrase_prefix + phrase, hmac_iterations);
+    return pbkd<sha512>::key<long_hash_size>(system::join(words), salt,
+        hmac_iterations);
 }
 
 uint8_t mnemonic::checksum_byte(const data_chunk& entropy) NOEXCEPT
@@ -189,6 +218,44 @@ bool mnemonic::is_valid_word_count(size_t count) NOEXCEPT
         count >= word_minimum && count <= word_maximum);
 }
 
+mnemonic::list mnemonic::from_sentences(const string_list& sentences,
+    language identifier) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    list out(sentences.size());
+    BC_POP_WARNING()
+
+    // Normalization, dictionary search and checksum are independent.
+    std_transform(bc::par_unseq, sentences.begin(), sentences.end(),
+        out.begin(), [=](const std::string& sentence) NOEXCEPT
+        {
+            return mnemonic(sentence, identifier);
+        });
+
+    return out;
+}
+
+long_hashes mnemonic::to_seeds(const list& mnemonics,
+    const std::string& passphrase) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    long_hashes out(mnemonics.size());
+    BC_POP_WARNING()
+
+    std::string salt{};
+    if (!salter(salt, passphrase))
+        return out;
+
+    // Each seed is 2048 hmac-sha512 iterations, independent of others.
+    std_transform(bc::par_unseq, mnemonics.begin(), mnemonics.end(),
+        out.begin(), [&](const mnemonic& value) NOEXCEPT
+        {
+            return value ? stretcher(value.words(), salt) : long_hash{};
+        });
+
+    return out;
+}
+
 // construction
 // ----------------------------------------------------------------------------
 
@@ -42,6 +42,56 @@ const catalog::words& ko = mnemonic::ko;
 const catalog::words& zh_Hans = mnemonic::zh_Hans;
 const catalog::words& zh_Hant = mnemonic::zh_Hant;
 
+const catalog::table& en_table() NOEXCEPT
+{
+    return mnemonic::en_table();
+}
+
+const catalog::table& es_table() NOEXCEPT
+{
+    return mnemonic::es_table();
+}
+
+const catalog::table& it_table() NOEXCEPT
+{
+    return mnemonic::it_table();
+}
+
+const catalog::table& fr_table() NOEXCEPT
+{
+    return mnemonic::fr_table();
+}
+
+const catalog::table& cs_table() NOEXCEPT
+{
+    return mnemonic::cs_table();
+}
+
+const catalog::table& pt_table() NOEXCEPT
+{
+    return mnemonic::pt_table();
+}
+
+const catalog::table& ja_table() NOEXCEPT
+{
+    return mnemonic::ja_table();
+}
+
+const catalog::table& ko_table() NOEXCEPT
+{
+    return mnemonic::ko_table();
+}
+
+const catalog::table& zh_Hans_table() NOEXCEPT
+{
+    return mnemonic::zh_Hans_table();
+}
+
+const catalog::table& zh_Hant_table() NOEXCEPT
+{
+    return mnemonic::zh_Hant_table();
+}
+
 } // namespace electrum
 } // namespace words
 } // namespace system
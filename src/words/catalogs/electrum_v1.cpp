@@ -3291,6 +3291,19 @@ const catalog::words pt
     }
 };
 
+// Tables are built on first use, as in catalogs/mnemonic.cpp.
+const catalog::table& en_table() NOEXCEPT
+{
+    static const catalog::table table{ en.word };
+    return table;
+}
+
+const catalog::table& pt_table() NOEXCEPT
+{
+    static const catalog::table table{ pt.word };
+    return table;
+}
+
 } // namespace electrum_v1
 } // namespace words
 } // namespace system
@@ -20576,6 +20576,70 @@ const catalog::words zh_Hant
     }
 };
 
+// Tables are built on first use (function-local statics), as constant
+// evaluation of all tables exceeds default compiler limits, and a table
+// initialized on load may be referenced by another static initializer
+// before it is constructed. Each builds in about 0.15ms.
+const catalog::table& en_table() NOEXCEPT
+{
+    static const catalog::table table{ en.word };
+    return table;
+}
+
+const catalog::table& es_table() NOEXCEPT
+{
+    static const catalog::table table{ es.word };
+    return table;
+}
+
+const catalog::table& it_table() NOEXCEPT
+{
+    static const catalog::table table{ it.word };
+    return table;
+}
+
+const catalog::table& fr_table() NOEXCEPT
+{
+    static const catalog::table table{ fr.word };
+    return table;
+}
+
+const catalog::table& cs_table() NOEXCEPT
+{
+    static const catalog::table table{ cs.word };
+    return table;
+}
+
+const catalog::table& pt_table() NOEXCEPT
+{
+    static const catalog::table table{ pt.word };
+    return table;
+}
+
+const catalog::table& ja_table() NOEXCEPT
+{
+    static const catalog::table table{ ja.word };
+    return table;
+}
+
+const catalog::table& ko_table() NOEXCEPT
+{
+    static const catalog::table table{ ko.word };
+    return table;
+}
+
+const catalog::table& zh_Hans_table() NOEXCEPT
+{
+    static const catalog::table table{ zh_Hans.word };
+    return table;
+}
+
+const catalog::table& zh_Hant_table() NOEXCEPT
+{
+    static const catalog::table table{ zh_Hant.word };
+    return table;
+}
+
 } // namespace mnemonic
 } // namespace words
 } // namespace system
@@ -205,6 +205,29 @@ BOOST_AUTO_TEST_CASE(block__constructor__reader__success)
     BOOST_REQUIRE(!block.is_invalid_merkle_root());
 }
 
+BOOST_AUTO_TEST_CASE(block__constructor__fast_reader__success)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    read::bytes::fast source(data);
+    const accessor block(source, true);
+    BOOST_REQUIRE(block.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(!block.is_invalid_merkle_root());
+    BOOST_REQUIRE(block == genesis);
+}
+
+BOOST_AUTO_TEST_CASE(block__constructor__fast_reader__matches_copy_reader)
+{
+    read::bytes::copy copy(block_data);
+    read::bytes::fast fast(block_data);
+    const block expected(copy, true);
+    const block instance(fast, true);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE_EQUAL(fast.get_position(), copy.get_position());
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -289,6 +312,22 @@ BOOST_AUTO_TEST_CASE(block__to_data__writer__expected)
     BOOST_REQUIRE(copy == expected_block);
 }
 
+BOOST_AUTO_TEST_CASE(block__to_data__gather__expected)
+{
+    write::bytes::gather out{};
+    expected_block.to_data(out, true);
+    BOOST_REQUIRE(out);
+    BOOST_REQUIRE_EQUAL(out.get_position(), expected_block.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(out.to_chunk(), expected_block.to_data(true));
+}
+
+BOOST_AUTO_TEST_CASE(block__serialized_size__copy__expected)
+{
+    const auto copy = expected_block;
+    BOOST_REQUIRE_EQUAL(copy.serialized_size(true), expected_block.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(copy.serialized_size(false), expected_block.serialized_size(false));
+}
+
 // properties
 // ----------------------------------------------------------------------------
 
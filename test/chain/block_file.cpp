@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+struct block_file_tests_setup_fixture
+{
+    block_file_tests_setup_fixture()
+    {
+        test::remove(TEST_NAME);
+    }
+
+    ~block_file_tests_setup_fixture()
+    {
+        test::remove(TEST_NAME);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(block_file_tests, block_file_tests_setup_fixture)
+
+using namespace system::chain;
+
+constexpr uint32_t magic = 0xd9b4bef9;
+static const auto genesis = settings(selection::mainnet).genesis_block;
+static const auto genesis_data = genesis.to_data(true);
+
+// The header commits only to the coinbase, so check() fails.
+static const block unchecked
+{
+    genesis.header(),
+    transactions
+    {
+        *genesis.transactions_ptr()->front(),
+        transaction{ 1, inputs{ { point{ null_hash, 42 }, script{}, 0 } },
+            outputs{ { 1000, script{} } }, 0 }
+    }
+};
+
+static const auto unchecked_data = unchecked.to_data(true);
+
+static data_chunk to_record(const data_slice& block,
+    uint32_t value=magic) NOEXCEPT
+{
+    return build_chunk(
+    {
+        to_little_endian(value),
+        to_little_endian(possible_narrow_cast<uint32_t>(block.size())),
+        block
+    });
+}
+
+static bool write(const std::string& path, const data_slice& data) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    ofstream file(path, std::ofstream::binary);
+    file.write(pointer_cast<const char>(data.data()), data.size());
+    return file.good();
+    BC_POP_WARNING()
+}
+
+// construct
+
+BOOST_AUTO_TEST_CASE(block_file__construct__missing__invalid)
+{
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(!file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.size(), zero);
+    BOOST_REQUIRE(file.index().empty());
+    BOOST_REQUIRE(file.at(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__empty__valid_no_records)
+{
+    BOOST_REQUIRE(test::create(TEST_NAME));
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.size(), zero);
+    BOOST_REQUIRE(file.index().empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__records__expected_index)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        to_record(unchecked_data)
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.size(), 2u * block_file::prefix_size +
+        genesis_data.size() + unchecked_data.size());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 2u);
+    BOOST_REQUIRE_EQUAL(file.index()[0].offset, block_file::prefix_size);
+    BOOST_REQUIRE_EQUAL(file.index()[0].size, genesis_data.size());
+    BOOST_REQUIRE_EQUAL(file.index()[1].offset, 2u * block_file::prefix_size +
+        genesis_data.size());
+    BOOST_REQUIRE_EQUAL(file.index()[1].size, unchecked_data.size());
+    BOOST_REQUIRE_EQUAL(file.at(0), genesis_data);
+    BOOST_REQUIRE_EQUAL(file.at(1), unchecked_data);
+    BOOST_REQUIRE(file.at(2).empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__zero_padding__valid)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        data_chunk(42, 0x00)
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 1u);
+    BOOST_REQUIRE_EQUAL(file.at(0), genesis_data);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__short_zero_padding__valid)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        data_chunk(3, 0x00)
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__nonzero_after_padding__invalid_prefix)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        data_chunk(42, 0x00),
+        to_record(genesis_data)
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(!file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__zero_leading_magic__expected_index)
+{
+    // The first (little-endian) byte of this magic is zero.
+    constexpr uint32_t zero_magic = 0x09110a00;
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data, zero_magic),
+        to_record(unchecked_data, zero_magic),
+        data_chunk(42, 0x00)
+    })));
+
+    const block_file file(TEST_NAME, zero_magic);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 2u);
+    BOOST_REQUIRE_EQUAL(file.at(0), genesis_data);
+    BOOST_REQUIRE_EQUAL(file.at(1), unchecked_data);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__unexpected_magic__invalid_prefix)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        to_record(genesis_data, 0x0709110b)
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(!file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 1u);
+    BOOST_REQUIRE_EQUAL(file.at(0), genesis_data);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__truncated__invalid_prefix)
+{
+    const auto record = to_record(genesis_data);
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        record,
+        { record.begin(), std::prev(record.end()) }
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(!file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__construct__oversized__invalid)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_little_endian(magic),
+        to_little_endian(add1(possible_narrow_cast<uint32_t>(
+            max_block_weight)))
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(!file.is_valid());
+    BOOST_REQUIRE(file.index().empty());
+}
+
+// scan
+
+BOOST_AUTO_TEST_CASE(block_file__scan__records__expected_order_and_codes)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        to_record(unchecked_data),
+        to_record(genesis_data)
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(file.is_valid());
+
+    std::vector<size_t> positions{};
+    std::vector<code> codes{};
+    std::vector<block::cptr> blocks{};
+    BOOST_REQUIRE(file.scan([&](const block::cptr& block, const code& ec,
+        size_t position) NOEXCEPT
+        {
+            positions.push_back(position);
+            codes.push_back(ec);
+            blocks.push_back(block);
+            return true;
+        }, true, 2));
+
+    BOOST_REQUIRE_EQUAL(positions, (std::vector<size_t>{ 0, 1, 2 }));
+    BOOST_REQUIRE(*blocks[0] == genesis);
+    BOOST_REQUIRE(*blocks[1] == unchecked);
+    BOOST_REQUIRE(*blocks[2] == genesis);
+    BOOST_REQUIRE_EQUAL(codes[0], error::block_success);
+    BOOST_REQUIRE(codes[1]);
+    BOOST_REQUIRE_EQUAL(codes[2], error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__scan__zero_batch__all_blocks)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        to_record(genesis_data)
+    })));
+
+    size_t count{};
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(file.scan([&](const block::cptr&, const code&, size_t)
+        NOEXCEPT
+        {
+            ++count;
+            return true;
+        }, true, 0));
+
+    BOOST_REQUIRE_EQUAL(count, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__scan__handler_false__stopped)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        to_record(genesis_data)
+    })));
+
+    size_t count{};
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(!file.scan([&](const block::cptr&, const code&, size_t)
+        NOEXCEPT
+        {
+            ++count;
+            return false;
+        }, true, 2));
+
+    BOOST_REQUIRE_EQUAL(count, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__scan__undeserializable__stopped_before)
+{
+    BOOST_REQUIRE(write(TEST_NAME, build_chunk(
+    {
+        to_record(genesis_data),
+        to_record(data_chunk{ 0x01, 0x02, 0x03 }),
+        to_record(genesis_data)
+    })));
+
+    const block_file file(TEST_NAME, magic);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 3u);
+
+    size_t count{};
+    BOOST_REQUIRE(!file.scan([&](const block::cptr&, const code&, size_t)
+        NOEXCEPT
+        {
+            ++count;
+            return true;
+        }, true, 3));
+
+    BOOST_REQUIRE_EQUAL(count, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
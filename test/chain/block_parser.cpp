@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_parser_tests)
+
+using namespace system::chain;
+
+static const auto genesis = settings(selection::mainnet).genesis_block;
+static const auto genesis_data = genesis.to_data(true);
+
+static const transaction witness_tx
+{
+    2,
+    inputs
+    {
+        {
+            point{ null_hash, 42 },
+            script{},
+            witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } },
+            0xfffffffe
+        }
+    },
+    outputs
+    {
+        { 1000, script{} }
+    },
+    24
+};
+
+static const auto witness_tx_data = witness_tx.to_data(true);
+static const block witness_block
+{
+    genesis.header(),
+    transactions{ *genesis.transactions_ptr()->front(), witness_tx }
+};
+
+static const auto witness_block_data = witness_block.to_data(true);
+
+// push
+
+BOOST_AUTO_TEST_CASE(block_parser__push__genesis__complete)
+{
+    block_parser parser(true);
+    BOOST_REQUIRE(parser.push(genesis_data));
+    BOOST_REQUIRE(parser.is_complete());
+    BOOST_REQUIRE(!parser.is_invalid());
+    BOOST_REQUIRE_EQUAL(parser.pending(), zero);
+    BOOST_REQUIRE_EQUAL(parser.expected(), 1u);
+    BOOST_REQUIRE_EQUAL(parser.transactions().size(), 1u);
+    BOOST_REQUIRE(parser.to_block() == genesis);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__genesis_bytewise__complete_on_last)
+{
+    block_parser parser(true);
+    const auto last = sub1(genesis_data.size());
+    for (size_t byte = 0; byte < last; ++byte)
+    {
+        BOOST_REQUIRE(parser.push({ genesis_data[byte] }));
+        BOOST_REQUIRE(!parser.is_complete());
+    }
+
+    BOOST_REQUIRE(parser.header_ptr());
+    BOOST_REQUIRE(*parser.header_ptr() == genesis.header());
+    BOOST_REQUIRE(parser.push({ genesis_data[last] }));
+    BOOST_REQUIRE(parser.is_complete());
+    BOOST_REQUIRE(parser.to_block() == genesis);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__witness_block_chunks__expected)
+{
+    constexpr size_t chunk = 7;
+    block_parser parser(true);
+    for (size_t start = 0; start < witness_block_data.size(); start += chunk)
+    {
+        const auto end = std::min(start + chunk, witness_block_data.size());
+        BOOST_REQUIRE(parser.push(
+        {
+            std::next(witness_block_data.begin(), start),
+            std::next(witness_block_data.begin(), end)
+        }));
+    }
+
+    const block expected(witness_block_data, true);
+    BOOST_REQUIRE(parser.is_complete());
+    BOOST_REQUIRE(parser.to_block() == expected);
+    BOOST_REQUIRE(parser.transactions().back()->is_segregated());
+    BOOST_REQUIRE_EQUAL(parser.to_block().to_data(true), witness_block_data);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__witness_block_no_witness__expected)
+{
+    block_parser parser(false);
+    BOOST_REQUIRE(parser.push(witness_block_data));
+    BOOST_REQUIRE(parser.is_complete());
+    BOOST_REQUIRE(parser.to_block() == block(witness_block_data, false));
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__all_but_last_byte__first_transaction)
+{
+    block_parser parser(true);
+    const data_slice partial
+    {
+        witness_block_data.begin(),
+        std::prev(witness_block_data.end())
+    };
+
+    BOOST_REQUIRE(parser.push(partial));
+    BOOST_REQUIRE(!parser.is_complete());
+    BOOST_REQUIRE(!parser.is_invalid());
+    BOOST_REQUIRE_EQUAL(parser.expected(), 2u);
+    BOOST_REQUIRE_EQUAL(parser.transactions().size(), 1u);
+    BOOST_REQUIRE_EQUAL(parser.pending(), sub1(witness_tx_data.size()));
+    BOOST_REQUIRE(!parser.to_block().is_valid());
+
+    BOOST_REQUIRE(parser.push({ witness_block_data.back() }));
+    BOOST_REQUIRE(parser.is_complete());
+    BOOST_REQUIRE_EQUAL(parser.pending(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__copy__push_copy__original_unchanged)
+{
+    block_parser parser(true);
+    const data_slice partial
+    {
+        witness_block_data.begin(),
+        std::prev(witness_block_data.end())
+    };
+
+    BOOST_REQUIRE(parser.push(partial));
+    BOOST_REQUIRE_EQUAL(parser.transactions().size(), 1u);
+
+    block_parser copy{ parser };
+    BOOST_REQUIRE(copy.push({ witness_block_data.back() }));
+    BOOST_REQUIRE(copy.is_complete());
+    BOOST_REQUIRE_EQUAL(copy.transactions().size(), 2u);
+    BOOST_REQUIRE(!parser.is_complete());
+    BOOST_REQUIRE_EQUAL(parser.transactions().size(), 1u);
+    BOOST_REQUIRE_EQUAL(parser.pending(), sub1(witness_tx_data.size()));
+
+    block_parser assigned(true);
+    assigned = parser;
+    BOOST_REQUIRE(assigned.push({ witness_block_data.back() }));
+    BOOST_REQUIRE(assigned.is_complete());
+    BOOST_REQUIRE(!parser.is_complete());
+    BOOST_REQUIRE_EQUAL(parser.transactions().size(), 1u);
+
+    BOOST_REQUIRE(parser.push({ witness_block_data.back() }));
+    BOOST_REQUIRE(parser.is_complete());
+    BOOST_REQUIRE_EQUAL(parser.to_block().to_data(true), witness_block_data);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__trailing_bytes__invalid)
+{
+    block_parser parser(true);
+    auto data = genesis_data;
+    data.push_back(0x42);
+    BOOST_REQUIRE(!parser.push(data));
+    BOOST_REQUIRE(parser.is_invalid());
+    BOOST_REQUIRE(!parser.is_complete());
+    BOOST_REQUIRE(!parser.to_block().is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__after_complete__empty_valid_else_invalid)
+{
+    block_parser parser(true);
+    BOOST_REQUIRE(parser.push(genesis_data));
+    BOOST_REQUIRE(parser.push({}));
+    BOOST_REQUIRE(parser.is_complete());
+    BOOST_REQUIRE(!parser.push({ 0x42 }));
+    BOOST_REQUIRE(parser.is_invalid());
+    BOOST_REQUIRE(!parser.push(genesis_data));
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__excessive_count__invalid)
+{
+    block_parser parser(true);
+    auto data = genesis.header().to_data();
+    data.push_back(varint_four_bytes);
+    data.insert(data.end(), { 0xff, 0xff, 0xff, 0x00 });
+    BOOST_REQUIRE(!parser.push(data));
+    BOOST_REQUIRE(parser.is_invalid());
+}
+
+// transaction_size
+
+BOOST_AUTO_TEST_CASE(block_parser__transaction_size__witness_tx__serialized_size)
+{
+    auto invalid = false;
+    const auto size = block_parser::transaction_size(witness_tx_data, invalid);
+    BOOST_REQUIRE(!invalid);
+    BOOST_REQUIRE_EQUAL(size, witness_tx.serialized_size(true));
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__transaction_size__truncated__zero_valid)
+{
+    auto invalid = false;
+    const data_slice partial
+    {
+        witness_tx_data.begin(),
+        std::prev(witness_tx_data.end())
+    };
+
+    BOOST_REQUIRE_EQUAL(block_parser::transaction_size(partial, invalid), zero);
+    BOOST_REQUIRE(!invalid);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__transaction_size__truncated__required_lower_bound)
+{
+    auto invalid = false;
+    auto required = zero;
+    const data_slice partial
+    {
+        witness_tx_data.begin(),
+        std::prev(witness_tx_data.end())
+    };
+
+    BOOST_REQUIRE_EQUAL(block_parser::transaction_size(partial, invalid, required), zero);
+    BOOST_REQUIRE(!invalid);
+    BOOST_REQUIRE_EQUAL(required, witness_tx_data.size());
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__transaction_size__truncated_script__required_script_end)
+{
+    auto invalid = false;
+    auto required = zero;
+    const data_chunk data
+    {
+        0x01, 0x00, 0x00, 0x00,
+        0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        0x64, 0x00
+    };
+
+    BOOST_REQUIRE_EQUAL(block_parser::transaction_size(data, invalid, required), zero);
+    BOOST_REQUIRE(!invalid);
+    BOOST_REQUIRE_EQUAL(required, 42u + 0x64u);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__transaction_size__excessive_script__zero_invalid)
+{
+    auto invalid = false;
+    const data_chunk data
+    {
+        0x01, 0x00, 0x00, 0x00,
+        0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00,
+        varint_eight_bytes, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    };
+
+    BOOST_REQUIRE_EQUAL(block_parser::transaction_size(data, invalid), zero);
+    BOOST_REQUIRE(invalid);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -55,4 +55,338 @@ BOOST_AUTO_TEST_CASE(chain_state__work_required_retarget__overflow_patch_enabled
     BOOST_REQUIRE_EQUAL(work, settings.proof_of_work_limit);
 }
 
+// validate
+
+static chain::header::cptr mine(const hash_digest& previous,
+    uint32_t version, uint32_t timestamp, uint32_t bits,
+    const settings& settings)
+{
+    for (uint32_t nonce = 0;; ++nonce)
+    {
+        const chain::header header{ version, previous, null_hash, timestamp,
+            bits, nonce };
+
+        if (!header.check(settings.timestamp_limit_seconds,
+            settings.proof_of_work_limit))
+            return std::make_shared<const chain::header>(header);
+    }
+}
+
+// Regtest proof of work is satisfied by about half of all nonces.
+static chain::header::cptr mine(const hash_digest& previous,
+    uint32_t timestamp, const settings& settings)
+{
+    return mine(previous, settings.first_version, timestamp,
+        settings.proof_of_work_limit, settings);
+}
+
+static chain::header_cptrs mine(const hash_digest& previous,
+    uint32_t timestamp, size_t count, const settings& settings)
+{
+    chain::header_cptrs headers{};
+    auto hash = previous;
+    for (size_t index = 0; index < count; ++index)
+    {
+        headers.push_back(mine(hash, timestamp + add1(index) * 600u,
+            settings));
+        hash = headers.back()->hash();
+    }
+
+    return headers;
+}
+
+// State of block 1 on an unforked regtest chain.
+static chain::chain_state::data get_parent(const chain::header& genesis,
+    const chain::header& header)
+{
+    chain::chain_state::data values{};
+    values.height = 1;
+    values.hash = header.hash();
+    values.bits.self = header.bits();
+    values.bits.ordered.push_back(genesis.bits());
+    values.version.self = header.version();
+    values.timestamp.self = header.timestamp();
+    values.timestamp.ordered.push_back(genesis.timestamp());
+    values.timestamp.retarget = genesis.timestamp();
+    return values;
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__validate__empty__success_parent)
+{
+    const settings settings(chain::selection::regtest);
+    const auto& genesis = settings.genesis_block.header();
+    const auto first = mine(genesis.hash(), add1(genesis.timestamp()), settings);
+    const chain::checkpoints checkpoints{};
+    const chain::chain_state parent{ get_parent(genesis, *first), checkpoints,
+        chain::forks::no_rules, 0, settings };
+
+    code ec{ error::futuristic_timestamp };
+    size_t index{ 42 };
+    const auto top = parent.validate(ec, index, {}, settings);
+    BOOST_REQUIRE(!ec);
+    BOOST_REQUIRE_EQUAL(index, 0u);
+    BOOST_REQUIRE_EQUAL(top->height(), 1u);
+    BOOST_REQUIRE_EQUAL(top->hash(), first->hash());
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__validate__linked__success_top)
+{
+    const settings settings(chain::selection::regtest);
+    const auto& genesis = settings.genesis_block.header();
+    const auto first = mine(genesis.hash(), add1(genesis.timestamp()), settings);
+    const auto headers = mine(first->hash(), first->timestamp(), 20, settings);
+    const chain::checkpoints checkpoints{};
+    const chain::chain_state parent{ get_parent(genesis, *first), checkpoints,
+        chain::forks::no_rules, 0, settings };
+
+    code ec{};
+    size_t index{};
+    const auto top = parent.validate(ec, index, headers, settings);
+    BOOST_REQUIRE(!ec);
+    BOOST_REQUIRE_EQUAL(index, headers.size());
+    BOOST_REQUIRE_EQUAL(top->height(), add1(headers.size()));
+    BOOST_REQUIRE_EQUAL(top->hash(), headers.back()->hash());
+    BOOST_REQUIRE_EQUAL(top->timestamp(), headers.back()->timestamp());
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__validate__unlinked__orphan_header_last_valid)
+{
+    const settings settings(chain::selection::regtest);
+    const auto& genesis = settings.genesis_block.header();
+    const auto first = mine(genesis.hash(), add1(genesis.timestamp()), settings);
+    auto headers = mine(first->hash(), first->timestamp(), 20, settings);
+    headers.at(10) = mine(null_hash, headers.at(10)->timestamp(), settings);
+    const chain::checkpoints checkpoints{};
+    const chain::chain_state parent{ get_parent(genesis, *first), checkpoints,
+        chain::forks::no_rules, 0, settings };
+
+    code ec{};
+    size_t index{};
+    const auto top = parent.validate(ec, index, headers, settings);
+    BOOST_REQUIRE_EQUAL(ec, error::orphan_header);
+    BOOST_REQUIRE_EQUAL(index, 10u);
+    BOOST_REQUIRE_EQUAL(top->height(), 11u);
+    BOOST_REQUIRE_EQUAL(top->hash(), headers.at(9)->hash());
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__validate__early_timestamp__timestamp_too_early_last_valid)
+{
+    const settings settings(chain::selection::regtest);
+    const auto& genesis = settings.genesis_block.header();
+    const auto first = mine(genesis.hash(), add1(genesis.timestamp()), settings);
+    auto headers = mine(first->hash(), first->timestamp(), 5, settings);
+    auto tail = mine(headers.back()->hash(), genesis.timestamp(), 1, settings);
+    headers.push_back(tail.front());
+    const chain::checkpoints checkpoints{};
+    const chain::chain_state parent{ get_parent(genesis, *first), checkpoints,
+        chain::forks::no_rules, 0, settings };
+
+    code ec{};
+    size_t index{};
+    const auto top = parent.validate(ec, index, headers, settings);
+    BOOST_REQUIRE_EQUAL(ec, error::timestamp_too_early);
+    BOOST_REQUIRE_EQUAL(index, 5u);
+    BOOST_REQUIRE_EQUAL(top->height(), 6u);
+    BOOST_REQUIRE_EQUAL(top->hash(), headers.at(4)->hash());
+}
+
+// validate (forked)
+
+// Regtest with mainnet difficulty, a four block retarget interval and frozen
+// bip34/66/65 activations, so that work and version requirements both move.
+static settings get_forked_settings()
+{
+    settings settings(chain::selection::regtest);
+    settings.retargeting_interval_seconds = 4u * settings.block_spacing_seconds;
+    settings.bip34_freeze = 2;
+    settings.bip66_freeze = 3;
+    settings.bip65_freeze = 5;
+    return settings;
+}
+
+constexpr uint32_t forked_rules = chain::forks::difficult |
+    chain::forks::retarget | chain::forks::bip34_rule |
+    chain::forks::bip66_rule | chain::forks::bip65_rule |
+    chain::forks::bip90_rule;
+
+// Retargeting quadruples this target without overflowing 256 bits.
+constexpr uint32_t forked_bits = 0x1f03ffff;
+
+// Spacing above the target spacing makes the retarget easier.
+constexpr uint32_t forked_spacing = 3600;
+
+// Mine headers on parent, each meeting the requirements of its own height,
+// except that the header at index early has a timestamp equal to the median
+// time past and the header at index expired has a version below the minimum.
+static chain::header_cptrs mine(const chain::chain_state& parent,
+    size_t count, const settings& settings, size_t early = max_size_t,
+    size_t expired = max_size_t)
+{
+    chain::header_cptrs headers{};
+    auto state = std::make_shared<chain::chain_state>(parent);
+    for (size_t index = 0; index < count; ++index)
+    {
+        const chain::chain_state pool{ *state, settings };
+        const auto version = pool.minimum_block_version();
+        const auto timestamp = state->timestamp() + forked_spacing;
+
+        headers.push_back(mine(state->hash(),
+            index == expired ? sub1(version) : version,
+            index == early ? pool.median_time_past() : timestamp,
+            pool.work_required(), settings));
+
+        state = std::make_shared<chain::chain_state>(*state,
+            *headers.back(), settings);
+    }
+
+    return headers;
+}
+
+// Accept headers one at a time, each against the state of its own height.
+static chain::chain_state::ptr accept(code& ec, size_t& index,
+    const chain::chain_state& parent, const chain::header_cptrs& headers,
+    const settings& settings)
+{
+    auto state = std::make_shared<chain::chain_state>(parent);
+    for (index = 0; index < headers.size(); ++index)
+    {
+        const auto& header = *headers.at(index);
+        if ((ec = header.check(settings.timestamp_limit_seconds,
+            settings.proof_of_work_limit)))
+            break;
+
+        if (header.previous_block_hash() != state->hash())
+        {
+            ec = error::orphan_header;
+            break;
+        }
+
+        const auto next = std::make_shared<chain::chain_state>(*state,
+            header, settings);
+
+        if ((ec = header.accept(*next)))
+            break;
+
+        state = next;
+    }
+
+    if (index == headers.size())
+        ec = error::success;
+
+    return state;
+}
+
+static void require_equal(const chain::chain_state& left,
+    const chain::chain_state& right, const settings& settings)
+{
+    BOOST_REQUIRE_EQUAL(left.height(), right.height());
+    BOOST_REQUIRE_EQUAL(left.hash(), right.hash());
+    BOOST_REQUIRE_EQUAL(left.timestamp(), right.timestamp());
+    BOOST_REQUIRE_EQUAL(left.median_time_past(), right.median_time_past());
+    BOOST_REQUIRE_EQUAL(left.work_required(), right.work_required());
+    BOOST_REQUIRE_EQUAL(left.minimum_block_version(),
+        right.minimum_block_version());
+    BOOST_REQUIRE_EQUAL(left.forks(), right.forks());
+
+    // Promoted state also depends upon the retained history.
+    const chain::chain_state left_pool{ left, settings };
+    const chain::chain_state right_pool{ right, settings };
+    BOOST_REQUIRE_EQUAL(left_pool.work_required(), right_pool.work_required());
+    BOOST_REQUIRE_EQUAL(left_pool.median_time_past(),
+        right_pool.median_time_past());
+    BOOST_REQUIRE_EQUAL(left_pool.minimum_block_version(),
+        right_pool.minimum_block_version());
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__validate__forked_retarget__accept_equivalent)
+{
+    const auto settings = get_forked_settings();
+    const auto& genesis = settings.genesis_block.header();
+    const auto first = mine(genesis.hash(), settings.first_version,
+        add1(genesis.timestamp()), forked_bits, settings);
+    const chain::checkpoints checkpoints{};
+    const chain::chain_state parent{ get_parent(genesis, *first), checkpoints,
+        forked_rules, 0, settings };
+
+    // Heights 2..7, with the retarget at height 4 (index 2).
+    const auto headers = mine(parent, 6, settings);
+    BOOST_REQUIRE_EQUAL(headers.at(1)->bits(), forked_bits);
+    BOOST_REQUIRE_NE(headers.at(2)->bits(), forked_bits);
+    BOOST_REQUIRE_EQUAL(headers.back()->version(), settings.bip65_version);
+
+    code ec{};
+    size_t index{};
+    const auto top = parent.validate(ec, index, headers, settings);
+    BOOST_REQUIRE(!ec);
+    BOOST_REQUIRE_EQUAL(index, headers.size());
+
+    code expected_ec{ error::futuristic_timestamp };
+    size_t expected_index{};
+    const auto expected = accept(expected_ec, expected_index, parent, headers,
+        settings);
+    BOOST_REQUIRE(!expected_ec);
+    BOOST_REQUIRE_EQUAL(expected_index, headers.size());
+    BOOST_REQUIRE_EQUAL(top->height(), 7u);
+    require_equal(*top, *expected, settings);
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__validate__forked_expired_version__accept_equivalent)
+{
+    const auto settings = get_forked_settings();
+    const auto& genesis = settings.genesis_block.header();
+    const auto first = mine(genesis.hash(), settings.first_version,
+        add1(genesis.timestamp()), forked_bits, settings);
+    const chain::checkpoints checkpoints{};
+    const chain::chain_state parent{ get_parent(genesis, *first), checkpoints,
+        forked_rules, 0, settings };
+
+    // Height 5 (index 3) follows the retarget and requires bip65_version.
+    const auto headers = mine(parent, 6, settings, max_size_t, 3);
+    BOOST_REQUIRE_EQUAL(headers.at(3)->version(), settings.bip66_version);
+
+    code ec{};
+    size_t index{};
+    const auto top = parent.validate(ec, index, headers, settings);
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_block_version);
+    BOOST_REQUIRE_EQUAL(index, 3u);
+
+    code expected_ec{};
+    size_t expected_index{};
+    const auto expected = accept(expected_ec, expected_index, parent, headers,
+        settings);
+    BOOST_REQUIRE_EQUAL(expected_ec, ec);
+    BOOST_REQUIRE_EQUAL(expected_index, index);
+    BOOST_REQUIRE_EQUAL(top->height(), 4u);
+    require_equal(*top, *expected, settings);
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__validate__forked_early_timestamp__accept_equivalent)
+{
+    const auto settings = get_forked_settings();
+    const auto& genesis = settings.genesis_block.header();
+    const auto first = mine(genesis.hash(), settings.first_version,
+        add1(genesis.timestamp()), forked_bits, settings);
+    const chain::checkpoints checkpoints{};
+    const chain::chain_state parent{ get_parent(genesis, *first), checkpoints,
+        forked_rules, 0, settings };
+
+    // Height 6 (index 4) has a timestamp equal to its median time past.
+    const auto headers = mine(parent, 6, settings, 4);
+
+    code ec{};
+    size_t index{};
+    const auto top = parent.validate(ec, index, headers, settings);
+    BOOST_REQUIRE_EQUAL(ec, error::timestamp_too_early);
+    BOOST_REQUIRE_EQUAL(index, 4u);
+
+    code expected_ec{};
+    size_t expected_index{};
+    const auto expected = accept(expected_ec, expected_index, parent, headers,
+        settings);
+    BOOST_REQUIRE_EQUAL(expected_ec, ec);
+    BOOST_REQUIRE_EQUAL(expected_index, index);
+    BOOST_REQUIRE_EQUAL(top->height(), 5u);
+    require_equal(*top, *expected, settings);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -272,3 +272,19 @@ static_assert(ceilinged_log256(0x0000fffful) == 2);
 // > 0x0000ffff (<= 0x007ffffful) (overflow if exponent > 29 and ceilinged_log256(mantissa) > 3)
 static_assert(ceilinged_log256(0x00010000ul) == 3);
 static_assert(ceilinged_log256(0x007ffffful) == 3);
+
+// fixed width, identical to expand/compress
+
+static_assert(compact::expand_fixed(0x1d00ffffu) == fixed_uint256{ fixed_uint256::limbs_type{ 0, 0, 0, 0x00000000ffff0000_u64 } });
+static_assert(compact::expand_fixed(factory(0, false, 0x007fffff)) == fixed_uint256{ 0x007fffff_u64 });
+static_assert(compact::expand_fixed(factory(-1, false, 0x00ffff)) == fixed_uint256{ 0x000000ff_u64 });
+static_assert(compact::expand_fixed(factory(0, true, 0x007fffff)) == fixed_uint256{});
+static_assert(compact::expand_fixed(factory(32, false, 0x000000ff)) == fixed_uint256{});
+static_assert(compact::compress_fixed(compact::expand_fixed(0x1d00ffffu)) == 0x1d00ffffu);
+static_assert(compact::compress_fixed(compact::expand_fixed(factory(30, false, 0x0000ffff))) == 0x2100ffffu);
+static_assert(compact::compress_fixed(compact::expand_fixed(factory(30, false, 0x007fffff))) == 0x00000000u);
+static_assert(compact::compress_fixed(fixed_uint256{ 0x7bcdef_u64 }) == 0x037bcdeful);
+static_assert(compact::compress_fixed(fixed_uint256{ 0x7bcdefaa_u64 }) == 0x047bcdeful);
+static_assert(compact::compress_fixed(fixed_uint256{ 0x80_u64 }) == 0x02008000ul);
+static_assert(compact::compress_fixed(~fixed_uint256{}) == 0x2100ffffu);
+static_assert(compact::compress_fixed(~fixed_uint256{}) == compact::compress(~uint256_t{ 0 }));
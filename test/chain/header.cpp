@@ -231,12 +231,79 @@ BOOST_AUTO_TEST_CASE(header__to_data__writer__expected)
 
 // hash
 
+BOOST_AUTO_TEST_CASE(header__hash__default__expected)
+{
+    BOOST_REQUIRE_EQUAL(expected_header.hash(), bitcoin_hash(expected_header.to_data()));
+}
+
+BOOST_AUTO_TEST_CASE(header__hash__genesis_block__expected)
+{
+    const chain::block block{ settings(selection::mainnet).genesis_block };
+    BOOST_REQUIRE_EQUAL(encode_hash(block.header().hash()), "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+}
+
+BOOST_AUTO_TEST_CASE(header__hash__midstate__expected)
+{
+    const auto midstate = expected_header.midstate();
+    BOOST_REQUIRE_EQUAL(expected_header.hash(midstate, expected_header.timestamp(), expected_header.nonce()), expected_header.hash());
+}
+
+BOOST_AUTO_TEST_CASE(header__hash__midstate_timestamp_nonce__expected)
+{
+    const header instance{ 10, hash1, hash2, 42, 6523454, 24 };
+    const auto midstate = expected_header.midstate();
+    BOOST_REQUIRE_EQUAL(expected_header.hash(midstate, 42, 24), instance.hash());
+}
+
+BOOST_AUTO_TEST_CASE(header__hash__midstate_nonces__expected)
+{
+    constexpr auto nonce = 0xfffffff0_u32;
+    const auto midstate = expected_header.midstate();
+    hashes out(42);
+    expected_header.hash(out, midstate, 531234, nonce);
+
+    auto counter = nonce;
+    for (const auto& hash: out)
+    {
+        const header instance{ 10, hash1, hash2, 531234, 6523454, counter++ };
+        BOOST_REQUIRE_EQUAL(hash, instance.hash());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(header__hash__twice__cached)
+{
+    const header instance{ expected_header };
+    const auto hash = instance.hash();
+    const auto& cached = instance.get_hash();
+    BOOST_REQUIRE_EQUAL(instance.hash(), hash);
+    BOOST_REQUIRE_EQUAL(&instance.get_hash(), &cached);
+
+    // Copies share the cache filled by hash().
+    const header copy{ instance };
+    BOOST_REQUIRE_EQUAL(&copy.get_hash(), &cached);
+    BOOST_REQUIRE_EQUAL(copy.hash(), hash);
+}
+
+BOOST_AUTO_TEST_CASE(header__get_hash__uncached__expected)
+{
+    const header instance{ expected_header };
+    BOOST_REQUIRE_EQUAL(instance.get_hash(), expected_header.hash());
+    BOOST_REQUIRE_EQUAL(instance.hash(), expected_header.hash());
+}
+
 BOOST_AUTO_TEST_CASE(header__difficulty__genesis_block__expected)
 {
     const chain::block block{ settings(selection::mainnet).genesis_block };
     BOOST_REQUIRE_EQUAL(block.header().difficulty(), 0x0000000100010001);
 }
 
+BOOST_AUTO_TEST_CASE(header__work__genesis_block__expected)
+{
+    const chain::block block{ settings(selection::mainnet).genesis_block };
+    BOOST_REQUIRE(block.header().work() == fixed_uint256{ 0x0000000100010001_u64 });
+    BOOST_REQUIRE_EQUAL(block.header().difficulty(), uint256_t{ 0x0000000100010001_u64 });
+}
+
 // validation (public)
 // ----------------------------------------------------------------------------
 
@@ -285,6 +352,29 @@ BOOST_AUTO_TEST_CASE(header__is_invalid_proof_of_work__hash_less_than_bits_false
     BOOST_REQUIRE(!instance.is_invalid_proof_of_work(settings.proof_of_work_limit, false));
 }
 
+BOOST_AUTO_TEST_CASE(header__check__precomputed_hash__uses_given_hash)
+{
+    const settings settings(selection::mainnet);
+    const header instance
+    {
+        4,
+        base16_hash("000000000000000003ddc1e929e2944b8b0039af9aa0d826c480a83d8b39c373"),
+        base16_hash("a6cb0b0d6531a71abe2daaa4a991e5498e1b6b0b51549568d0f9d55329b905df"),
+        1474388414,
+        402972254,
+        2842832236
+    };
+
+    const auto hash = instance.hash(instance.midstate(), instance.timestamp(),
+        instance.nonce());
+    BOOST_REQUIRE_EQUAL(instance.check(hash, max_uint32,
+        settings.proof_of_work_limit), error::success);
+    const auto high = base16_hash(
+        "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    BOOST_REQUIRE_EQUAL(instance.check(high, max_uint32,
+        settings.proof_of_work_limit), error::invalid_proof_of_work);
+}
+
 BOOST_AUTO_TEST_CASE(header__is_valid_scrypt_proof_of_work__hash_greater_than_bits__false)
 {
     const settings settings(selection::mainnet);
@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(json_reader_tests)
+
+using namespace system::chain;
+
+static const auto genesis = settings(selection::mainnet).genesis_block;
+
+static const transaction witness_tx
+{
+    2,
+    inputs
+    {
+        {
+            point{ one_hash, 42 },
+            script{ { { opcode::op_return }, { opcode::pick } } },
+            witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } },
+            0xfffffffe
+        }
+    },
+    outputs
+    {
+        { max_uint64, script{ { { opcode::roll } } } }
+    },
+    24
+};
+
+static const block witness_block
+{
+    genesis.header(),
+    transactions{ *genesis.transactions_ptr()->front(), witness_tx }
+};
+
+// read_block
+
+BOOST_AUTO_TEST_CASE(json_reader__read_block__genesis__round_trip)
+{
+    const auto text = to_json(genesis);
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(reader.read_block() == genesis);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_block__witness_block__round_trip)
+{
+    const auto text = to_json(witness_block);
+    std::istringstream stream{ text };
+    read::bytes::istream source(stream);
+    json_reader reader(source);
+    BOOST_REQUIRE(reader.read_block() == witness_block);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_block__handlers__expected_sequence)
+{
+    const auto text = to_json(witness_block);
+    read::bytes::copy source(text);
+    json_reader reader(source);
+
+    size_t headers{};
+    transactions txs{};
+    BOOST_REQUIRE(reader.read_block([&](const header::cptr& header) NOEXCEPT
+    {
+        ++headers;
+        return *header == witness_block.header();
+    },
+    [&](const transaction::cptr& tx) NOEXCEPT
+    {
+        BOOST_REQUIRE_EQUAL(headers, one);
+        txs.push_back(*tx);
+        return true;
+    }));
+
+    BOOST_REQUIRE_EQUAL(headers, one);
+    BOOST_REQUIRE_EQUAL(txs.size(), two);
+    BOOST_REQUIRE(txs.back() == witness_tx);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_block__handler_stop__false)
+{
+    const auto text = to_json(witness_block);
+    read::bytes::copy source(text);
+    json_reader reader(source);
+
+    size_t count{};
+    BOOST_REQUIRE(!reader.read_block([](const header::cptr&) NOEXCEPT
+    {
+        return true;
+    },
+    [&](const transaction::cptr&) NOEXCEPT
+    {
+        return is_zero(count++);
+    }));
+
+    BOOST_REQUIRE_EQUAL(count, two);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_block__transactions_before_header__invalid)
+{
+    const std::string text{ "{\"transactions\":[],\"header\":" + to_json(genesis.header()) + "}" };
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(!reader.read_block().is_valid());
+    BOOST_REQUIRE(!reader);
+}
+
+// read_header
+
+BOOST_AUTO_TEST_CASE(json_reader__read_header__reordered_whitespace_unknown__expected)
+{
+    const std::string text
+    {
+        "{\n"
+        "  \"nonce\" : 45,\n"
+        "  \"bits\" : 44,\n"
+        "  \"extra\" : { \"list\" : [ 1, -2.5e3, true, null, \"x\\\"]\" ] },\n"
+        "  \"timestamp\" : 43,\n"
+        "  \"merkle_root\" : \"0000000000000000000000000000000000000000000000000000000000000001\",\n"
+        "  \"previous\" : \"0000000000000000000000000000000000000000000000000000000000000000\",\n"
+        "  \"version\" : 42\n"
+        "}"
+    };
+
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(reader.read_header() == header(42, null_hash, one_hash, 43, 44, 45));
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_header__missing_member__invalid)
+{
+    const std::string text{ "{\"version\":42,\"previous\":\"0000000000000000000000000000000000000000000000000000000000000000\"}" };
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(!reader.read_header().is_valid());
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_header__version_overflow__invalid)
+{
+    auto text = to_json(header{ 42, null_hash, one_hash, 43, 44, 45 });
+    text.replace(text.find("42"), 2, "4294967296");
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(!reader.read_header().is_valid());
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_header__short_hash__invalid)
+{
+    const std::string text{ "{\"version\":42,\"previous\":\"00\",\"merkle_root\":\"00\",\"timestamp\":0,\"bits\":0,\"nonce\":0}" };
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(!reader.read_header().is_valid());
+    BOOST_REQUIRE(!reader);
+}
+
+// read_transaction
+
+BOOST_AUTO_TEST_CASE(json_reader__read_transaction__round_trip)
+{
+    const auto text = to_json(witness_tx);
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(reader.read_transaction() == witness_tx);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_transaction__truncated__invalid)
+{
+    const auto text = to_json(witness_tx);
+    read::bytes::copy source(text.substr(0, sub1(text.size())));
+    json_reader reader(source);
+    BOOST_REQUIRE(!reader.read_transaction().is_valid());
+    BOOST_REQUIRE(!reader);
+}
+
+// read_input/read_output/read_point
+
+BOOST_AUTO_TEST_CASE(json_reader__read_input__round_trip)
+{
+    const auto& instance = *witness_tx.inputs_ptr()->front();
+    const auto text = to_json(instance);
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(reader.read_input() == instance);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_output__max_value__round_trip)
+{
+    const auto& instance = *witness_tx.outputs_ptr()->front();
+    const auto text = to_json(instance);
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(reader.read_output() == instance);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_output__value_overflow__invalid)
+{
+    const std::string text{ "{\"value\":18446744073709551616,\"script\":\"roll\"}" };
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(!reader.read_output().is_valid());
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_point__fraction__invalid)
+{
+    const std::string text{ "{\"hash\":\"0000000000000000000000000000000000000000000000000000000000000001\",\"index\":4.2}" };
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    reader.read_point();
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(json_reader__read_point__escaped_hash__expected)
+{
+    const std::string text{ "{\"index\":42,\"hash\":\"000000000000000000000000000000000000000000000000000000000000000\\u0031\"}" };
+    read::bytes::copy source(text);
+    json_reader reader(source);
+    BOOST_REQUIRE(reader.read_point() == point(one_hash, 42));
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(json_writer_tests)
+
+namespace json = boost::json;
+using namespace system::chain;
+
+static const auto genesis = settings(selection::mainnet).genesis_block;
+
+static const transaction witness_tx
+{
+    2,
+    inputs
+    {
+        {
+            point{ one_hash, 42 },
+            script{ { { opcode::op_return }, { opcode::pick } } },
+            witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } },
+            0xfffffffe
+        }
+    },
+    outputs
+    {
+        { max_uint64, script{ { { opcode::roll } } } }
+    },
+    24
+};
+
+static const block witness_block
+{
+    genesis.header(),
+    transactions{ *genesis.transactions_ptr()->front(), witness_tx }
+};
+
+class accessor
+  : public json_writer
+{
+public:
+    using json_writer::json_writer;
+    using json_writer::write_string;
+};
+
+// to_json
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__genesis__dom_serialization)
+{
+    BOOST_REQUIRE_EQUAL(to_json(genesis), json::serialize(json::value_from(genesis)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__witness_block__dom_serialization)
+{
+    BOOST_REQUIRE_EQUAL(to_json(witness_block), json::serialize(json::value_from(witness_block)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__header__dom_serialization)
+{
+    const header instance{ max_uint32, one_hash, null_hash, 0, 1, max_uint32 };
+    BOOST_REQUIRE_EQUAL(to_json(instance), json::serialize(json::value_from(instance)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__transaction__dom_serialization)
+{
+    BOOST_REQUIRE_EQUAL(to_json(witness_tx), json::serialize(json::value_from(witness_tx)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__input__dom_serialization)
+{
+    const auto& instance = *witness_tx.inputs_ptr()->front();
+    BOOST_REQUIRE_EQUAL(to_json(instance), json::serialize(json::value_from(instance)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__output__expected)
+{
+    const auto& instance = *witness_tx.outputs_ptr()->front();
+    BOOST_REQUIRE_EQUAL(to_json(instance), "{\"value\":18446744073709551615,\"script\":\"roll\"}");
+    BOOST_REQUIRE_EQUAL(to_json(instance), json::serialize(json::value_from(instance)));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__to_json__default_transaction__expected)
+{
+    BOOST_REQUIRE_EQUAL(to_json(transaction{}), "{\"version\":0,\"inputs\":[],\"outputs\":[],\"locktime\":0}");
+}
+
+// write
+
+BOOST_AUTO_TEST_CASE(json_writer__write__ostream__to_json)
+{
+    std::ostringstream stream{};
+    write::bytes::ostream sink(stream);
+    json_writer writer(sink);
+    writer.write(witness_block);
+    writer.flush();
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE_EQUAL(stream.str(), to_json(witness_block));
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__write__point__expected)
+{
+    std::string out{};
+    write::bytes::text sink(out);
+    json_writer writer(sink);
+    writer.write(point{ one_hash, 42 });
+    writer.flush();
+    BOOST_REQUIRE_EQUAL(out, "{\"hash\":\"0000000000000000000000000000000000000000000000000000000000000001\",\"index\":42}");
+}
+
+BOOST_AUTO_TEST_CASE(json_writer__write__exhausted_sink__invalid)
+{
+    data_array<8> buffer{};
+    write::bytes::copy sink(buffer);
+    json_writer writer(sink);
+    writer.write(genesis.header());
+    BOOST_REQUIRE(!writer);
+}
+
+// write_string
+
+BOOST_AUTO_TEST_CASE(json_writer__write_string__escapes__dom_serialization)
+{
+    const std::string text{ "a\"b\\c\b\f\n\r\t\x01\x1f/z" };
+    std::string out{};
+    write::bytes::text sink(out);
+    accessor writer(sink);
+    writer.write_string(text);
+    writer.flush();
+    BOOST_REQUIRE_EQUAL(out, json::serialize(json::value(text)));
+    BOOST_REQUIRE_EQUAL(out, "\"a\\\"b\\\\c\\b\\f\\n\\r\\t\\u0001\\u001f/z\"");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -328,6 +328,25 @@ BOOST_AUTO_TEST_CASE(script__empty__non_empty__false)
     BOOST_REQUIRE(!instance.ops().empty());
 }
 
+BOOST_AUTO_TEST_CASE(script__serialized_size__multisig__expected)
+{
+    const script instance(script_2_of_3_multisig);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), 1u + 3u * 34u + 1u + 1u);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), add1(instance.serialized_size(false)));
+    BOOST_REQUIRE_EQUAL(instance.to_data(true).size(), instance.serialized_size(true));
+}
+
+BOOST_AUTO_TEST_CASE(script__serialized_size__offset__excludes_preceding_operations)
+{
+    const script instance(script_2_of_3_multisig);
+    instance.offset = std::next(instance.ops().begin(), 4);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), 2u);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false).size(), 2u);
+
+    instance.offset = instance.ops().begin();
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), 1u + 3u * 34u + 1u + 1u);
+}
+
 // Pattern matching tests.
 // -----------------------------------------------------------------------------
 
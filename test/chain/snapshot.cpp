@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+struct snapshot_tests_setup_fixture
+{
+    snapshot_tests_setup_fixture()
+    {
+        test::remove(TEST_NAME);
+    }
+
+    ~snapshot_tests_setup_fixture()
+    {
+        test::remove(TEST_NAME);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(snapshot_tests, snapshot_tests_setup_fixture)
+
+using namespace system::chain;
+
+static const auto genesis = settings(selection::mainnet).genesis_block;
+
+static const transaction witness_tx
+{
+    2,
+    inputs
+    {
+        {
+            point{ one_hash, 42 },
+            script{ { { opcode::op_return }, { opcode::pick } } },
+            witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } },
+            0xfffffffe
+        }
+    },
+    outputs
+    {
+        { 1000, script{ { { opcode::roll } } } }
+    },
+    24
+};
+
+// The last operation of the script is an underflow (push of 42 bytes).
+static const auto underflow_script = script{ base16_chunk("2a0102"), false };
+
+static const transaction underflow_tx
+{
+    1,
+    inputs{ { point{ null_hash, 7 }, underflow_script, 0 } },
+    outputs{ { 42, script{} } },
+    0
+};
+
+static bool write(const std::string& path,
+    const std::function<void(writer&)>& records) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    ofstream file(path, std::ofstream::binary);
+    write::bytes::ostream sink(file);
+    snapshot::write_prefix(sink);
+    records(sink);
+    sink.flush();
+    return file.good();
+    BC_POP_WARNING()
+}
+
+// construct
+
+BOOST_AUTO_TEST_CASE(snapshot__construct__missing__invalid)
+{
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(!file.is_valid());
+    BOOST_REQUIRE(file.index().empty());
+    BOOST_REQUIRE_EQUAL(file.size(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(snapshot__construct__empty__valid)
+{
+    BOOST_REQUIRE(test::create(TEST_NAME));
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE(file.index().empty());
+}
+
+BOOST_AUTO_TEST_CASE(snapshot__construct__prefix_only__valid)
+{
+    BOOST_REQUIRE(write(TEST_NAME, [](writer&) NOEXCEPT {}));
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE(file.index().empty());
+    BOOST_REQUIRE_EQUAL(file.size(), snapshot::prefix_size);
+}
+
+BOOST_AUTO_TEST_CASE(snapshot__construct__unexpected_version__invalid)
+{
+    data_chunk data{};
+    write::bytes::data sink(data);
+    sink.write_4_bytes_little_endian(snapshot::magic);
+    sink.write_4_bytes_little_endian(add1(snapshot::version));
+    sink.flush();
+
+    ofstream out(TEST_NAME, std::ofstream::binary);
+    out.write(pointer_cast<const char>(data.data()), data.size());
+    out.close();
+
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(!file.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(snapshot__construct__truncated_record__invalid_preceding_retained)
+{
+    BOOST_REQUIRE(write(TEST_NAME, [](writer& sink) NOEXCEPT
+    {
+        snapshot::write(sink, witness_tx, 1);
+        sink.write_byte(static_cast<uint8_t>(snapshot::kind::transaction));
+        sink.write_4_bytes_little_endian(42);
+        sink.write_4_bytes_little_endian(0);
+    }));
+
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(!file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), one);
+    BOOST_REQUIRE(*file.get_transaction(0) == witness_tx);
+}
+
+// get_transaction
+
+BOOST_AUTO_TEST_CASE(snapshot__get_transaction__witness_tx__cached_metadata)
+{
+    BOOST_REQUIRE(write(TEST_NAME, [](writer& sink) NOEXCEPT
+    {
+        snapshot::write(sink, witness_tx, 42);
+    }));
+
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), one);
+    BOOST_REQUIRE(file.index().front().kind == snapshot::kind::transaction);
+    BOOST_REQUIRE_EQUAL(file.index().front().sigops, 42u);
+
+    const auto tx = file.get_transaction(0);
+    BOOST_REQUIRE(tx);
+    BOOST_REQUIRE(tx->is_valid());
+    BOOST_REQUIRE(*tx == witness_tx);
+    BOOST_REQUIRE(tx->is_segregated());
+    BOOST_REQUIRE_EQUAL(tx->hash(false), witness_tx.hash(false));
+    BOOST_REQUIRE_EQUAL(tx->hash(true), witness_tx.hash(true));
+    BOOST_REQUIRE_EQUAL(tx->serialized_size(false), witness_tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(tx->serialized_size(true), witness_tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(tx->to_data(true), witness_tx.to_data(true));
+}
+
+BOOST_AUTO_TEST_CASE(snapshot__get_transaction__underflow_script__round_trip)
+{
+    BOOST_REQUIRE(underflow_script.ops().back().is_underflow());
+    BOOST_REQUIRE(write(TEST_NAME, [](writer& sink) NOEXCEPT
+    {
+        snapshot::write(sink, underflow_tx, 0);
+    }));
+
+    const snapshot file(TEST_NAME);
+    const auto tx = file.get_transaction(0);
+    BOOST_REQUIRE(tx);
+    BOOST_REQUIRE(*tx == underflow_tx);
+    BOOST_REQUIRE(tx->inputs_ptr()->front()->script().ops().back().is_underflow());
+    BOOST_REQUIRE_EQUAL(tx->to_data(false), underflow_tx.to_data(false));
+}
+
+BOOST_AUTO_TEST_CASE(snapshot__get_transaction__block_record__nullptr)
+{
+    BOOST_REQUIRE(write(TEST_NAME, [](writer& sink) NOEXCEPT
+    {
+        snapshot::write(sink, genesis, 1);
+    }));
+
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE(!file.get_transaction(0));
+    BOOST_REQUIRE(!file.get_transaction(1));
+}
+
+// get_block
+
+BOOST_AUTO_TEST_CASE(snapshot__get_block__genesis__expected)
+{
+    BOOST_REQUIRE(write(TEST_NAME, [](writer& sink) NOEXCEPT
+    {
+        snapshot::write(sink, genesis, 1);
+    }));
+
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE(file.index().front().kind == snapshot::kind::block);
+
+    const auto block = file.get_block(0);
+    BOOST_REQUIRE(block);
+    BOOST_REQUIRE(*block == genesis);
+    BOOST_REQUIRE_EQUAL(block->hash(), genesis.hash());
+    BOOST_REQUIRE_EQUAL(block->serialized_size(true), genesis.serialized_size(true));
+    BOOST_REQUIRE(!block->check());
+}
+
+// scan
+
+BOOST_AUTO_TEST_CASE(snapshot__scan__mixed__file_order)
+{
+    const block witness_block
+    {
+        genesis.header(),
+        transactions{ *genesis.transactions_ptr()->front(), witness_tx }
+    };
+
+    BOOST_REQUIRE(write(TEST_NAME, [&](writer& sink) NOEXCEPT
+    {
+        snapshot::write(sink, witness_tx, 1);
+        snapshot::write(sink, witness_block, 2);
+        snapshot::write(sink, underflow_tx, 3);
+        snapshot::write(sink, genesis, 4);
+    }));
+
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(file.is_valid());
+    BOOST_REQUIRE_EQUAL(file.index().size(), 4u);
+
+    std::vector<size_t> order{};
+    const auto success = file.scan(
+        [&](const block::cptr& block, size_t sigops, size_t index) NOEXCEPT
+        {
+            BOOST_REQUIRE_EQUAL(sigops, add1(index));
+            BOOST_REQUIRE(*block == (index == 1u ? witness_block : genesis));
+            order.push_back(index);
+            return true;
+        },
+        [&](const transaction::cptr& tx, size_t sigops, size_t index) NOEXCEPT
+        {
+            BOOST_REQUIRE_EQUAL(sigops, add1(index));
+            BOOST_REQUIRE(*tx == (is_zero(index) ? witness_tx : underflow_tx));
+            order.push_back(index);
+            return true;
+        }, 3);
+
+    BOOST_REQUIRE(success);
+    BOOST_REQUIRE((order == std::vector<size_t>{ 0, 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(snapshot__scan__handler_stop__false)
+{
+    BOOST_REQUIRE(write(TEST_NAME, [](writer& sink) NOEXCEPT
+    {
+        snapshot::write(sink, witness_tx, 0);
+        snapshot::write(sink, witness_tx, 0);
+    }));
+
+    size_t count{};
+    const snapshot file(TEST_NAME);
+    BOOST_REQUIRE(!file.scan(
+        [](const block::cptr&, size_t, size_t) NOEXCEPT { return true; },
+        [&](const transaction::cptr&, size_t, size_t) NOEXCEPT
+        {
+            ++count;
+            return false;
+        }, 16));
+
+    BOOST_REQUIRE_EQUAL(count, one);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
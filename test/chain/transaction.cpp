@@ -167,6 +167,21 @@ public:
         return transaction::is_confirmed_double_spend(height);
     }
 
+    // Copies share the identity hashes cached by deserialization.
+    accessor(const transaction& other)
+      : transaction(other)
+    {
+    }
+
+    const hash_digest* nominal_hash() const
+    {
+        return transaction::nominal_hash_.get();
+    }
+
+    const hash_digest* witness_hash() const
+    {
+        return transaction::witness_hash_.get();
+    }
 };
 
 // constructors
@@ -296,6 +311,224 @@ BOOST_AUTO_TEST_CASE(transaction__constructor__reader_2__success)
     BOOST_REQUIRE_EQUAL(tx.serialized_size(true), tx2_data.size());
 }
 
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_1__success)
+{
+    read::bytes::fast source(tx1_data);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx1_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx1_data);
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true), tx1_data.size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_2__success)
+{
+    read::bytes::fast source(tx2_data);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx2_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx2_data);
+    BOOST_REQUIRE_EQUAL(tx.serialized_size(true), tx2_data.size());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_truncated__invalid)
+{
+    const data_slice truncated(tx1_data.begin(), std::prev(tx1_data.end()));
+    read::bytes::fast source(truncated);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(!tx.is_valid());
+    BOOST_REQUIRE(!source);
+}
+
+static const transaction witness_tx
+{
+    2,
+    inputs
+    {
+        {
+            point{ null_hash, 42 },
+            script{},
+            witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } },
+            0xfffffffe
+        }
+    },
+    outputs
+    {
+        { 1000, script{} }
+    },
+    24
+};
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__hash_reader_1__expected_hashes)
+{
+    stream::in::copy stream(tx1_data);
+    hash::sha256x2::istream source(stream);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx1_hash);
+    BOOST_REQUIRE_EQUAL(tx.hash(true), tx1_hash);
+    BOOST_REQUIRE_EQUAL(source.nominal_hash(), tx1_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx1_data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__hash_reader_segregated__expected_hashes)
+{
+    const auto data = witness_tx.to_data(true);
+    stream::in::copy stream(data);
+    hash::sha256x2::istream source(stream);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx.is_segregated());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), bitcoin_hash(witness_tx.to_data(false)));
+    BOOST_REQUIRE_EQUAL(tx.hash(true), bitcoin_hash(data));
+    BOOST_REQUIRE_EQUAL(tx.hash(false), witness_tx.hash(false));
+    BOOST_REQUIRE_EQUAL(tx.hash(true), witness_tx.hash(true));
+    BOOST_REQUIRE(tx == witness_tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__hash_reader_no_witness__expected_nominal_hash)
+{
+    const auto data = witness_tx.to_data(true);
+    stream::in::copy stream(data);
+    hash::sha256x2::istream source(stream);
+    const transaction tx(source, false);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), witness_tx.hash(false));
+    BOOST_REQUIRE_EQUAL(source.witness_hash(), witness_tx.hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__hash_reader_copy__shares_hashes)
+{
+    const auto data = witness_tx.to_data(true);
+    stream::in::copy stream(data);
+    hash::sha256x2::istream source(stream);
+    const transaction tx(source, true);
+    const transaction copy(tx);
+    BOOST_REQUIRE_EQUAL(copy.hash(false), tx.hash(false));
+    BOOST_REQUIRE_EQUAL(copy.hash(true), tx.hash(true));
+}
+
+static const transaction witness_script_tx
+{
+    2,
+    inputs
+    {
+        {
+            point{ null_hash, 42 },
+            script{ base16_chunk("160014d9d78e26df4e4601cf9b26d09c7b280ee764469f"), false },
+            witness{ data_stack{ { 0x01, 0x02 }, { 0x03 } } },
+            0xfffffffe
+        }
+    },
+    outputs
+    {
+        { 1000, script{ base16_chunk("76a914d9d78e26df4e4601cf9b26d09c7b280ee764469f88ac"), false } }
+    },
+    24
+};
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__hash_reader_segregated_scripts__expected_hashes)
+{
+    const auto data = witness_script_tx.to_data(true);
+    stream::in::copy stream(data);
+    hash::sha256x2::istream source(stream);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx.is_segregated());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(!tx.inputs_ptr()->front()->script().ops().empty());
+    BOOST_REQUIRE(!tx.outputs_ptr()->front()->script().ops().empty());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), bitcoin_hash(witness_script_tx.to_data(false)));
+    BOOST_REQUIRE_EQUAL(tx.hash(true), bitcoin_hash(data));
+    BOOST_REQUIRE(tx == witness_script_tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__hash_reader_2__expected_hashes)
+{
+    stream::in::copy stream(tx2_data);
+    hash::sha256x2::istream source(stream);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx2_hash);
+    BOOST_REQUIRE_EQUAL(source.witness_hash(), tx2_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx2_data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__hash_reader_truncated__invalid)
+{
+    const data_chunk truncated(tx1_data.begin(), std::prev(tx1_data.end()));
+    stream::in::copy stream(truncated);
+    hash::sha256x2::istream source(stream);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(!tx.is_valid());
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_segregated__cached_hashes)
+{
+    const auto data = witness_tx.to_data(true);
+    const accessor tx(transaction{ data, true });
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx.nominal_hash() != nullptr);
+    BOOST_REQUIRE(tx.witness_hash() != nullptr);
+    BOOST_REQUIRE_EQUAL(*tx.nominal_hash(), bitcoin_hash(witness_tx.to_data(false)));
+    BOOST_REQUIRE_EQUAL(*tx.witness_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_no_witness__cached_nominal_hash)
+{
+    const accessor tx(transaction{ witness_tx.to_data(true), false });
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx.nominal_hash() != nullptr);
+    BOOST_REQUIRE(tx.witness_hash() == nullptr);
+    BOOST_REQUIRE_EQUAL(*tx.nominal_hash(), witness_tx.hash(false));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_truncated__uncached)
+{
+    const data_chunk truncated(tx1_data.begin(), std::prev(tx1_data.end()));
+    const accessor tx(transaction{ truncated, true });
+    BOOST_REQUIRE(!tx.is_valid());
+    BOOST_REQUIRE(tx.nominal_hash() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__block_parsed__cached_hashes)
+{
+    const block instance{ header{}, { transaction{ tx1_data, true },
+        witness_tx } };
+    const auto data = instance.to_data(true);
+
+    const block parsed{ data, true };
+    BOOST_REQUIRE(parsed.is_valid());
+    BOOST_REQUIRE_EQUAL(parsed.transactions_ptr()->size(), 2u);
+
+    const accessor tx1(*parsed.transactions_ptr()->front());
+    BOOST_REQUIRE(tx1.nominal_hash() != nullptr);
+    BOOST_REQUIRE_EQUAL(*tx1.nominal_hash(), tx1_hash);
+
+    const accessor tx(*parsed.transactions_ptr()->back());
+    BOOST_REQUIRE(tx.nominal_hash() != nullptr);
+    BOOST_REQUIRE(tx.witness_hash() != nullptr);
+    BOOST_REQUIRE_EQUAL(*tx.nominal_hash(), witness_tx.hash(false));
+    BOOST_REQUIRE_EQUAL(*tx.witness_hash(), witness_tx.hash(true));
+
+    block_parser parser(true);
+    BOOST_REQUIRE(parser.push(data));
+    BOOST_REQUIRE(parser.is_complete());
+
+    const accessor streamed(*parser.transactions().back());
+    BOOST_REQUIRE(streamed.nominal_hash() != nullptr);
+    BOOST_REQUIRE(streamed.witness_hash() != nullptr);
+    BOOST_REQUIRE_EQUAL(*streamed.nominal_hash(), witness_tx.hash(false));
+    BOOST_REQUIRE_EQUAL(*streamed.witness_hash(), witness_tx.hash(true));
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -387,6 +620,31 @@ BOOST_AUTO_TEST_CASE(transaction__to_data__writer__expected)
     BOOST_REQUIRE(copy == tx);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__to_data__gather__expected_referenced_payload)
+{
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ null_hash, 0 }, script{}, 0 } },
+        outputs{ { 42, script{ operations{ { data_chunk(100, 0x42), false } } } } },
+        0
+    };
+
+    write::bytes::gather out{};
+    tx.to_data(out, true);
+    BOOST_REQUIRE(out);
+    BOOST_REQUIRE_EQUAL(out.get_position(), tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(out.to_chunk(), tx.to_data(true));
+
+    // The push data is referenced in place, not copied.
+    const auto& payload = tx.outputs_ptr()->front()->script().ops().front().data();
+    const auto& slices = out.slices();
+    BOOST_REQUIRE(std::any_of(slices.begin(), slices.end(), [&](const auto& slice)
+    {
+        return slice.data() == payload.data();
+    }));
+}
+
 // properties
 // ----------------------------------------------------------------------------
 
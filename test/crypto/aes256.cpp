@@ -54,4 +54,29 @@ BOOST_AUTO_TEST_CASE(encryption__aes256__nist__expected)
     BOOST_REQUIRE_EQUAL(block, plaintext);
 }
 
+BOOST_AUTO_TEST_CASE(encryption__aes256__context_blocks__expected)
+{
+    constexpr auto key = base16_array("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    constexpr auto plaintext1 = base16_array("00112233445566778899aabbccddeeff");
+    constexpr auto plaintext2 = base16_array("2a000000000000000000000000000000");
+
+    aes256::block block1{ plaintext1 };
+    aes256::block block2{ plaintext2 };
+    aes256::block expected2{ plaintext2 };
+    aes256::encrypt(expected2, key);
+
+    // One key schedule is shared by each block.
+    aes256::context context{};
+    aes256::initialize(context, key);
+    aes256::encrypt(block1, context);
+    aes256::encrypt(block2, context);
+    BOOST_REQUIRE_EQUAL(block1, base16_array("8ea2b7ca516745bfeafc49904b496089"));
+    BOOST_REQUIRE_EQUAL(block2, expected2);
+
+    aes256::decrypt(block2, context);
+    aes256::decrypt(block1, context);
+    BOOST_REQUIRE_EQUAL(block1, plaintext1);
+    BOOST_REQUIRE_EQUAL(block2, plaintext2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -211,4 +211,132 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__ec_multiply__expected)
     BOOST_REQUIRE_EQUAL(public1, public2);
 }
 
+// prepared point
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_prepared_point__invalid_point__false)
+{
+    const ec_prepared_point prepared{ null_ec_compressed };
+    BOOST_REQUIRE(!prepared);
+
+    ec_compressed out;
+    BOOST_REQUIRE(!ec_multiply_vartime(out, prepared, secret1));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_prepared_point__generator__secret_to_public)
+{
+    const ec_prepared_point prepared{ ec_compressed_generator };
+    BOOST_REQUIRE(prepared);
+    BOOST_REQUIRE_EQUAL(prepared.point(), ec_compressed_generator);
+
+    ec_compressed out;
+    BOOST_REQUIRE(ec_multiply_vartime(out, prepared, secret1));
+    BOOST_REQUIRE_EQUAL(out, compressed1);
+    BOOST_REQUIRE(ec_multiply_vartime(out, prepared, one));
+    BOOST_REQUIRE_EQUAL(out, ec_compressed_generator);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_prepared_point__multiply__expected)
+{
+    // = n - 1
+    const ec_secret minus_one = base16_array("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140");
+    const ec_prepared_point prepared{ compressed2 };
+    BOOST_REQUIRE(prepared);
+
+    for (const auto& scalar: { secret1, secret3, one, minus_one })
+    {
+        auto expected = compressed2;
+        BOOST_REQUIRE(ec_multiply(expected, scalar));
+
+        ec_compressed out;
+        BOOST_REQUIRE(ec_multiply_vartime(out, prepared, scalar));
+        BOOST_REQUIRE_EQUAL(out, expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_prepared_point__invalid_scalar__false)
+{
+    // = n
+    const ec_secret order = base16_array("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141");
+    const ec_prepared_point prepared{ compressed2 };
+    BOOST_REQUIRE(prepared);
+
+    ec_compressed out;
+    BOOST_REQUIRE(!ec_multiply_vartime(out, prepared, null_hash));
+    BOOST_REQUIRE(!ec_multiply_vartime(out, prepared, order));
+}
+
+// batch
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__batch_shared_point__expected)
+{
+    const secret_list scalars{ secret1, secret3, one };
+    compressed_list sums{};
+    BOOST_REQUIRE(ec_add(sums, compressed1, scalars));
+    BOOST_REQUIRE_EQUAL(sums.size(), scalars.size());
+
+    for (size_t index = 0; index < scalars.size(); ++index)
+    {
+        auto expected = compressed1;
+        BOOST_REQUIRE(ec_add(expected, scalars[index]));
+        BOOST_REQUIRE_EQUAL(sums[index], expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__batch_shared_point_overflow__false)
+{
+    // = n - 1
+    const ec_secret minus_one = base16_array("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140");
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, one));
+
+    compressed_list sums{};
+    BOOST_REQUIRE(!ec_add(sums, point, { secret1, minus_one }));
+    BOOST_REQUIRE_EQUAL(sums.size(), 2u);
+    BOOST_REQUIRE_EQUAL(sums.back(), null_ec_compressed);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__batch_pairwise__expected)
+{
+    compressed_list points{ compressed1, compressed2, ec_compressed_generator };
+    const secret_list scalars{ secret3, secret1, one };
+    const auto expected = points;
+    BOOST_REQUIRE(ec_add(points, scalars));
+
+    for (size_t index = 0; index < scalars.size(); ++index)
+    {
+        auto sum = expected[index];
+        BOOST_REQUIRE(ec_add(sum, scalars[index]));
+        BOOST_REQUIRE_EQUAL(points[index], sum);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__batch_pairwise_size_mismatch__false)
+{
+    compressed_list points{ compressed1, compressed2 };
+    BOOST_REQUIRE(!ec_add(points, secret_list{ secret1 }));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_multiply__batch__expected)
+{
+    compressed_list points{ compressed1, compressed2, ec_compressed_generator };
+    const auto expected = points;
+    BOOST_REQUIRE(ec_multiply(points, secret3));
+
+    for (size_t index = 0; index < points.size(); ++index)
+    {
+        auto product = expected[index];
+        BOOST_REQUIRE(ec_multiply(product, secret3));
+        BOOST_REQUIRE_EQUAL(points[index], product);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__batch__expected)
+{
+    compressed_list points{};
+    BOOST_REQUIRE(secret_to_public(points, { secret1, one }));
+    BOOST_REQUIRE_EQUAL(points.size(), 2u);
+    BOOST_REQUIRE_EQUAL(points.front(), compressed1);
+    BOOST_REQUIRE_EQUAL(points.back(), ec_compressed_generator);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -163,4 +163,68 @@ BOOST_AUTO_TEST_CASE(endian__to_little_endians__loop_unroll__expected)
     BOOST_CHECK_EQUAL(to_little_endians(reduce<16>(native)), reduce<16>(normalize(native, reversed)));
 }
 
+// span
+
+BOOST_AUTO_TEST_CASE(endian__byteswaps__uint16__expected)
+{
+    std::vector<uint16_t> values(37);
+    std::vector<uint16_t> out(values.size());
+    for (size_t index = 0; index < values.size(); ++index)
+        values[index] = narrow_cast<uint16_t>(0x0102_size + index);
+
+    byteswaps(out.data(), values.data(), values.size());
+
+    for (size_t index = 0; index < values.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(out[index], byteswap(values[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(endian__byteswaps__uint32_in_place__expected)
+{
+    std::vector<uint32_t> values(37);
+    for (size_t index = 0; index < values.size(); ++index)
+        values[index] = narrow_cast<uint32_t>(0x01020304_size + index);
+
+    const auto expected = values;
+    byteswaps(values.data(), values.data(), values.size());
+
+    for (size_t index = 0; index < values.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(values[index], byteswap(expected[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(endian__byteswaps__uint64__expected)
+{
+    std::vector<uint64_t> values(37);
+    std::vector<uint64_t> out(values.size());
+    for (size_t index = 0; index < values.size(); ++index)
+        values[index] = 0x0102030405060708_u64 + index;
+
+    byteswaps(out.data(), values.data(), values.size());
+
+    for (size_t index = 0; index < values.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(out[index], byteswap(values[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(endian__span_endians__expected)
+{
+    std::vector<uint32_t> big(size);
+    std::vector<uint32_t> little(size);
+    std::vector<uint32_t> out(size);
+
+    to_big_endians(big.data(), native.data(), size);
+    to_little_endians(little.data(), native.data(), size);
+    BOOST_REQUIRE(std::equal(big.begin(), big.end(), to_big_endians(native).begin()));
+    BOOST_REQUIRE(std::equal(little.begin(), little.end(), to_little_endians(native).begin()));
+
+    from_big_endians(out.data(), big.data(), size);
+    BOOST_REQUIRE(std::equal(out.begin(), out.end(), native.begin()));
+    from_little_endians(out.data(), little.data(), size);
+    BOOST_REQUIRE(std::equal(out.begin(), out.end(), native.begin()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
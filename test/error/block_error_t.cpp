@@ -246,4 +246,15 @@ BOOST_AUTO_TEST_CASE(block_error_t__code__unspent_coinbase_collision__true_exect
     BOOST_REQUIRE_EQUAL(ec.message(), "unspent coinbase collision");
 }
 
+// accept header (appended)
+
+BOOST_AUTO_TEST_CASE(block_error_t__code__orphan_header__true_exected_message)
+{
+    constexpr auto value = error::orphan_header;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "header does not link to its predecessor");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -359,4 +359,102 @@ BOOST_AUTO_TEST_CASE(checksum__bech32_verify_checked__invalid_checksum__false)
     BOOST_REQUIRE(!bech32_verify_checked(out_version, out_program, bip173_testnet_prefix, checked));
 }
 
+// bech32_encode
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__bip173__expected)
+{
+    bech32_text text{};
+    const auto size = bech32_encode(text, bip173_mainnet_prefix, bip173_program_version, bip173_p2wkh_program());
+    BOOST_REQUIRE_EQUAL(std::string(text.data(), size), bip173_mainnet_prefix + "1" + bip173_mainnet_p2wkh);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__upper_case_prefix__lower_case_expected)
+{
+    uint8_t out_version{};
+    size_t size{};
+    bech32_text text{};
+    bech32_program program{};
+    const auto encoded = bech32_encode(text, "BC", bip173_program_version, bip173_p2wkh_program());
+    BOOST_REQUIRE_EQUAL(std::string(text.data(), encoded), bip173_mainnet_prefix + "1" + bip173_mainnet_p2wkh);
+    BOOST_REQUIRE(bech32_decode(out_version, program, size, "bc", { text.data(), encoded }));
+    BOOST_REQUIRE(bech32_decode(out_version, program, size, "BC", { text.data(), encoded }));
+    BOOST_REQUIRE_EQUAL(encoded, bech32_encode(text, "bC", bip173_program_version, bip173_p2wkh_program()));
+    BOOST_REQUIRE_EQUAL(std::string(text.data(), encoded), bip173_mainnet_prefix + "1" + bip173_mainnet_p2wkh);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__build_checked__same)
+{
+    bech32_text text{};
+    const data_chunk program{ 1, 2, 3, 4, 5 };
+    for (uint8_t version = 0; version < 32; ++version)
+    {
+        const auto size = bech32_encode(text, bip173_testnet_prefix, version, program);
+        const auto checked = bech32_build_checked(version, program, bip173_testnet_prefix);
+        BOOST_REQUIRE_EQUAL(std::string(text.data(), size), bip173_testnet_prefix + "1" + encode_base32(checked));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__overflow__zero)
+{
+    bech32_text text{};
+    BOOST_REQUIRE_EQUAL(bech32_encode(text, "bc", 32, {}), 0u);
+    BOOST_REQUIRE_EQUAL(bech32_encode(text, "bc", 0, data_array<51>{}), 0u);
+    BOOST_REQUIRE_EQUAL(bech32_encode(text, "bc", 0, data_array<50>{}), 90u);
+}
+
+// bech32_decode
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__bip173__expected)
+{
+    size_t size{};
+    bech32_program program{};
+    const auto text = bip173_testnet_prefix + "1" + bip173_testnet_p2wsh;
+    BOOST_REQUIRE(bech32_decode(out_version, program, size, bip173_testnet_prefix, text));
+    BOOST_REQUIRE_EQUAL(out_version, bip173_program_version);
+    BOOST_REQUIRE_EQUAL(data_chunk(program.begin(), std::next(program.begin(), size)), bip173_p2wsh_program());
+
+    // All upper case is valid (prefix matches in either case).
+    BOOST_REQUIRE(bech32_decode(out_version, program, size, "bc", "BC1QW508D6QEJXTDG4Y5R3ZARVARY0C5XW7KV8F3T4"));
+    BOOST_REQUIRE_EQUAL(data_chunk(program.begin(), std::next(program.begin(), size)), bip173_p2wkh_program());
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__encode__round_trips)
+{
+    size_t size{};
+    bech32_text text{};
+    bech32_program program{};
+    data_chunk expected{};
+    for (size_t length = 0; length <= program.size(); ++length)
+    {
+        const auto version = narrow_cast<uint8_t>(length % 17u);
+        const auto encoded = bech32_encode(text, "abc", version, expected);
+        BOOST_REQUIRE(!is_zero(encoded));
+        BOOST_REQUIRE(bech32_decode(out_version, program, size, "abc", { text.data(), encoded }));
+        BOOST_REQUIRE_EQUAL(out_version, version);
+        BOOST_REQUIRE_EQUAL(data_chunk(program.begin(), std::next(program.begin(), size)), expected);
+        expected.push_back(narrow_cast<uint8_t>(length * 41u));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__invalid__false)
+{
+    size_t size{};
+    bech32_program program{};
+
+    // Mixed case, prefix mismatch, missing separator, invalid character.
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "bc", "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3T4"));
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "tb", "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"));
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "b", "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"));
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "bc", "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3b4"));
+
+    // Invalid checksum, too short, too long (program overflow).
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "bc", "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t5"));
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "bc", "bc1gmk9yu"));
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "bc", "bc10w508d6qejxtdg4y5r3zarvary0c5xw7kw508d6qejxtdg4y5r3zarvary0c5xw7kw5rljs90"));
+
+    // Zero padding of more than four bits, non-zero padding.
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "bc", "bc1zw508d6qejxtdg4y5r3zarvaryvqyzf3du"));
+    BOOST_REQUIRE(!bech32_decode(out_version, program, size, "tb", "tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3pjxtptv"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
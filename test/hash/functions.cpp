@@ -357,4 +357,35 @@ BOOST_AUTO_TEST_CASE(functions__hash_combine__same_values__expected)
     }
 }
 
+// reverse_hashes
+
+BOOST_AUTO_TEST_CASE(functions__reverse_hashes__empty__empty)
+{
+    hashes values{};
+    reverse_hashes(values);
+    BOOST_REQUIRE(values.empty());
+    BOOST_REQUIRE(reverse_hashes_copy(values).empty());
+}
+
+BOOST_AUTO_TEST_CASE(functions__reverse_hashes__multiple__each_reversed)
+{
+    const hashes expected
+    {
+        base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f"),
+        base16_hash("00000000839a8e6886ab5951d76f411475428afc90947ee320161bbf18eb6048"),
+        base16_hash("000000006a625f06636b8bb6ac7b960a8d03705d1ace08b1a19da3fdcc99ddbd")
+    };
+
+    hashes values(expected);
+    reverse_hashes(values);
+    BOOST_REQUIRE_EQUAL(values.size(), expected.size());
+
+    for (size_t index = 0; index < expected.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(values[index], reverse_copy(expected[index]));
+    }
+
+    BOOST_REQUIRE(reverse_hashes_copy(values) == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
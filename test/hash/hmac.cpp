@@ -69,4 +69,62 @@ BOOST_AUTO_TEST_CASE(hmac__sha512__test_vectors__expected)
     }
 }
 
+// midstate
+
+BOOST_AUTO_TEST_CASE(hmac__midstate_sha160__test_vectors__expected)
+{
+    for (const auto& test: hmac_sha160_tests)
+    {
+        const auto hash = hmac<sha160>::code(test.data, hmac<sha160>::midstate(test.key));
+        BOOST_REQUIRE_EQUAL(hash, test.expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hmac__midstate_sha256__test_vectors__expected)
+{
+    for (const auto& test: hmac_sha256_tests)
+    {
+        const auto hash = hmac<sha256>::code(test.data, hmac<sha256>::midstate(test.key));
+        BOOST_REQUIRE_EQUAL(hash, test.expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hmac__midstate_sha512__test_vectors__expected)
+{
+    for (const auto& test: hmac_sha512_tests)
+    {
+        const auto hash = hmac<sha512>::code(test.data, hmac<sha512>::midstate(test.key));
+        BOOST_REQUIRE_EQUAL(hash, test.expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hmac__midstate_rmd160__test_vectors__same_as_key)
+{
+    for (const auto& test: hmac_sha160_tests)
+    {
+        const auto hash = hmac<rmd160>::code(test.data, hmac<rmd160>::midstate(test.key));
+        BOOST_REQUIRE_EQUAL(hash, hmac<rmd160>::code(test.data, test.key));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hmac__midstate_sha512__reused__expected)
+{
+    // The last two test vectors share a key (larger than the block size).
+    const auto& first = hmac_sha512_tests.at(5);
+    const auto& second = hmac_sha512_tests.at(6);
+    BOOST_REQUIRE_EQUAL(first.key, second.key);
+
+    const auto midstate = hmac<sha512>::midstate(first.key);
+    BOOST_REQUIRE_EQUAL(hmac<sha512>::code(first.data, midstate), first.expected);
+    BOOST_REQUIRE_EQUAL(hmac<sha512>::code(second.data, midstate), second.expected);
+}
+
+BOOST_AUTO_TEST_CASE(hmac__midstate_sha256__accumulator__expected)
+{
+    const auto& test = hmac_sha256_tests.front();
+    hmac<sha256> accumulator{ hmac<sha256>::midstate(test.key) };
+    accumulator.write(test.data);
+    BOOST_REQUIRE_EQUAL(accumulator.flush(), test.expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
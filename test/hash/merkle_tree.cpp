@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(merkle_tree_tests)
+
+using tree = merkle_tree<sha256>;
+
+static sha256::digests_t get_leaves(size_t count) NOEXCEPT
+{
+    sha256::digests_t leaves{};
+    for (size_t index = 0; index < count; ++index)
+        leaves.push_back(sha256_hash(to_little_endian(index)));
+
+    return leaves;
+}
+
+static sha256::digest_t get_root(size_t count) NOEXCEPT
+{
+    return sha256::merkle_root(get_leaves(count));
+}
+
+// construct
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__empty__null_root)
+{
+    const tree instance{ sha256::digests_t{} };
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.depth(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.root(), null_hash);
+    BOOST_REQUIRE(instance.branch(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__one__leaf_root)
+{
+    const auto leaves = get_leaves(1);
+    const tree instance{ leaves };
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.depth(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.root(), leaves.front());
+    BOOST_REQUIRE(instance.branch(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__various__expected_root)
+{
+    for (size_t count = 1; count < 34; ++count)
+    {
+        const tree instance{ get_leaves(count) };
+        BOOST_REQUIRE_EQUAL(instance.size(), count);
+        BOOST_REQUIRE_EQUAL(instance.depth(), add1(ceilinged_log2(sub1(count))));
+        BOOST_REQUIRE_EQUAL(instance.root(), get_root(count));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__move__expected_root)
+{
+    tree instance{ get_leaves(7) };
+    BOOST_REQUIRE_EQUAL(instance.root(), get_root(7));
+    BOOST_REQUIRE_EQUAL(instance.leaf(6), get_leaves(7).back());
+}
+
+// branch
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__out_of_range__empty)
+{
+    const tree instance{ get_leaves(5) };
+    BOOST_REQUIRE(instance.branch(5).empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__all_indexes__verifies_to_root)
+{
+    for (size_t count = 1; count < 34; ++count)
+    {
+        const auto leaves = get_leaves(count);
+        const tree instance{ leaves };
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto branch = instance.branch(index);
+            BOOST_REQUIRE_EQUAL(branch.size(), sub1(instance.depth()));
+            BOOST_REQUIRE_EQUAL(tree::root(leaves[index], branch, index), instance.root());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__wrong_index__does_not_verify)
+{
+    const auto leaves = get_leaves(8);
+    const tree instance{ leaves };
+    const auto branch = instance.branch(3);
+    BOOST_REQUIRE_NE(tree::root(leaves[3], branch, 2), instance.root());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__three__expected)
+{
+    // Last leaf of an odd level is its own sibling.
+    const auto leaves = get_leaves(3);
+    const tree instance{ leaves };
+    const auto branch = instance.branch(2);
+    BOOST_REQUIRE_EQUAL(branch.size(), 2u);
+    BOOST_REQUIRE_EQUAL(branch[0], leaves[2]);
+    BOOST_REQUIRE_EQUAL(branch[1], sha256::double_hash(leaves[0], leaves[1]));
+}
+
+// branches
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branches__indexes__expected)
+{
+    const tree instance{ get_leaves(21) };
+    const tree::indexes_t indexes{ 0, 20, 21, 7, 7, 13 };
+    const auto branches = instance.branches(indexes);
+    BOOST_REQUIRE_EQUAL(branches.size(), indexes.size());
+
+    for (size_t item = 0; item < indexes.size(); ++item)
+    {
+        BOOST_REQUIRE_EQUAL(branches[item], instance.branch(indexes[item]));
+    }
+
+    BOOST_REQUIRE(branches[2].empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branches__empty_tree__empty_branches)
+{
+    const tree instance{ sha256::digests_t{} };
+    const auto branches = instance.branches({ 0, 1 });
+    BOOST_REQUIRE_EQUAL(branches.size(), 2u);
+    BOOST_REQUIRE(branches[0].empty());
+    BOOST_REQUIRE(branches[1].empty());
+}
+
+// update
+
+BOOST_AUTO_TEST_CASE(merkle_tree__update__out_of_range__false)
+{
+    tree instance{ get_leaves(4) };
+    BOOST_REQUIRE(!instance.update(4, null_hash));
+    BOOST_REQUIRE_EQUAL(instance.root(), get_root(4));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__update__each_leaf__expected_root)
+{
+    for (size_t count = 1; count < 18; ++count)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            auto leaves = get_leaves(count);
+            tree instance{ leaves };
+            leaves[index] = sha256_hash(leaves[index]);
+            BOOST_REQUIRE(instance.update(index, leaves[index]));
+            BOOST_REQUIRE_EQUAL(instance.root(), sha256::merkle_root(std::move(leaves)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__update__coinbase__branches_remain_valid)
+{
+    auto leaves = get_leaves(11);
+    tree instance{ leaves };
+    leaves.front() = null_hash;
+    BOOST_REQUIRE(instance.update(0, leaves.front()));
+
+    for (size_t index = 0; index < leaves.size(); ++index)
+    {
+        const auto branch = instance.branch(index);
+        BOOST_REQUIRE_EQUAL(tree::root(leaves[index], branch, index), instance.root());
+    }
+}
+
+// append
+
+BOOST_AUTO_TEST_CASE(merkle_tree__append__from_empty__expected_roots)
+{
+    const auto leaves = get_leaves(33);
+    tree instance{ sha256::digests_t{} };
+
+    for (size_t count = 1; count <= leaves.size(); ++count)
+    {
+        instance.append(leaves[sub1(count)]);
+        BOOST_REQUIRE_EQUAL(instance.size(), count);
+        BOOST_REQUIRE_EQUAL(instance.depth(), add1(ceilinged_log2(sub1(count))));
+        BOOST_REQUIRE_EQUAL(instance.root(), get_root(count));
+        BOOST_REQUIRE_EQUAL(instance.leaf(sub1(count)), leaves[sub1(count)]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__append__branches__verify_to_root)
+{
+    const auto leaves = get_leaves(13);
+    tree instance{ get_leaves(5) };
+
+    for (size_t index = 5; index < leaves.size(); ++index)
+        instance.append(leaves[index]);
+
+    for (size_t index = 0; index < leaves.size(); ++index)
+    {
+        const auto branch = instance.branch(index);
+        BOOST_REQUIRE_EQUAL(tree::root(leaves[index], branch, index), instance.root());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__append__across_capacity__equals_constructed)
+{
+    const auto leaves = get_leaves(70);
+    tree instance{ get_leaves(3) };
+
+    for (size_t index = 3; index < leaves.size(); ++index)
+    {
+        instance.append(leaves[index]);
+        const tree expected{ sha256::digests_t(leaves.begin(),
+            std::next(leaves.begin(), add1(index))) };
+
+        BOOST_REQUIRE_EQUAL(instance.depth(), expected.depth());
+        BOOST_REQUIRE_EQUAL(instance.root(), expected.root());
+        BOOST_REQUIRE(instance.branch(index) == expected.branch(index));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../../test.hpp"
+#include "../../radix/base_58.hpp"
 #include "performance.hpp"
 
 #if defined(HAVE_PERFORMANCE_TESTS)
@@ -91,6 +92,37 @@ BOOST_AUTO_TEST_CASE(performance__sha256a_vect__merkle)
     BOOST_CHECK(complete);
 }
 
+BOOST_AUTO_TEST_CASE(performance__hmac_sha512__key)
+{
+    auto complete = true;
+    complete = test_hmac<sha512, false>(std::cout);
+    BOOST_CHECK(complete);
+}
+
+BOOST_AUTO_TEST_CASE(performance__hmac_sha512__midstate)
+{
+    auto complete = true;
+    complete = test_hmac<sha512, true>(std::cout);
+    BOOST_CHECK(complete);
+}
+
+BOOST_AUTO_TEST_CASE(performance__scrypt__scalar)
+{
+    auto complete = true;
+    complete = test_scrypt<false, false, false>(std::cout);
+    complete = test_scrypt<true, false, false>(std::cout);
+    BOOST_CHECK(complete);
+}
+
+BOOST_AUTO_TEST_CASE(performance__scrypt__vectorized)
+{
+    auto complete = true;
+    complete = test_scrypt<false, true, false>(std::cout);
+    complete = test_scrypt<true, true, false>(std::cout);
+    complete = test_scrypt<true, true, true>(std::cout);
+    BOOST_CHECK(complete);
+}
+
 // !using shax (see performahce.hpp)
 
 BOOST_AUTO_TEST_CASE(performance__base_sha256a)
@@ -192,6 +224,662 @@ BOOST_AUTO_TEST_CASE(performance__sha256a_vect)
 ////    BOOST_CHECK(complete);
 ////}
 
+// Library operations, each timed against its prior (or scalar) form.
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(performance__header__hash_nonces)
+{
+    constexpr size_t count = 1024 * 1024;
+    const chain::header header{ 1, {}, {}, 42, 0x1d00ffff, 0 };
+    const auto midstate = header.midstate();
+
+    benchmark<count>("header::hash (single)", zero, [&]() noexcept
+    {
+        for (uint32_t nonce = 0; nonce < count; ++nonce)
+            header.hash(midstate, 42, nonce);
+    });
+
+    hashes out(count);
+    benchmark<count>("header::hash (batch)", zero, [&]() noexcept
+    {
+        header.hash(out, midstate, 42, 0);
+    });
+}
+
+BOOST_AUTO_TEST_CASE(performance__block__from_data)
+{
+    constexpr size_t count = 256;
+
+    // Genesis header with 1024 copies of the genesis coinbase (~200KB).
+    const auto genesis = settings(chain::selection::mainnet).genesis_block;
+    const chain::transactions txs(1024, *genesis.transactions_ptr()->front());
+    const auto data = chain::block{ genesis.header(), txs }.to_data(true);
+    const auto bytes = count * data.size();
+
+    auto valid = true;
+    benchmark<count>("block (stream::in::copy)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+        {
+            stream::in::copy stream(data);
+            valid &= chain::block{ stream, true }.is_valid();
+        }
+    });
+
+    benchmark<count>("block (read::bytes::fast)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+        {
+            read::bytes::fast source(data);
+            valid &= chain::block{ source, true }.is_valid();
+        }
+    });
+
+    BOOST_CHECK(valid);
+}
+
+BOOST_AUTO_TEST_CASE(performance__block_file__scan)
+{
+    constexpr size_t count = 256;
+    constexpr size_t batch = 16;
+    constexpr uint32_t magic = 0xd9b4bef9;
+
+    // Synthetic local block file of count (magic, size, ~200KB block) records.
+    const auto genesis = settings(chain::selection::mainnet).genesis_block;
+    const chain::transactions txs(1024, *genesis.transactions_ptr()->front());
+    const auto data = chain::block{ genesis.header(), txs }.to_data(true);
+    const auto record = build_chunk(
+    {
+        to_little_endian(magic),
+        to_little_endian(possible_narrow_cast<uint32_t>(data.size())),
+        data
+    });
+
+    test::remove(TEST_NAME);
+    {
+        ofstream out(TEST_NAME, std::ofstream::binary);
+        for (size_t round = 0; round < count; ++round)
+            out.write(pointer_cast<const char>(record.data()), record.size());
+
+        BOOST_REQUIRE(out.good());
+    }
+
+    size_t scanned{};
+    const chain::block_file file(TEST_NAME, magic);
+    benchmark<count>("block_file::scan (check)", file.size(), [&]() noexcept
+    {
+        file.scan([&](const chain::block::cptr&, const code&, size_t) noexcept
+        {
+            ++scanned;
+            return true;
+        }, true, batch);
+    });
+
+    test::remove(TEST_NAME);
+    BOOST_CHECK(file.is_valid());
+    BOOST_CHECK_EQUAL(scanned, count);
+}
+
+BOOST_AUTO_TEST_CASE(performance__json_writer__block)
+{
+    constexpr size_t count = 64;
+
+    // Genesis header with 1024 copies of the genesis coinbase.
+    const auto genesis = settings(chain::selection::mainnet).genesis_block;
+    const chain::transactions txs(1024, *genesis.transactions_ptr()->front());
+    const chain::block block{ genesis.header(), txs };
+    const auto text = chain::to_json(block);
+    const auto bytes = count * text.size();
+
+    auto valid = true;
+    benchmark<count>("block (json::value_from)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+            valid &= boost::json::serialize(boost::json::value_from(block))
+                .size() == text.size();
+    });
+
+    benchmark<count>("block (json_writer)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+            valid &= chain::to_json(block).size() == text.size();
+    });
+
+    benchmark<count>("block (json::value_to)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+            valid &= boost::json::value_to<chain::block>(
+                boost::json::parse(text)).is_valid();
+    });
+
+    benchmark<count>("block (json_reader)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+        {
+            read::bytes::copy source(text);
+            valid &= chain::json_reader(source).read_block().is_valid();
+        }
+    });
+
+    BOOST_CHECK(valid);
+}
+
+BOOST_AUTO_TEST_CASE(performance__endian__byteswaps)
+{
+    constexpr size_t count = 64;
+    constexpr size_t words = 1024 * 1024;
+    constexpr auto bytes = count * words * sizeof(uint32_t);
+
+    std::vector<uint32_t> in(words, 0x01020304_u32);
+    std::vector<uint32_t> out(words);
+    benchmark<count>("byteswap (scalar)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+            std::transform(in.begin(), in.end(), out.begin(),
+                [](uint32_t value) noexcept
+                {
+                    return byteswap(value);
+                });
+    });
+
+    benchmark<count>("byteswaps (span)", bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+            byteswaps(out.data(), in.data(), words);
+    });
+
+    // 64k hashes (2 mib).
+    hashes values(65536, one_hash);
+    const auto hash_bytes = count * values.size() * hash_size;
+
+    benchmark<count>("hashes (std::reverse)", hash_bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+            for (auto& value: values)
+                std::reverse(value.begin(), value.end());
+    });
+
+    benchmark<count>("hashes (reverse_hashes)", hash_bytes, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+            reverse_hashes(values);
+    });
+
+    BOOST_CHECK(values.front() == one_hash);
+}
+
+BOOST_AUTO_TEST_CASE(performance__fixed_uint256__chain_work)
+{
+    constexpr size_t count = 4;
+    constexpr size_t headers = 850000;
+    constexpr size_t interval = 2016;
+
+    // Bits decline by 1/16th per retarget interval from the mainnet limit.
+    std::vector<uint32_t> bits(headers);
+    auto target = chain::compact::expand(0x1d00ffff);
+    for (size_t height = 0; height < headers; ++height)
+    {
+        if (is_zero(height % interval))
+            target -= target >> 4;
+
+        bits[height] = chain::compact::compress(target);
+    }
+
+    uint256_t expected{};
+    benchmark<count>("chain work (uint256_t)", zero, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+        {
+            expected = 0;
+            for (const auto value: bits)
+            {
+                const auto expanded = chain::compact::expand(value);
+                expected += ++(~expanded / (expanded + one));
+            }
+        }
+    });
+
+    fixed_uint256 total{};
+    benchmark<count>("chain work (fixed_uint256)", zero, [&]() noexcept
+    {
+        for (size_t round = 0; round < count; ++round)
+        {
+            total = {};
+            for (const auto value: bits)
+                total += chain::header::work(value);
+        }
+    });
+
+    BOOST_CHECK_EQUAL(total.to_uintx(), expected);
+}
+
+// Each derive_public computes both hmac key pad midstates from the chain code,
+// derive_range computes them once for the range. derive_public also computes
+// the parent fingerprint for each child's lineage, which derive_range does not
+// produce (it returns points only).
+BOOST_AUTO_TEST_CASE(performance__hd_public__derive_range)
+{
+    constexpr size_t count = 64 * 1024;
+
+    const auto seed = to_chunk(sha256_hash(to_big_endian(42)));
+    const wallet::hd_public parent = wallet::hd_private(seed,
+        wallet::hd_private::mainnet);
+
+    BOOST_REQUIRE(parent);
+
+    compressed_list expected(count);
+    benchmark<count>("hd_public::derive_public", zero, [&]() noexcept
+    {
+        for (uint32_t index = 0; index < count; ++index)
+            expected[index] = parent.derive_public(index).point();
+    });
+
+    compressed_list points{};
+    benchmark<count>("hd_public::derive_range", zero, [&]() noexcept
+    {
+        parent.derive_range(points, 0, count);
+    });
+
+    BOOST_CHECK(points == expected);
+}
+
+BOOST_AUTO_TEST_CASE(performance__elliptic_curve__ec_add_batch)
+{
+    constexpr size_t count = 64 * 1024;
+
+    secret_list scalars(count);
+    for (size_t index = 0; index < count; ++index)
+        scalars[index] = sha256_hash(to_little_endian(index));
+
+    const auto point = ec_compressed_generator;
+    compressed_list expected(count);
+    benchmark<count>("ec_add (scalar)", zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            expected[index] = point;
+            ec_add(expected[index], scalars[index]);
+        }
+    });
+
+    compressed_list sums{};
+    benchmark<count>("ec_add (batch)", zero, [&]() noexcept
+    {
+        ec_add(sums, point, scalars);
+    });
+
+    BOOST_CHECK(sums == expected);
+}
+
+BOOST_AUTO_TEST_CASE(performance__stealth_scanner__scan)
+{
+    constexpr size_t keys = 256;
+    constexpr size_t receivers = 256;
+    constexpr size_t count = keys * receivers;
+
+    std::vector<wallet::stealth_receiver> watched{};
+    for (size_t index = 0; index < receivers; ++index)
+        watched.emplace_back(sha256_hash(to_little_endian(index)),
+            sha256_hash(to_big_endian(index)), binary{});
+
+    // Unfiltered receivers, so every (key x receiver) pair is evaluated.
+    wallet::stealth_scanner::rows rows(keys);
+    for (size_t index = 0; index < keys; ++index)
+    {
+        auto& row = rows[index];
+        secret_to_public(row.ephemeral_public,
+            sha256_hash(to_little_endian(add1(index))));
+        row.prefix = narrow_cast<uint32_t>(index);
+    }
+
+    const wallet::stealth_scanner scanner{ watched };
+    wallet::stealth_scanner::matches matches{};
+    benchmark<count>("stealth_scanner::scan (keys)", zero, [&]() noexcept
+    {
+        matches = scanner.scan(rows);
+    });
+
+    BOOST_CHECK(matches.empty());
+}
+
+BOOST_AUTO_TEST_CASE(performance__elliptic_curve__ec_multiply_prepared)
+{
+    constexpr size_t count = 16 * 1024;
+
+    secret_list scalars(count);
+    for (size_t index = 0; index < count; ++index)
+        scalars[index] = sha256_hash(to_little_endian(index));
+
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, sha256_hash(to_big_endian(42))));
+
+    compressed_list expected(count);
+    benchmark<count>("ec_multiply (point)", zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            expected[index] = point;
+            ec_multiply(expected[index], scalars[index]);
+        }
+    });
+
+    compressed_list products(count);
+    benchmark<count>("ec_multiply_vartime (prepared)", zero, [&]() noexcept
+    {
+        const ec_prepared_point prepared{ point };
+        for (size_t index = 0; index < count; ++index)
+            ec_multiply_vartime(products[index], prepared, scalars[index]);
+    });
+
+    BOOST_CHECK(products == expected);
+}
+
+BOOST_AUTO_TEST_CASE(performance__mnemonic__to_seeds)
+{
+    constexpr size_t count = 1024;
+
+    string_list sentences(count);
+    for (size_t index = 0; index < count; ++index)
+        sentences[index] = wallet::mnemonic{ to_chunk(
+            sha256_hash(to_little_endian(index))) }.sentence();
+
+    wallet::mnemonic::list instances(count);
+    long_hashes expected(count);
+    benchmark<count>("mnemonic::to_seed (single)", zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            instances[index] = wallet::mnemonic{ sentences[index] };
+            expected[index] = instances[index].to_seed("TREZOR");
+        }
+    });
+
+    long_hashes seeds{};
+    benchmark<count>("mnemonic::to_seeds (batch)", zero, [&]() noexcept
+    {
+        seeds = wallet::mnemonic::to_seeds(
+            wallet::mnemonic::from_sentences(sentences), "TREZOR");
+    });
+
+    BOOST_CHECK(seeds == expected);
+}
+
+BOOST_AUTO_TEST_CASE(performance__dictionaries__contains_hashed)
+{
+    constexpr size_t count = 16 * 1024;
+    using namespace words::mnemonic;
+    using three = words::dictionaries<3, catalog::size()>;
+
+    // Unsorted catalogs (linear search) in last positions, as for ja mnemonics.
+    const three searched
+    {
+        {
+            catalog{ language::en, en },
+            catalog{ language::es, es },
+            catalog{ language::ja, ja }
+        }
+    };
+
+    const three hashed
+    {
+        {
+            catalog{ language::en, en, en_table },
+            catalog{ language::es, es, es_table },
+            catalog{ language::ja, ja, ja_table }
+        }
+    };
+
+    std::vector<string_list> sentences(count);
+    for (size_t index = 0; index < count; ++index)
+        for (size_t word = 0; word < 24; ++word)
+            sentences[index].push_back(ja.word[(index * 24 + word) % 2048]);
+
+    size_t found{};
+    benchmark<count>("dictionaries::contains (search)", zero, [&]() noexcept
+    {
+        for (const auto& sentence: sentences)
+            found += to_int<size_t>(searched.contains(sentence) == language::ja);
+    });
+
+    BOOST_CHECK_EQUAL(found, count);
+
+    found = zero;
+    benchmark<count>("dictionaries::contains (hash)", zero, [&]() noexcept
+    {
+        for (const auto& sentence: sentences)
+            found += to_int<size_t>(hashed.contains(sentence) == language::ja);
+    });
+
+    BOOST_CHECK_EQUAL(found, count);
+}
+
+BOOST_AUTO_TEST_CASE(performance__vanity_search__search)
+{
+    constexpr size_t count = 64 * 1024;
+
+    // Expected one hit in 2^64 keys, so no hits.
+    const std::string pattern{ "1Love1Love1" };
+    const auto seed = sha256_hash(to_big_endian(42));
+
+    size_t hits{};
+    benchmark<count>("payment_address (encoded)", zero, [&]() noexcept
+    {
+        auto secret = seed;
+        for (size_t index = 0; index < count; ++index)
+        {
+            const wallet::ec_private key{ secret };
+            const wallet::payment_address address{ key };
+            hits += to_int<size_t>(starts_with(address.encoded(), pattern));
+            ec_add(secret, sha256_hash(to_big_endian(index)));
+        }
+    });
+
+    const auto search = wallet::vanity_search::from_payment(pattern);
+    const auto handler = [](const wallet::vanity_search::progress& progress)
+    {
+        return progress.keys < count;
+    };
+
+    wallet::vanity_search::hits found{};
+    benchmark<count>("vanity_search (1 lane)", zero, [&]() noexcept
+    {
+        found = search.search(seed, 1, 1, handler);
+    });
+
+    BOOST_CHECK(is_zero(hits));
+    BOOST_CHECK(found.empty());
+}
+
+// The reference (prior) codec and the limb codec, timed side by side.
+BOOST_AUTO_TEST_CASE(performance__base58__round_trip)
+{
+    constexpr size_t count = 64 * 1024;
+    const auto compare = [](const std::string& name, float before, float after)
+    {
+        std::cout << name << " (reference/limbs): " << serialize(before)
+            << "s / " << serialize(after) << "s = " << serialize(before / after)
+            << "x" << std::endl;
+    };
+
+    // Serialized hd keys (82 bytes) with a version byte leading.
+    std::vector<data_array<82>> keys(count);
+    for (size_t index = 0; index < count; ++index)
+        for (size_t byte = 0; byte < 82; ++byte)
+            keys[index][byte] = narrow_cast<uint8_t>(index * 82 + byte);
+
+    std::vector<std::string> expected(count);
+    const auto encode_before = benchmark<count>("base58 encode (reference)",
+        zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            expected[index] = test::reference::encode_base58(keys[index]);
+    });
+
+    std::vector<std::string> encoded(count);
+    const auto encode_slice = benchmark<count>("base58 encode (slice)",
+        zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            encoded[index] = encode_base58(data_slice{ keys[index] });
+    });
+
+    BOOST_CHECK(encoded == expected);
+
+    const auto encode_array = benchmark<count>("base58 encode (array)",
+        zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            encoded[index] = encode_base58(keys[index]);
+    });
+
+    BOOST_CHECK(encoded == expected);
+
+    size_t decoded{};
+    data_chunk chunk{};
+    const auto decode_before = benchmark<count>("base58 decode (reference)",
+        zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            decoded += to_int<size_t>(test::reference::decode_base58(chunk,
+                encoded[index]) && chunk == to_chunk(keys[index]));
+    });
+
+    BOOST_CHECK_EQUAL(decoded, count);
+
+    decoded = zero;
+    const auto decode_chunk = benchmark<count>("base58 decode (chunk)",
+        zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            decoded += to_int<size_t>(decode_base58(chunk, encoded[index]) &&
+                chunk == to_chunk(keys[index]));
+    });
+
+    BOOST_CHECK_EQUAL(decoded, count);
+
+    decoded = zero;
+    data_array<82> array{};
+    const auto decode_array = benchmark<count>("base58 decode (array)",
+        zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            decoded += to_int<size_t>(decode_base58(array, encoded[index]) &&
+                array == keys[index]);
+    });
+
+    BOOST_CHECK_EQUAL(decoded, count);
+
+    compare("base58 encode (slice)", encode_before, encode_slice);
+    compare("base58 encode (array)", encode_before, encode_array);
+    compare("base58 decode (chunk)", decode_before, decode_chunk);
+    compare("base58 decode (array)", decode_before, decode_array);
+}
+
+BOOST_AUTO_TEST_CASE(performance__witness_address__round_trip)
+{
+    constexpr size_t count = 64 * 1024;
+    using namespace wallet;
+
+    // Version 0 witness output scripts, alternating p2wpkh and p2wsh.
+    data_stack scripts(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto size = is_odd(index) ? 32_size : 20_size;
+        auto& script = scripts[index];
+        script.push_back(0x00);
+        script.push_back(narrow_cast<uint8_t>(size));
+        for (size_t byte = 0; byte < size; ++byte)
+            script.push_back(narrow_cast<uint8_t>(index * size + byte));
+    }
+
+    string_list addresses(count);
+    benchmark<count>("witness_address encode (object)", zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            addresses[index] = witness_address(
+                { std::next(scripts[index].begin(), 2), scripts[index].end() },
+                witness_address::mainnet, 0).encoded();
+    });
+
+    benchmark<count>("witness_address encode (batch)", zero, [&]() noexcept
+    {
+        addresses = witness_address::to_addresses(scripts);
+    });
+
+    size_t decoded{};
+    benchmark<count>("witness_address decode (object)", zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            decoded += to_int<size_t>(witness_address(addresses[index])
+                .script().to_data(false) == scripts[index]);
+    });
+
+    BOOST_CHECK_EQUAL(decoded, count);
+
+    data_stack round{};
+    benchmark<count>("witness_address decode (batch)", zero, [&]() noexcept
+    {
+        round = witness_address::to_scripts(addresses);
+    });
+
+    BOOST_CHECK(round == scripts);
+}
+
+#if defined(HAVE_ICU)
+
+BOOST_AUTO_TEST_CASE(performance__encrypted__batch)
+{
+    constexpr size_t count = 8;
+    using Precision = std::chrono::milliseconds;
+    using namespace wallet;
+
+    // Each key is (16 MiB) scrypt bound, serial (per key) or batched.
+    std::vector<ec_secret> secrets(count);
+    for (size_t index = 0; index < count; ++index)
+        secrets[index] = sha256_hash(to_little_endian(index));
+
+    encrypted_privates keys(count);
+    benchmark<count, Precision>("bip38 encrypt (serial)", zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+            encrypt(keys[index], secrets[index], "passphrase", 0x00);
+    });
+
+    encrypted_privates batch{};
+    benchmark<count, Precision>("bip38 encrypt (batch)", zero, [&]() noexcept
+    {
+        encrypt(batch, secrets, "passphrase", 0x00);
+    });
+
+    BOOST_CHECK(batch == keys);
+
+    size_t decrypted{};
+    benchmark<count, Precision>("bip38 decrypt (serial)", zero, [&]() noexcept
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            ec_secret secret{};
+            uint8_t version{};
+            bool compressed{};
+            decrypted += to_int<size_t>(decrypt(secret, version, compressed,
+                keys[index], "passphrase") && secret == secrets[index]);
+        }
+    });
+
+    BOOST_CHECK_EQUAL(decrypted, count);
+
+    ek_decryptions out{};
+    benchmark<count, Precision>("bip38 decrypt (batch)", zero, [&]() noexcept
+    {
+        decrypt(out, keys, "passphrase");
+    });
+
+    BOOST_CHECK(std::all_of(out.begin(), out.end(),
+        [](const ek_decryption& item) noexcept { return item.valid; }));
+}
+
+#endif // HAVE_ICU
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
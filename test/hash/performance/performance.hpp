@@ -121,6 +121,36 @@ void output(std::ostream& out, uint64_t time, float ghz, bool csv) noexcept
     BC_POP_WARNING()
 }
 
+// Output rate of a counted performance run to given stream.
+// Throughput is also output if the run processed a nonzero number of bytes.
+template <size_t Count, typename Precision>
+void output_rate(std::ostream& out, const std::string& algorithm,
+    uint64_t time, bool csv, size_t bytes = zero) noexcept
+{
+    const auto seconds = seconds_total<Precision>(time);
+    const auto delimiter = csv ? "," : "\n";
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out << delimiter
+        << "test____________: " << TEST_NAME
+        << delimiter
+        << "algorithm_______: " << algorithm
+        << delimiter
+        << "test_rounds_____: " << serialize(Count)
+        << delimiter
+        << "seconds_total___: " << serialize(seconds)
+        << delimiter
+        << "rounds_per_sec__: " << serialize(Count / seconds)
+        << delimiter
+        << "ms_per_round____: " << serialize(ms_per_round<Count>(seconds))
+        << delimiter;
+
+    if (!is_zero(bytes))
+        out << "mib_per_second__: " << serialize(bytes / seconds / power2(20u))
+            << delimiter;
+    BC_POP_WARNING()
+}
+
 // generate deterministic data from seed
 // ----------------------------------------------------------------------------
 // Generate a data_chunk or a data_array of specified size.
@@ -178,6 +208,22 @@ public:
     }
 };
 
+// benchmark utility
+// ----------------------------------------------------------------------------
+
+// Time a counted run of body and output its rate (and throughput of bytes, if
+// nonzero) to given stream. Returns the elapsed seconds, for comparisons.
+template <size_t Count, typename Precision = std::chrono::nanoseconds,
+    typename Function>
+float benchmark(const std::string& algorithm, size_t bytes,
+    const Function& body, std::ostream& out = std::cout,
+    bool csv = false) noexcept
+{
+    const auto time = timer<Precision>::execution(body);
+    output_rate<Count, Precision>(out, algorithm, time, csv, bytes);
+    return seconds_total<Precision>(time);
+}
+
 // hash selector
 // ----------------------------------------------------------------------------
 
@@ -349,6 +395,88 @@ bool test_merkle(std::ostream& out, float ghz = 3.0f,
     return true;
 }
 
+// hmac code/midstate test runner.
+// ----------------------------------------------------------------------------
+
+// Defaults to 1Mi rounds over 37 byte data (bip32 derivation input).
+template<typename Algorithm, bool Midstate,
+    size_t Count = 1024 * 1024,
+    size_t Size = 37>
+bool test_hmac(std::ostream& out, bool csv = false) noexcept
+{
+    using Precision = std::chrono::nanoseconds;
+    using Timer = timer<Precision>;
+
+    // Key is reused across all rounds (as a bip32 parent chain code).
+    const auto key = *get_data<32>(42);
+    std::vector<data_array<Size>> data(Count);
+    for (size_t seed = 0; seed < Count; ++seed)
+        data[seed] = *get_data<Size>(seed);
+
+    // The whole loop is timed once (including midstate construction).
+    const auto time = Timer::execution([&]() noexcept
+    {
+        if constexpr (Midstate)
+        {
+            const auto midstate = hmac<Algorithm>::midstate(key);
+            for (const auto& message: data)
+                hmac<Algorithm>::code(message, midstate);
+        }
+        else
+        {
+            for (const auto& message: data)
+                hmac<Algorithm>::code(message, key);
+        }
+    });
+
+    output_rate<Count, Precision>(out, Midstate ? "hmac (midstate)" :
+        "hmac (key)", time, csv);
+    return true;
+}
+
+// scrypt single/batch test runner.
+// ----------------------------------------------------------------------------
+
+// Defaults to 16 bip38 (16384/8/8) hashes of 32 byte passphrases.
+template<bool Concurrent, bool Vectorized, bool Batch,
+    size_t Count = 16,
+    size_t Size = 32>
+bool test_scrypt(std::ostream& out, bool csv = false) noexcept
+{
+    using Precision = std::chrono::nanoseconds;
+    using Timer = timer<Precision>;
+    using algorithm = scrypt<16384, 8, 8, Concurrent, Vectorized>;
+
+    data_stack passwords{};
+    data_stack salts{};
+    for (size_t seed = 0; seed < Count; ++seed)
+    {
+        passwords.push_back(*get_data<Size, true>(seed));
+        salts.push_back(*get_data<4, true>(seed));
+    }
+
+    auto success = true;
+    const auto time = Timer::execution([&]() noexcept
+    {
+        if constexpr (Batch)
+        {
+            std_vector<data_array<64>> hashes{};
+            success = algorithm::hash(hashes, passwords, salts);
+        }
+        else
+        {
+            data_array<64> hash{};
+            for (size_t index = 0; index < Count; ++index)
+                success = algorithm::hash(hash, passwords[index],
+                    salts[index]) && success;
+        }
+    });
+
+    output_rate<Count, Precision>(out, Batch ? "scrypt (batch)" :
+        "scrypt (single)", time, csv);
+    return success;
+}
+
 // Algorithm::hash() test runner parameterization.
 // ----------------------------------------------------------------------------
 
@@ -85,6 +85,100 @@ BOOST_AUTO_TEST_CASE(scrypt__rfc7914__hash_1__expected)
     BOOST_REQUIRE_EQUAL(hash, expected);
 }
 
+// vectorized
+
+BOOST_AUTO_TEST_CASE(scrypt__vectorized__rfc7914__hash_1__expected)
+{
+    using test = scrypt<16, 1, 1, true, true>;
+    constexpr auto expected = base16_array("77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906");
+    constexpr auto size = size_of<decltype(expected)>();
+    const auto hash = test::hash<size>("", "");
+    BOOST_REQUIRE_EQUAL(hash, expected);
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__vectorized__hash__scalar_expected)
+{
+    // 16 rblocks of 2 blocks each, all lanes (and remainders) exercised.
+    using scalar = scrypt<64, 2, 16, false, false>;
+    using vector = scrypt<64, 2, 16, true, true>;
+    const auto expected = scalar::hash<64>("password", "NaCl");
+    BOOST_REQUIRE_EQUAL(vector::hash<64>("password", "NaCl"), expected);
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__vectorized__hash_remainder__scalar_expected)
+{
+    using scalar = scrypt<32, 3, 7, false, false>;
+    using vector = scrypt<32, 3, 7, false, true>;
+    const auto expected = scalar::hash<32>("pleaseletmein", "SodiumChloride");
+    BOOST_REQUIRE_EQUAL(vector::hash<32>("pleaseletmein", "SodiumChloride"), expected);
+}
+
+// batch
+
+BOOST_AUTO_TEST_CASE(scrypt__hash_batch__mismatched_sizes__false)
+{
+    using test = scrypt<16, 1, 1>;
+    std_vector<data_array<32>> out{};
+    BOOST_REQUIRE(!test::hash(out, { {}, {} }, { {} }));
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hash_batch__empty__true_empty)
+{
+    using test = scrypt<16, 1, 1>;
+    std_vector<data_array<32>> out{ {} };
+    BOOST_REQUIRE(test::hash(out, {}, {}));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hash_batch__rfc7914__expected)
+{
+    using test = scrypt<16, 1, 1, true, true>;
+    constexpr auto expected = base16_array("77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906");
+    std_vector<data_array<64>> out{};
+    BOOST_REQUIRE(test::hash(out, { {}, {}, {} }, { {}, {}, {} }));
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    BOOST_REQUIRE_EQUAL(out[0], expected);
+    BOOST_REQUIRE_EQUAL(out[1], expected);
+    BOOST_REQUIRE_EQUAL(out[2], expected);
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hash_batch__scalar_expected)
+{
+    using scalar = scrypt<64, 2, 3, false, false>;
+    using vector = scrypt<64, 2, 3, true, true>;
+    const data_stack passwords{ to_chunk("a"), to_chunk("b"), to_chunk("c"), to_chunk("d"), to_chunk("e"), to_chunk("f") };
+    const data_stack salts{ to_chunk("1"), to_chunk("2"), to_chunk("3"), to_chunk("4"), to_chunk("5"), to_chunk("6") };
+
+    std_vector<data_array<32>> out{};
+    BOOST_REQUIRE(vector::hash(out, passwords, salts));
+    BOOST_REQUIRE_EQUAL(out.size(), passwords.size());
+
+    for (size_t index = 0; index < passwords.size(); ++index)
+    {
+        const auto expected = scalar::hash<32>(passwords[index], salts[index]);
+        BOOST_REQUIRE_EQUAL(out[index], expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hash_batch__minimum_memory__scalar_expected)
+{
+    // Memory for one scalar romix only, precludes vectors and threads.
+    using scalar = scrypt<64, 2, 3, false, false>;
+    using vector = scrypt<64, 2, 3, true, true>;
+    const data_stack passwords{ to_chunk("a"), to_chunk("b"), to_chunk("c") };
+    const data_stack salts{ to_chunk("1"), to_chunk("2"), to_chunk("3") };
+
+    std_vector<data_array<32>> out{};
+    BOOST_REQUIRE(vector::hash(out, passwords, salts, vector::romix_memory));
+    BOOST_REQUIRE_EQUAL(out.size(), passwords.size());
+
+    for (size_t index = 0; index < passwords.size(); ++index)
+    {
+        const auto expected = scalar::hash<32>(passwords[index], salts[index]);
+        BOOST_REQUIRE_EQUAL(out[index], expected);
+    }
+}
+
 // 6+ seconds of test here.
 #if defined(HAVE_SLOW_TESTS)
 
@@ -97,6 +191,15 @@ BOOST_AUTO_TEST_CASE(scrypt__rfc7914__hash_2__expected)
     BOOST_REQUIRE_EQUAL(hash, expected);
 }
 
+BOOST_AUTO_TEST_CASE(scrypt__vectorized__rfc7914__hash_2__expected)
+{
+    using test = scrypt<1024, 8, 16, true, true>;
+    constexpr auto expected = base16_array("fdbabe1c9d3472007856e7190d01e9fe7c6ad7cbc8237830e77376634b3731622eaf30d92e22a3886ff109279d9830dac727afb94a83ee6d8360cbdfa2cc0640");
+    constexpr auto size = size_of<decltype(expected)>();
+    const auto hash = test::hash<size>("password", "NaCl");
+    BOOST_REQUIRE_EQUAL(hash, expected);
+}
+
 BOOST_AUTO_TEST_CASE(scrypt__rfc7914__hash_3__expected)
 {
     using test = scrypt<16384, 8, 1, true>;
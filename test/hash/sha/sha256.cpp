@@ -182,6 +182,58 @@ BOOST_AUTO_TEST_CASE(sha256__double_hash__half_blocks__expected)
     BOOST_CHECK_EQUAL(sha256::double_hash({ 0 }, { 1 }), expected);
 }
 
+// sha256::midstate
+BOOST_AUTO_TEST_CASE(sha256__midstate__one_block__expected_accumulation)
+{
+    constexpr auto expected = sha256::midstate(sha256::block_t{ 42 });
+    auto state = sha256::H::get;
+    sha256::accumulate(state, sha256::block_t{ 42 });
+    BOOST_CHECK_EQUAL(sha256::midstate(sha256::block_t{ 42 }), expected);
+    BOOST_CHECK_EQUAL(state, expected);
+}
+
+BOOST_AUTO_TEST_CASE(sha256__midstate_hash__quarter__expected)
+{
+    constexpr sha256::block_t block{ 42 };
+    constexpr sha256::quarter_t quarter{ 24 };
+    constexpr auto midstate = sha256::midstate(block);
+    constexpr auto digest = sha256::midstate_hash(midstate, quarter);
+    const auto expected = accumulator<sha256>::double_hash(splice(block, quarter));
+    BOOST_CHECK_EQUAL(digest, expected);
+    BOOST_CHECK_EQUAL(sha256::midstate_hash(midstate, quarter), expected);
+}
+
+BOOST_AUTO_TEST_CASE(sha256__midstate_hash__quarters__expected)
+{
+    constexpr sha256::block_t block{ 42 };
+    constexpr auto midstate = sha256::midstate(block);
+    constexpr sha256::quarter_t quarter
+    {
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x0a, 0x0b, 0x0c, 0xfb, 0xff, 0xff, 0xff
+    };
+
+    // Consecutive little-endian counters in last word, wrapping at 2^32.
+    sha256::digests_t digests(37);
+    sha256::midstate_hash(digests, midstate, quarter);
+
+    auto variation = quarter;
+    auto counter = 0xfffffffb_u32;
+    for (const auto& digest: digests)
+    {
+        const auto word = to_little_endian(counter++);
+        std::copy(word.begin(), word.end(), std::next(variation.begin(), 12));
+        BOOST_CHECK_EQUAL(digest, sha256::midstate_hash(midstate, variation));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256__midstate_hash__empty__empty)
+{
+    sha256::digests_t digests{};
+    sha256::midstate_hash(digests, {}, {});
+    BOOST_CHECK(digests.empty());
+}
+
 // sha256::merkle_hash
 BOOST_AUTO_TEST_CASE(sha256__merkle_hash__two__expected)
 {
@@ -74,4 +74,53 @@ BOOST_AUTO_TEST_CASE(siphash__key__vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(siphash__batch__empty__empty)
+{
+    const siphash_key key{ 42, 24 };
+    BOOST_REQUIRE(siphash(key, data_stack{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__vectors__expected)
+{
+    half_hash hash{};
+    BOOST_REQUIRE(decode_base16(hash, hash_test_key));
+
+    // Each message length is repeated to fill all lanes, in mixed order.
+    data_stack messages{};
+    std::vector<uint64_t> expected{};
+    for (size_t repeat = 0; repeat < 9; ++repeat)
+    {
+        for (const auto& result: siphash_hash_tests)
+        {
+            data_chunk data;
+            BOOST_REQUIRE(decode_base16(data, result.message));
+
+            data_chunk encoded_expected;
+            BOOST_REQUIRE(decode_base16(encoded_expected, result.result));
+
+            messages.push_back(data);
+            expected.push_back(from_little_endian<uint64_t>(encoded_expected));
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(siphash(hash, messages), expected);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__distinct_messages__matches_single)
+{
+    const siphash_key key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+
+    data_stack messages{};
+    for (size_t index = 0; index < 37; ++index)
+        messages.push_back(data_chunk(index % 23, narrow_cast<uint8_t>(index)));
+
+    const auto hashes = siphash(key, messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[index], siphash(key, messages[index]));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(fixed_uint256_tests)
+
+using limbs = fixed_uint256::limbs_type;
+constexpr auto max = ~fixed_uint256{};
+constexpr auto one256 = fixed_uint256{ 1_u64 };
+constexpr auto high_bit = fixed_uint256{ limbs{ 0, 0, 0, 0x8000000000000000_u64 } };
+
+// constexpr
+static_assert(fixed_uint256{}.bit_width() == 0);
+static_assert(one256.bit_width() == 1);
+static_assert(max.bit_width() == 256);
+static_assert(max.byte_width() == 32);
+static_assert(high_bit.bit_width() == 256);
+static_assert(max + one256 == fixed_uint256{});
+static_assert(fixed_uint256{} - one256 == max);
+static_assert((one256 << 255) == high_bit);
+static_assert((high_bit >> 255) == one256);
+static_assert((one256 << 256) == fixed_uint256{});
+static_assert((max >> 64) == fixed_uint256{ limbs{ max_uint64, max_uint64, max_uint64, 0 } });
+static_assert((max << 1) == max - one256);
+static_assert(fixed_uint256{ max_uint64 } * max_uint64 == fixed_uint256{ limbs{ 1, max_uint64 - 1, 0, 0 } });
+static_assert(max * max == one256);
+static_assert(max / max == one256);
+static_assert(max / high_bit == one256);
+static_assert(high_bit / fixed_uint256{ 2_u64 } == (one256 << 254));
+static_assert(fixed_uint256{ 42_u64 } / fixed_uint256{ 43_u64 } == fixed_uint256{});
+static_assert(one256 < high_bit);
+static_assert(max > high_bit);
+static_assert(++fixed_uint256{ max_uint64 } == fixed_uint256{ limbs{ 0, 1, 0, 0 } });
+static_assert(--fixed_uint256{ limbs{ 0, 1, 0, 0 } } == fixed_uint256{ max_uint64 });
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__to_uintx__round_trip__expected)
+{
+    const auto value = ~uint256_t{ 0 } / 3;
+    const fixed_uint256 fixed{ value };
+    BOOST_REQUIRE_EQUAL(fixed.to_uintx(), value);
+    BOOST_REQUIRE_EQUAL(fixed.limbs()[0], 0x5555555555555555_u64);
+    BOOST_REQUIRE_EQUAL(fixed.limbs()[3], 0x5555555555555555_u64);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__arithmetic__uintx__expected)
+{
+    const auto left = ~uint256_t{ 0 } / 7;
+    const auto right = (uint256_t{ 0x0123456789abcdef_u64 } << 100) + 42;
+    const fixed_uint256 fixed_left{ left };
+    const fixed_uint256 fixed_right{ right };
+
+    BOOST_REQUIRE_EQUAL((fixed_left + fixed_right).to_uintx(), uint256_t(left + right));
+    BOOST_REQUIRE_EQUAL((fixed_right - fixed_left).to_uintx(), uint256_t(right - left));
+    BOOST_REQUIRE_EQUAL((fixed_left * fixed_right).to_uintx(), uint256_t(left * right));
+    BOOST_REQUIRE_EQUAL((fixed_left * 2016_u64).to_uintx(), uint256_t(left * 2016));
+    BOOST_REQUIRE_EQUAL((fixed_left / fixed_right).to_uintx(), uint256_t(left / right));
+    BOOST_REQUIRE_EQUAL((fixed_left << 77).to_uintx(), uint256_t(left << 77));
+    BOOST_REQUIRE_EQUAL((fixed_left >> 77).to_uintx(), uint256_t(left >> 77));
+    BOOST_REQUIRE_EQUAL((~fixed_right).to_uintx(), uint256_t(~right));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__divide__small_divisor__expected_remainder)
+{
+    const auto value = ~uint256_t{ 0 } / 5;
+    fixed_uint256 fixed{ value };
+    BOOST_REQUIRE_EQUAL(fixed.divide(1209600_u32), static_cast<uint32_t>(value % 1209600));
+    BOOST_REQUIRE_EQUAL(fixed.to_uintx(), uint256_t(value / 1209600));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__divide__single_digit_divisor__uintx)
+{
+    // Divisors of at most 32 bits take the divide(uint32_t) path.
+    const auto value = ~uint256_t{ 0 } / 3;
+    const fixed_uint256 fixed{ value };
+    for (const auto divisor: { 1_u64, 2_u64, 10_u64, 1209600_u64,
+        0x80000000_u64, 0xfffffffb_u64, 0xffffffff_u64 })
+    {
+        BOOST_REQUIRE_EQUAL((fixed / fixed_uint256{ divisor }).to_uintx(), uint256_t(value / divisor));
+    }
+
+    // Least 33 bit divisor takes the long division path.
+    BOOST_REQUIRE_EQUAL((fixed / fixed_uint256{ 0x100000000_u64 }).to_uintx(), uint256_t(value / 0x100000000_u64));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_uint256__divide__add_back__uintx)
+{
+    // Knuth D over b (2^32 or 2^64) digits estimates a quotient digit of two
+    // (b^3 / (b^3 / 2)) that is one too large for dividend b^3 and divisor
+    // b^3 / 2 + b - 1, so the product is added back. Cases for each b.
+    const uint256_t one{ 1 };
+    const uint256_t dividends[]
+    {
+        one << 96,
+        (one << 96) + 0x12345678,
+        one << 192,
+        (one << 192) + 0x0123456789abcdef_u64
+    };
+
+    const uint256_t divisors[]
+    {
+        (one << 95) + (one << 32) - 1,
+        (one << 95) + (one << 32) - 1,
+        (one << 191) + (one << 64) - 1,
+        (one << 191) + (one << 64) - 1
+    };
+
+    for (size_t index = 0; index < std::size(dividends); ++index)
+    {
+        const auto& left = dividends[index];
+        const auto& right = divisors[index];
+        BOOST_REQUIRE_EQUAL((fixed_uint256{ left } / fixed_uint256{ right }).to_uintx(), uint256_t(left / right));
+        BOOST_REQUIRE_EQUAL((fixed_uint256{ left * 5 } / fixed_uint256{ right }).to_uintx(), uint256_t(left * 5 / right));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "base_58.hpp"
+#include <random>
 
 BOOST_AUTO_TEST_SUITE(base_58_tests)
 
@@ -108,4 +110,170 @@ BOOST_AUTO_TEST_CASE(base58__decode_base58__array__expected)
     BOOST_REQUIRE_EQUAL(converted, expected);
 }
 
+BOOST_AUTO_TEST_CASE(base58__encode_base58__array__expected)
+{
+    const data_array<25> checked
+    {
+        {
+            0x00, 0x5c, 0xc8, 0x7f, 0x4a, 0x3f, 0xdf, 0xe3,
+            0xa2, 0x34, 0x6b, 0x69, 0x53, 0x26, 0x7c, 0xa8,
+            0x67, 0x28, 0x26, 0x30, 0xd3, 0xf9, 0xb7, 0x8e,
+            0x64
+        }
+    };
+    BOOST_REQUIRE_EQUAL(encode_base58(checked), "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT");
+    BOOST_REQUIRE_EQUAL(encode_base58(data_array<10>{}), "1111111111");
+    BOOST_REQUIRE_EQUAL(encode_base58(data_array<0>{}), "");
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__array_mismatch__false)
+{
+    const auto address = "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT";
+    data_array<24> smaller;
+    data_array<25> converted;
+    data_array<26> larger;
+    BOOST_REQUIRE(!decode_base58(smaller, address));
+    BOOST_REQUIRE(!decode_base58(larger, address));
+    BOOST_REQUIRE(!decode_base58(converted, std::string{ "1" } + address));
+    BOOST_REQUIRE(!decode_base58(converted, std::string{ address } + "1"));
+    BOOST_REQUIRE(!decode_base58(converted, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFVi0"));
+    BOOST_REQUIRE(!decode_base58(converted, std::string(26, '1')));
+    BOOST_REQUIRE(decode_base58(converted, std::string(25, '1')));
+    BOOST_REQUIRE_EQUAL(converted, data_array<25>{});
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__invalid__false)
+{
+    data_chunk decoded;
+    BOOST_REQUIRE(!decode_base58(decoded, "0"));
+    BOOST_REQUIRE(!decode_base58(decoded, "1111O"));
+    BOOST_REQUIRE(!decode_base58(decoded, "2cFupjhnEsSn59qHXstmK2ffpLv2 "));
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__array_and_slice__same)
+{
+    // Leading zero bytes are preserved, other bytes are a simple sequence.
+    const auto fill = [](auto& value)
+    {
+        for (size_t index = 2; index < value.size(); ++index)
+            value[index] = narrow_cast<uint8_t>(index * 37u);
+
+        return value;
+    };
+
+    const auto round_trip = [](const auto& value)
+    {
+        const auto encoded = encode_base58(value);
+        std::remove_const_t<std::remove_reference_t<decltype(value)>> decoded;
+        data_chunk chunk;
+        return encoded == encode_base58(data_slice{ value }) &&
+            decode_base58(decoded, encoded) && decoded == value &&
+            decode_base58(chunk, encoded) && chunk == to_chunk(value);
+    };
+
+    // Sizes of checked addresses, wif keys, bip38 keys and hd keys.
+    data_array<25> payment{};
+    data_array<38> wif{};
+    data_array<43> encrypted{};
+    data_array<82> hd{};
+    BOOST_REQUIRE(round_trip(fill(payment)));
+    BOOST_REQUIRE(round_trip(fill(wif)));
+    BOOST_REQUIRE(round_trip(fill(encrypted)));
+    BOOST_REQUIRE(round_trip(fill(hd)));
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__limb_boundaries__round_trip)
+{
+    // Values at 32 bit limb boundaries and five digit limb boundaries.
+    encode_decode_test("ffffffff", "7YXq9G");
+    encode_decode_test("0100000000", "7YXq9H");
+    encode_decode_test("ffffffffffffffff", "jpXCZedGfVQ");
+    encode_decode_test("010000000000000000", "jpXCZedGfVR");
+    encode_decode_test("271f35a0", "211111");
+    encode_decode_test("271f359f", "zzzzz");
+    encode_decode_test("00000001", "1112");
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__random__reference)
+{
+    std::mt19937 random{ 42 };
+    const auto draw = [&](size_t maximum)
+    {
+        return std::uniform_int_distribution<size_t>{ 0, maximum }(random);
+    };
+
+    for (size_t round = 0; round < 2000; ++round)
+    {
+        // Random length with a random run of leading zero bytes.
+        data_chunk data(draw(100));
+        const auto zeros = draw(std::min(data.size(), 10_size));
+        for (auto byte = std::next(data.begin(), zeros); byte != data.end(); ++byte)
+            *byte = narrow_cast<uint8_t>(draw(255));
+
+        const auto expected = test::reference::encode_base58(data);
+        BOOST_REQUIRE_EQUAL(encode_base58(data), expected);
+
+        data_chunk decoded{};
+        BOOST_REQUIRE(decode_base58(decoded, expected));
+        BOOST_REQUIRE_EQUAL(decoded, data);
+    }
+
+    // Fixed size (array) paths, with leading zero runs across the array.
+    const auto arrays = [&](auto array)
+    {
+        for (size_t zeros = 0; zeros <= array.size(); ++zeros)
+        {
+            for (size_t index = 0; index < array.size(); ++index)
+                array[index] = index < zeros ? 0x00_u8 : narrow_cast<uint8_t>(draw(255));
+
+            const auto expected = test::reference::encode_base58(array);
+            BOOST_REQUIRE_EQUAL(encode_base58(array), expected);
+
+            decltype(array) decoded{};
+            BOOST_REQUIRE(decode_base58(decoded, expected));
+            BOOST_REQUIRE(decoded == array);
+        }
+    };
+
+    arrays(data_array<1>{});
+    arrays(data_array<4>{});
+    arrays(data_array<25>{});
+    arrays(data_array<38>{});
+    arrays(data_array<43>{});
+    arrays(data_array<82>{});
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__random__reference)
+{
+    // Digits with invalid characters, so failures are also compared.
+    const std::string alphabet{ test::reference::characters + "0OIl " };
+    std::mt19937 random{ 42 };
+    const auto draw = [&](size_t maximum)
+    {
+        return std::uniform_int_distribution<size_t>{ 0, maximum }(random);
+    };
+
+    for (size_t round = 0; round < 2000; ++round)
+    {
+        // Random length with a random run of leading '1' digits.
+        std::string text(draw(140), test::reference::characters.front());
+        const auto ones = draw(std::min(text.size(), 10_size));
+        const auto invalid = is_zero(round % 4);
+        for (auto digit = std::next(text.begin(), ones); digit != text.end(); ++digit)
+            *digit = invalid ? alphabet.at(draw(sub1(alphabet.size()))) :
+                test::reference::characters.at(draw(57));
+
+        data_chunk expected{};
+        data_chunk decoded{};
+        const auto valid = test::reference::decode_base58(expected, text);
+        BOOST_REQUIRE_EQUAL(decode_base58(decoded, text), valid);
+        BOOST_REQUIRE_EQUAL(decoded, expected);
+
+        if (valid)
+        {
+            BOOST_REQUIRE_EQUAL(encode_base58(decoded), text);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_TEST_BASE_58_HPP
+#define LIBBITCOIN_SYSTEM_TEST_BASE_58_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <bitcoin/system.hpp>
+
+// Avoid using namespace in shared headers, but okay here.
+using namespace bc::system;
+
+namespace test {
+namespace reference {
+
+// The prior per byte (quadratic in bytes, not limbs) codec, as a reference.
+
+inline const std::string characters
+{
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz"
+};
+
+inline std::string encode_base58(const data_slice& unencoded)
+{
+    size_t leading_zeros = 0;
+    while (leading_zeros < unencoded.size() && is_zero(unencoded[leading_zeros]))
+        ++leading_zeros;
+
+    // Big-endian base58 digits, "b58 = b58 * 256 + byte".
+    data_chunk digits(add1((unencoded.size() - leading_zeros) * 138 / 100));
+    for (auto byte = std::next(unencoded.begin(), leading_zeros); byte != unencoded.end(); ++byte)
+    {
+        size_t carry = *byte;
+        for (auto it = digits.rbegin(); it != digits.rend(); ++it)
+        {
+            carry += 256 * (*it);
+            *it = narrow_cast<uint8_t>(carry % 58);
+            carry /= 58;
+        }
+    }
+
+    auto it = std::find_if(digits.begin(), digits.end(), [](uint8_t digit) { return !is_zero(digit); });
+    std::string encoded(leading_zeros, characters.front());
+    for (; it != digits.end(); ++it)
+        encoded += characters.at(*it);
+
+    return encoded;
+}
+
+inline bool decode_base58(data_chunk& out, const std::string& in)
+{
+    out.clear();
+    size_t leading_zeros = 0;
+    while (leading_zeros < in.size() && in[leading_zeros] == characters.front())
+        ++leading_zeros;
+
+    // Big-endian bytes, "b256 = b256 * 58 + digit".
+    data_chunk data(add1(in.size() * 733 / 1000));
+    for (auto character = std::next(in.begin(), leading_zeros); character != in.end(); ++character)
+    {
+        auto carry = characters.find(*character);
+        if (carry == std::string::npos)
+            return false;
+
+        for (auto it = data.rbegin(); it != data.rend(); ++it)
+        {
+            carry += 58 * (*it);
+            *it = narrow_cast<uint8_t>(carry % 256);
+            carry /= 256;
+        }
+    }
+
+    const auto first = std::find_if(data.begin(), data.end(), [](uint8_t byte) { return !is_zero(byte); });
+    out.assign(leading_zeros, 0x00);
+    out.insert(out.end(), first, data.end());
+    return true;
+}
+
+} // namespace reference
+} // namespace test
+
+#endif
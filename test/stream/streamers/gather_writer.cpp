@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(gather_writer_tests)
+
+BOOST_AUTO_TEST_CASE(gather_writer__construct__empty)
+{
+    write::bytes::gather writer{};
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE(!!writer);
+    BOOST_REQUIRE_EQUAL(writer.get_position(), zero);
+    BOOST_REQUIRE(writer.slices().empty());
+    BOOST_REQUIRE(writer.to_chunk().empty());
+}
+
+BOOST_AUTO_TEST_CASE(gather_writer__write__integers__coalesced_copy)
+{
+    write::bytes::gather writer{};
+    writer.write_4_bytes_little_endian(0x04030201);
+    writer.write_byte(0x05);
+    writer.write_2_bytes_big_endian(0x0607);
+    writer.write_variable(0x08);
+    BOOST_REQUIRE(writer);
+    BOOST_REQUIRE_EQUAL(writer.get_position(), 8u);
+    BOOST_REQUIRE_EQUAL(writer.slices().size(), 1u);
+
+    const data_chunk expected{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    BOOST_REQUIRE_EQUAL(writer.to_chunk(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(gather_writer__write_bytes__below_reference__copied)
+{
+    data_chunk data(3, 0x42);
+    write::bytes::gather writer(4);
+    writer.write_bytes(data);
+    BOOST_REQUIRE_EQUAL(writer.slices().size(), 1u);
+    BOOST_REQUIRE(writer.slices().front().data() != data.data());
+
+    // Copied bytes are not affected by subsequent changes to the source.
+    data.front() = 0x00;
+    BOOST_REQUIRE_EQUAL(writer.to_chunk(), data_chunk(3, 0x42));
+}
+
+BOOST_AUTO_TEST_CASE(gather_writer__write_bytes__at_reference__referenced)
+{
+    const data_chunk data(4, 0x42);
+    write::bytes::gather writer(4);
+    writer.write_byte(0x01);
+    writer.write_bytes(data);
+    writer.write_byte(0x02);
+    BOOST_REQUIRE_EQUAL(writer.get_position(), 6u);
+    BOOST_REQUIRE_EQUAL(writer.slices().size(), 3u);
+    BOOST_REQUIRE(writer.slices()[1].data() == data.data());
+    BOOST_REQUIRE_EQUAL(writer.slices()[1].size(), data.size());
+
+    const data_chunk expected{ 0x01, 0x42, 0x42, 0x42, 0x42, 0x02 };
+    BOOST_REQUIRE_EQUAL(writer.to_chunk(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(gather_writer__write_string__long__copied)
+{
+    const std::string text(100, 'a');
+    write::bytes::gather writer(4);
+    writer.write_string(text);
+    BOOST_REQUIRE_EQUAL(writer.slices().size(), 1u);
+    BOOST_REQUIRE_EQUAL(writer.get_position(), add1(text.size()));
+}
+
+BOOST_AUTO_TEST_CASE(gather_writer__write_string_buffer__padded)
+{
+    write::bytes::gather writer{};
+    writer.write_string_buffer("ab", 4);
+
+    const data_chunk expected{ 'a', 'b', 0x00, 0x00 };
+    BOOST_REQUIRE_EQUAL(writer.to_chunk(), expected);
+    BOOST_REQUIRE_EQUAL(writer.slices().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(gather_writer__write__many_small__expected)
+{
+    // Spans multiple owned segments, slices remain valid.
+    write::bytes::gather writer{};
+    data_chunk expected{};
+    for (size_t index = 0; index < 10000; ++index)
+    {
+        const auto value = narrow_cast<uint8_t>(index);
+        writer.write_byte(value);
+        expected.push_back(value);
+    }
+
+    BOOST_REQUIRE_EQUAL(writer.get_position(), expected.size());
+    BOOST_REQUIRE_EQUAL(writer.to_chunk(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(gather_writer__move__slices_preserved)
+{
+    const data_chunk data(64, 0x42);
+    write::bytes::gather writer{};
+    writer.write_byte(0x01);
+    writer.write_bytes(data);
+    const auto expected = writer.to_chunk();
+
+    const write::bytes::gather moved(std::move(writer));
+    BOOST_REQUIRE_EQUAL(moved.slices().size(), 2u);
+    BOOST_REQUIRE_EQUAL(moved.to_chunk(), expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include <sstream>
+
+BOOST_AUTO_TEST_SUITE(sha256x2_reader_tests)
+
+static const data_chunk data{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__hashes__empty__empty_hash)
+{
+    std::istringstream stream{};
+    hash::sha256x2::istream reader(stream);
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(data_chunk{}));
+    BOOST_REQUIRE_EQUAL(reader.witness_hash(), bitcoin_hash(data_chunk{}));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__hashes__read_all__expected)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(data.size()), data);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(data));
+    BOOST_REQUIRE_EQUAL(reader.witness_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__hashes__integers__expected)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_little_endian(), 0x04030201u);
+    BOOST_REQUIRE_EQUAL(reader.read_2_bytes_big_endian(), 0x0506u);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x07u);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__hashes__witness_section__excluded_from_nominal)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    reader.skip_bytes(2);
+    reader.set_witness(true);
+    reader.skip_bytes(3);
+    reader.set_witness(false);
+    reader.skip_bytes(2);
+    BOOST_REQUIRE(reader);
+
+    const data_chunk nominal{ 0x01, 0x02, 0x06, 0x07 };
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(nominal));
+    BOOST_REQUIRE_EQUAL(reader.witness_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__hashes__peek__not_hashed)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 0x01u);
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(data_chunk{}));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__hashes__partial__continues)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    reader.skip_bytes(3);
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(),
+        bitcoin_hash(data_chunk{ 0x01, 0x02, 0x03 }));
+
+    reader.skip_bytes(4);
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__reset_hashes__restarts)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    reader.set_witness(true);
+    reader.skip_bytes(3);
+    reader.reset_hashes();
+    reader.skip_bytes(4);
+
+    const data_chunk expected{ 0x04, 0x05, 0x06, 0x07 };
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(expected));
+    BOOST_REQUIRE_EQUAL(reader.witness_hash(), bitcoin_hash(expected));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__read__past_end__invalid_not_hashed)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    reader.skip_bytes(add1(data.size()));
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__rewind__reread__hashed_once)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    reader.skip_bytes(3);
+    reader.rewind_bytes(2);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x02u);
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(),
+        bitcoin_hash(data_chunk{ 0x01, 0x02, 0x03 }));
+
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(5), (data_chunk{ 0x03, 0x04, 0x05, 0x06, 0x07 }));
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(data));
+    BOOST_REQUIRE_EQUAL(reader.witness_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__set_position__rescan__hashed_once)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    reader.skip_byte();
+    const auto start = reader.get_position();
+    reader.skip_bytes(4);
+    reader.set_position(start);
+    reader.skip_bytes(6);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE_EQUAL(reader.nominal_hash(), bitcoin_hash(data));
+}
+
+BOOST_AUTO_TEST_CASE(sha256x2_reader__rewind__before_reset__invalid)
+{
+    stream::in::copy stream(data);
+    hash::sha256x2::istream reader(stream);
+    reader.skip_bytes(3);
+    reader.reset_hashes();
+    reader.skip_byte();
+    reader.rewind_bytes(2);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
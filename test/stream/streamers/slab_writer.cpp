@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include <sstream>
+
+BOOST_AUTO_TEST_SUITE(stream_tests)
+
+#define SLAB_WRITER_CONTEXT
+#define SLAB_WRITER_INTEGERS
+#define SLAB_WRITER_BYTES
+#define SLAB_WRITER_STRINGS
+
+#ifdef SLAB_WRITER_CONTEXT
+
+BOOST_AUTO_TEST_CASE(slab_writer__bool__empty__true)
+{
+    data_chunk sink{};
+    write::bytes::fast writer(sink);
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__get_position__writes__expected)
+{
+    data_chunk sink(2);
+    write::bytes::fast writer(sink);
+    BOOST_REQUIRE_EQUAL(writer.get_position(), 0u);
+    writer.write_byte('*');
+    BOOST_REQUIRE_EQUAL(writer.get_position(), 1u);
+    writer.write_byte('*');
+    BOOST_REQUIRE_EQUAL(writer.get_position(), 2u);
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__flush__not_empty__expected)
+{
+    data_chunk sink(1);
+    write::bytes::fast writer(sink);
+    writer.write_byte('*');
+    writer.flush();
+    BOOST_REQUIRE_EQUAL(sink[0], '*');
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_byte__past_end__invalid)
+{
+    data_chunk sink(1);
+    write::bytes::fast writer(sink);
+    writer.write_byte('a');
+    BOOST_REQUIRE(writer);
+    writer.write_byte('b');
+    BOOST_REQUIRE(!writer);
+    BOOST_REQUIRE_EQUAL(sink[0], 'a');
+}
+
+// Writes are not partial.
+BOOST_AUTO_TEST_CASE(slab_writer__write_bytes__past_end__unchanged_invalid)
+{
+    data_chunk sink(2, 0x00);
+    write::bytes::fast writer(sink);
+    writer.write_bytes({ 0x01, 0x02, 0x03 });
+    BOOST_REQUIRE(!writer);
+    BOOST_REQUIRE_EQUAL(sink, (data_chunk{ 0x00, 0x00 }));
+}
+
+#endif // SLAB_WRITER_CONTEXT
+
+#ifdef SLAB_WRITER_INTEGERS
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_big_endian__uint32_t__expected)
+{
+    data_chunk sink(4);
+    write::bytes::fast writer(sink);
+    writer.write_big_endian<uint32_t>(0x01020304);
+    BOOST_REQUIRE_EQUAL(sink, (data_chunk{ 0x01, 0x02, 0x03, 0x04 }));
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_2_bytes_big_endian__value__expected)
+{
+    data_chunk sink(2);
+    write::bytes::fast writer(sink);
+    writer.write_2_bytes_big_endian(0x0102);
+    BOOST_REQUIRE_EQUAL(sink, (data_chunk{ 0x01, 0x02 }));
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_8_bytes_little_endian__value__expected)
+{
+    data_chunk sink(8);
+    write::bytes::fast writer(sink);
+    writer.write_8_bytes_little_endian(0x0807060504030201);
+    BOOST_REQUIRE_EQUAL(sink,
+        (data_chunk{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 }));
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_variable__each_size__expected)
+{
+    const data_chunk expected
+    {
+        0x42,
+        varint_two_bytes, 0x01, 0x02,
+        varint_four_bytes, 0x01, 0x02, 0x03, 0x04,
+        varint_eight_bytes, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+    };
+
+    data_chunk sink(expected.size());
+    write::bytes::fast writer(sink);
+    writer.write_variable(0x42);
+    writer.write_variable(0x0201);
+    writer.write_variable(0x04030201);
+    writer.write_variable(0x0807060504030201);
+    BOOST_REQUIRE_EQUAL(sink, expected);
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_error_code__value__expected)
+{
+    data_chunk sink(4);
+    write::bytes::fast writer(sink);
+    writer.write_error_code(error::double_spend);
+    const data_chunk expected{ error::double_spend, 0x00, 0x00, 0x00 };
+    BOOST_REQUIRE_EQUAL(sink, expected);
+    BOOST_REQUIRE(writer);
+}
+
+#endif // SLAB_WRITER_INTEGERS
+
+#ifdef SLAB_WRITER_BYTES
+
+BOOST_AUTO_TEST_CASE(slab_writer__write__stream__expected)
+{
+    data_chunk sink(3);
+    std::istringstream stream{ "abc" };
+    write::bytes::fast writer(sink);
+    writer.write(stream);
+    BOOST_REQUIRE_EQUAL(sink, (data_chunk{ 'a', 'b', 'c' }));
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_bytes__array__expected)
+{
+    const auto expected = base16_hash(
+        "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    hash_digest sink{};
+    write::bytes::fast writer(sink);
+    writer.write_bytes(expected);
+    BOOST_REQUIRE_EQUAL(sink, expected);
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_bytes__pointer__expected)
+{
+    const data_chunk expected{ 'a', 'b', 'c' };
+    data_chunk sink(3);
+    write::bytes::fast writer(sink);
+    writer.write_bytes(expected.data(), expected.size());
+    BOOST_REQUIRE_EQUAL(sink, expected);
+    BOOST_REQUIRE(writer);
+}
+
+#endif // SLAB_WRITER_BYTES
+
+#ifdef SLAB_WRITER_STRINGS
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_string__value__prefixed)
+{
+    data_chunk sink(4);
+    write::bytes::fast writer(sink);
+    writer.write_string("abc");
+    BOOST_REQUIRE_EQUAL(sink, (data_chunk{ 0x03, 'a', 'b', 'c' }));
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_string_buffer__short__padded)
+{
+    data_chunk sink(5, 0xff);
+    write::bytes::fast writer(sink);
+    writer.write_string_buffer("abc", 5);
+    BOOST_REQUIRE_EQUAL(sink, (data_chunk{ 'a', 'b', 'c', 0x00, 0x00 }));
+    BOOST_REQUIRE(writer);
+}
+
+BOOST_AUTO_TEST_CASE(slab_writer__write_string_buffer__long__truncated)
+{
+    data_chunk sink(2);
+    write::bytes::fast writer(sink);
+    writer.write_string_buffer("abc", 2);
+    BOOST_REQUIRE_EQUAL(sink, (data_chunk{ 'a', 'b' }));
+    BOOST_REQUIRE(writer);
+}
+
+#endif // SLAB_WRITER_STRINGS
+
+BOOST_AUTO_TEST_SUITE_END()
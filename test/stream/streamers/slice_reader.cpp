@@ -0,0 +1,440 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stream_tests)
+
+// Failed get/peek reads are populated with 0x00 by the reader.
+constexpr uint8_t pad = 0x00;
+
+#define SLICE_READER_CONTEXT
+#define SLICE_READER_INTEGERS
+#define SLICE_READER_BYTES
+#define SLICE_READER_STRINGS
+
+#ifdef SLICE_READER_CONTEXT
+
+// bool
+
+BOOST_AUTO_TEST_CASE(slice_reader__bool__empty__true)
+{
+    const data_chunk data{};
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__bool__not_empty__true)
+{
+    const data_chunk data{ '*' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE(reader);
+}
+
+// is_exhausted
+
+BOOST_AUTO_TEST_CASE(slice_reader__is_exhausted__empty__true_valid)
+{
+    const data_chunk data{};
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__is_exhausted__not_empty__false)
+{
+    const data_chunk data{ '*' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE(!reader.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__is_exhausted__end__true)
+{
+    const data_chunk data{ '*' };
+    read::bytes::fast reader(data);
+    reader.skip_byte();
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+// invalidate
+
+BOOST_AUTO_TEST_CASE(slice_reader__invalidate__not_empty__invalid_exhausted)
+{
+    const data_chunk data{ '*' };
+    read::bytes::fast reader(data);
+    reader.invalidate();
+    BOOST_REQUIRE(!reader);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+// skip/rewind
+
+BOOST_AUTO_TEST_CASE(slice_reader__skip_bytes__past_end__invalid)
+{
+    const data_chunk data{ 'a', 'b' };
+    read::bytes::fast reader(data);
+    reader.skip_bytes(3);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__rewind_bytes__to_begin__expected)
+{
+    const data_chunk data{ 'a', 'b' };
+    read::bytes::fast reader(data);
+    reader.skip_bytes(2);
+    reader.rewind_bytes(2);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'a');
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__rewind_byte__past_begin__invalid)
+{
+    const data_chunk data{ 'a', 'b' };
+    read::bytes::fast reader(data);
+    reader.rewind_byte();
+    BOOST_REQUIRE(!reader);
+}
+
+// get_position/set_position
+
+BOOST_AUTO_TEST_CASE(slice_reader__get_position__read__expected)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.get_position(), 0u);
+    reader.read_byte();
+    BOOST_REQUIRE_EQUAL(reader.get_position(), 1u);
+    reader.skip_bytes(2);
+    BOOST_REQUIRE_EQUAL(reader.get_position(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_position__invalid__clears)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    reader.skip_bytes(4);
+    BOOST_REQUIRE(!reader);
+    reader.set_position(1);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'b');
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_position__past_end__invalid)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    reader.set_position(4);
+    BOOST_REQUIRE(!reader);
+}
+
+// get_slice
+
+BOOST_AUTO_TEST_CASE(slice_reader__get_slice__within__expected)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.get_slice(1, 3).to_chunk(), (data_chunk{ 'b', 'c' }));
+    BOOST_REQUIRE(reader.get_slice(2, 2).empty());
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__get_slice__outside__empty)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE(reader.get_slice(1, 4).empty());
+    BOOST_REQUIRE(reader.get_slice(2, 1).empty());
+}
+
+// set_limit
+
+BOOST_AUTO_TEST_CASE(slice_reader__set_limit__default__unlimited)
+{
+    const data_chunk data(42, 0x42);
+    read::bytes::fast reader(data);
+    reader.set_limit();
+    reader.set_position(sub1(data.size()));
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 0x42u);
+    BOOST_REQUIRE(reader.is_exhausted());
+}
+
+// set_position back tests both set_position and rewind.
+BOOST_AUTO_TEST_CASE(slice_reader__set_limit__set_position_back__limited)
+{
+    const data_chunk data{ 'a', 'b', 'c', 'd', 'e' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'a');
+
+    // Position is 1, set limit +2 (to absolute 3).
+    reader.set_limit(2);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'b');
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'c');
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+
+    // Peek past limit invalidates.
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), pad);
+    BOOST_REQUIRE(!reader);
+
+    // Reset absolute position to 1 and clear invalid state.
+    reader.set_position(1);
+    BOOST_REQUIRE(!reader.is_exhausted());
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'b');
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'c');
+    BOOST_REQUIRE(reader);
+
+    // Read past limit invalidates.
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), pad);
+    BOOST_REQUIRE(!reader);
+
+    // Remove the limit.
+    reader.set_position(3);
+    reader.set_limit();
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'd');
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'e');
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+#endif // SLICE_READER_CONTEXT
+
+#ifdef SLICE_READER_INTEGERS
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_big_endian__full__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04 };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_big_endian<uint32_t>(), 0x01020304u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_4_bytes_little_endian__full__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04 };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_4_bytes_little_endian(), 0x04030201u);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_8_bytes_big_endian__empty__zero_invalid)
+{
+    const data_chunk data{};
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_8_bytes_big_endian(), 0u);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_variable__each_size__expected)
+{
+    const data_chunk data
+    {
+        0x42,
+        varint_two_bytes, 0x01, 0x02,
+        varint_four_bytes, 0x01, 0x02, 0x03, 0x04,
+        varint_eight_bytes, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+    };
+
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x42u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x0201u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x04030201u);
+    BOOST_REQUIRE_EQUAL(reader.read_variable(), 0x0807060504030201u);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_size__exceeds_limit__zero_invalid)
+{
+    const data_chunk data{ 0x42 };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_size(0x41), zero);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_error_code__value__expected)
+{
+    const data_chunk data{ 0x01, 0x00, 0x00, 0x00 };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_error_code().value(), 1);
+    BOOST_REQUIRE(reader);
+}
+
+#endif // SLICE_READER_INTEGERS
+
+#ifdef SLICE_READER_BYTES
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_forward__not_empty__expected)
+{
+    const data_array<4> expected{ 0x01, 0x02, 0x03, 0x04 };
+    read::bytes::fast reader(expected);
+    BOOST_REQUIRE_EQUAL(reader.read_forward<4>(), expected);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_forward__past_end__padded_invalid)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    const data_array<4> expected{ 0x01, 0x02, pad, pad };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_forward<4>(), expected);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_forward__past_limit__pad_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04 };
+    const data_array<4> expected{ pad, pad, pad, pad };
+    read::bytes::fast reader(data);
+    reader.set_limit(2);
+    BOOST_REQUIRE_EQUAL(reader.read_forward<4>(), expected);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_reverse__not_empty__expected)
+{
+    const data_array<4> data{ 0x01, 0x02, 0x03, 0x04 };
+    const data_array<4> expected{ 0x04, 0x03, 0x02, 0x01 };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_reverse<4>(), expected);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_hash__value__expected)
+{
+    const auto expected = base16_hash(
+        "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    read::bytes::fast reader(expected);
+    BOOST_REQUIRE_EQUAL(reader.read_hash(), expected);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__peek_byte__not_empty__expected_not_advanced)
+{
+    const data_chunk data{ 'a', 'b' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 'a');
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), 'a');
+    BOOST_REQUIRE_EQUAL(reader.get_position(), 0u);
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__peek_byte__end__pad_invalid)
+{
+    const data_chunk data{ 'a' };
+    read::bytes::fast reader(data);
+    reader.skip_byte();
+    BOOST_REQUIRE_EQUAL(reader.peek_byte(), pad);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_byte__end__pad_invalid)
+{
+    const data_chunk data{ 'a' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), 'a');
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), pad);
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_bytes0__not_empty__expected_valid)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    reader.skip_byte();
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(), (data_chunk{ 'b', 'c' }));
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_bytes0__limited__to_limit_valid)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    reader.set_limit(2);
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(), (data_chunk{ 'a', 'b' }));
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_bytes1__middle__expected)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(2), (data_chunk{ 'a', 'b' }));
+    BOOST_REQUIRE(!reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_bytes1__past_end__padded_invalid)
+{
+    const data_chunk data{ 'a', 'b' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_bytes(3), (data_chunk{ 'a', 'b', pad }));
+    BOOST_REQUIRE(!reader);
+}
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_bytes2__to_end__expected)
+{
+    const data_chunk data{ 'a', 'b', 'c' };
+    data_chunk buffer(3);
+    read::bytes::fast reader(data);
+    reader.read_bytes(buffer.data(), buffer.size());
+    BOOST_REQUIRE_EQUAL(buffer, data);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+#endif // SLICE_READER_BYTES
+
+#ifdef SLICE_READER_STRINGS
+
+BOOST_AUTO_TEST_CASE(slice_reader__read_string__prefixed__expected)
+{
+    const data_chunk data{ 0x03, 'a', 'b', 'c', '*' };
+    read::bytes::fast reader(data);
+    BOOST_REQUIRE_EQUAL(reader.read_string(), "abc");
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), '*');
+    BOOST_REQUIRE(reader);
+}
+
+// The full number of bytes are read, but not past end.
+BOOST_AUTO_TEST_CASE(slice_reader__read_string_buffer__past_end__truncated_valid)
+{
+    const std::string value{ "abcdefghij" };
+    read::bytes::fast reader(value);
+    BOOST_REQUIRE_EQUAL(reader.read_string_buffer(add1(value.length())), value);
+    BOOST_REQUIRE(reader.is_exhausted());
+    BOOST_REQUIRE(reader);
+}
+
+// The full number of bytes are read, and the string is terminated at null.
+BOOST_AUTO_TEST_CASE(slice_reader__read_string_buffer__partial_embedded_null__truncated_not_exhausted)
+{
+    const std::string value{ "abcdef\0hij*", 11 };
+    read::bytes::fast reader(value);
+    BOOST_REQUIRE_EQUAL(reader.read_string_buffer(10), "abcdef");
+    BOOST_REQUIRE(!reader.is_exhausted());
+    BOOST_REQUIRE_EQUAL(reader.read_byte(), '*');
+    BOOST_REQUIRE(reader);
+}
+
+#endif // SLICE_READER_STRINGS
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stealth_scanner_tests)
+
+using namespace bc::system::wallet;
+
+#define MAIN_KEY "tprv8ctN3HAF9dCgX9ggdCwiZHa7c3UHuG2Ev4jgYWDhTHDUVWKKsg7znbr3vYtmCzVqcMQsjd9cSKsyKGaDvTAUMkw1UphETe1j8LcT21eWPkH"
+#define EPHEMERAL_PRIVATE "f91e673103863bbeb0ef1852cd8eade6b73ea55afc9b1873be62bf628eac072a"
+
+static stealth_receiver get_receiver(uint32_t account)
+{
+    const hd_private main_key(MAIN_KEY, hd_private::testnet);
+    const auto scan_key = main_key.derive_private(account + 0 + hd_first_hardened_key);
+    const auto spend_key = main_key.derive_private(account + 1 + hd_first_hardened_key);
+    return { scan_key.secret(), spend_key.secret(), binary{}, payment_address::testnet_p2kh };
+}
+
+static stealth_scanner::row get_row(const stealth_sender& sender)
+{
+    stealth_scanner::row row{};
+    BOOST_REQUIRE(extract_ephemeral_key(row.ephemeral_public, sender.stealth_script()));
+    BOOST_REQUIRE(to_stealth_prefix(row.prefix, sender.stealth_script()));
+    row.payee = sender.payment_address().hash();
+    return row;
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__empty__empty)
+{
+    const stealth_scanner scanner({ get_receiver(0) });
+    BOOST_REQUIRE_EQUAL(scanner.size(), 1u);
+    BOOST_REQUIRE(scanner.scan({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__paid_receiver__expected_match)
+{
+    const auto paid = get_receiver(0);
+    const auto other = get_receiver(2);
+    BOOST_REQUIRE(paid);
+    BOOST_REQUIRE(other);
+
+    ec_secret ephemeral_private;
+    BOOST_REQUIRE(decode_base16(ephemeral_private, EPHEMERAL_PRIVATE));
+    const stealth_sender sender(ephemeral_private, paid.stealth_address(),
+        data_chunk{}, binary{}, payment_address::testnet_p2kh);
+    BOOST_REQUIRE(sender);
+
+    // A decoy row with the same ephemeral key but another payee.
+    auto decoy = get_row(sender);
+    decoy.payee = null_short_hash;
+
+    const stealth_scanner scanner({ other, paid });
+    const auto matches = scanner.scan({ decoy, get_row(sender) });
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+    BOOST_REQUIRE_EQUAL(matches.front().row, 1u);
+    BOOST_REQUIRE_EQUAL(matches.front().receiver, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(stealth_scanner__scan__filter_mismatch__no_match)
+{
+    const hd_private main_key(MAIN_KEY, hd_private::testnet);
+    const auto scan_key = main_key.derive_private(0 + hd_first_hardened_key);
+    const auto spend_key = main_key.derive_private(1 + hd_first_hardened_key);
+    const auto paid = get_receiver(0);
+
+    ec_secret ephemeral_private;
+    BOOST_REQUIRE(decode_base16(ephemeral_private, EPHEMERAL_PRIVATE));
+    const stealth_sender sender(ephemeral_private, paid.stealth_address(),
+        data_chunk{}, binary{}, payment_address::testnet_p2kh);
+    BOOST_REQUIRE(sender);
+
+    // The same keys, but with a filter that excludes the row prefix.
+    const auto row = get_row(sender);
+    const binary prefix{ 8, to_little_endian(row.prefix) };
+    const binary filter{ prefix[0] ? "0" : "1" };
+    const stealth_receiver filtered(scan_key.secret(), spend_key.secret(),
+        filter, payment_address::testnet_p2kh);
+    BOOST_REQUIRE(filtered);
+
+    BOOST_REQUIRE(stealth_scanner({ filtered }).scan({ row }).empty());
+    BOOST_REQUIRE_EQUAL(stealth_scanner({ paid }).scan({ row }).size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(vanity_search_tests)
+
+using namespace bc::system::wallet;
+
+// The compressed public key of secret 1 is the generator point.
+#define GENERATOR_P2KH "1BgGZ9tcN4rm9KBzDn7KprQz87SZ26SAMH"
+#define GENERATOR_P2WPKH "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"
+#define GENERATOR_HASH "751e76e8199196d454941c45d1b3a323f1433bd6"
+
+static ec_secret get_secret(uint8_t value)
+{
+    ec_secret secret{};
+    secret.back() = value;
+    return secret;
+}
+
+// from_payment
+
+BOOST_AUTO_TEST_CASE(vanity_search__from_payment__unmatchable__false)
+{
+    // Invalid base58, too many leading zeros, version 0x00 is always '1'.
+    BOOST_REQUIRE(!vanity_search::from_payment("10"));
+    BOOST_REQUIRE(!vanity_search::from_payment(std::string(26, '1')));
+    BOOST_REQUIRE(!vanity_search::from_payment("3"));
+    BOOST_REQUIRE(!vanity_search::from_payment("2", payment_address::testnet_p2kh));
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__from_payment__matchable__true)
+{
+    BOOST_REQUIRE(vanity_search::from_payment(""));
+    BOOST_REQUIRE(vanity_search::from_payment("1"));
+    BOOST_REQUIRE(vanity_search::from_payment("1111"));
+    BOOST_REQUIRE(vanity_search::from_payment("1Love"));
+    BOOST_REQUIRE(vanity_search::from_payment("3", payment_address::mainnet_p2sh));
+    BOOST_REQUIRE(vanity_search::from_payment("m", payment_address::testnet_p2kh));
+    BOOST_REQUIRE(vanity_search::from_payment("n", payment_address::testnet_p2kh));
+    BOOST_REQUIRE_EQUAL(vanity_search::from_payment("1Love").pattern(), "1Love");
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__from_payment__is_candidate__expected)
+{
+    short_hash hash{};
+    BOOST_REQUIRE(decode_base16(hash, GENERATOR_HASH));
+    BOOST_REQUIRE(vanity_search::from_payment("1").is_candidate(hash));
+    BOOST_REQUIRE(vanity_search::from_payment("1BgGZ9t").is_candidate(hash));
+    BOOST_REQUIRE(!vanity_search::from_payment("1BgGZ9u").is_candidate(hash));
+    BOOST_REQUIRE(!vanity_search::from_payment("11").is_candidate(hash));
+    BOOST_REQUIRE(!vanity_search::from_payment("1A").is_candidate(hash));
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__from_payment__is_candidate_null_hash__expected)
+{
+    // Address of the null hash is 1111111111111111111114oLvT2.
+    BOOST_REQUIRE(vanity_search::from_payment("1").is_candidate(null_short_hash));
+    BOOST_REQUIRE(vanity_search::from_payment(std::string(21, '1')).is_candidate(null_short_hash));
+    BOOST_REQUIRE(vanity_search::from_payment("1111111111111111111114o").is_candidate(null_short_hash));
+    BOOST_REQUIRE(!vanity_search::from_payment("12").is_candidate(null_short_hash));
+}
+
+// from_witness
+
+BOOST_AUTO_TEST_CASE(vanity_search__from_witness__unmatchable__false)
+{
+    // Wrong prefix or version, invalid base32, upper case, too long, no prefix.
+    BOOST_REQUIRE(!vanity_search::from_witness("tb1q"));
+    BOOST_REQUIRE(!vanity_search::from_witness("bc1p"));
+    BOOST_REQUIRE(!vanity_search::from_witness("bc1qb"));
+    BOOST_REQUIRE(!vanity_search::from_witness("bc1qW"));
+    BOOST_REQUIRE(!vanity_search::from_witness("bc1q" + std::string(33, 'q')));
+    BOOST_REQUIRE(!vanity_search::from_witness("1q", ""));
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__from_witness__matchable__true)
+{
+    BOOST_REQUIRE(vanity_search::from_witness(""));
+    BOOST_REQUIRE(vanity_search::from_witness("bc"));
+    BOOST_REQUIRE(vanity_search::from_witness("bc1q"));
+    BOOST_REQUIRE(vanity_search::from_witness("bc1qxyz"));
+    BOOST_REQUIRE(vanity_search::from_witness("bc1q" + std::string(32, 'q')));
+    BOOST_REQUIRE(vanity_search::from_witness("tb1q", witness_address::testnet));
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__from_witness__is_candidate__expected)
+{
+    short_hash hash{};
+    BOOST_REQUIRE(decode_base16(hash, GENERATOR_HASH));
+    BOOST_REQUIRE(vanity_search::from_witness("bc1q").is_candidate(hash));
+    BOOST_REQUIRE(vanity_search::from_witness("bc1qw508d6").is_candidate(hash));
+    BOOST_REQUIRE(vanity_search::from_witness(std::string(GENERATOR_P2WPKH).substr(0, 36)).is_candidate(hash));
+    BOOST_REQUIRE(!vanity_search::from_witness("bc1qw508d7").is_candidate(hash));
+    BOOST_REQUIRE(!vanity_search::from_witness("bc1qq").is_candidate(hash));
+}
+
+// match
+
+BOOST_AUTO_TEST_CASE(vanity_search__match__generator__expected)
+{
+    const auto point = ec_compressed_generator;
+    BOOST_REQUIRE_EQUAL(vanity_search::from_payment("1BgG").match(point), GENERATOR_P2KH);
+    BOOST_REQUIRE_EQUAL(vanity_search::from_witness("bc1qw5").match(point), GENERATOR_P2WPKH);
+    BOOST_REQUIRE(vanity_search::from_payment("1BgH").match(point).empty());
+    BOOST_REQUIRE(vanity_search::from_witness("bc1qw6").match(point).empty());
+}
+
+// search
+
+BOOST_AUTO_TEST_CASE(vanity_search__search__unmatchable__empty)
+{
+    const auto search = vanity_search::from_payment("3");
+    BOOST_REQUIRE(search.search(get_secret(1), 1, 1, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__search__zero_limit__empty)
+{
+    const auto search = vanity_search::from_payment("1");
+    BOOST_REQUIRE(search.search(get_secret(1), 1, 0, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__search__seed_matches__seed)
+{
+    const auto search = vanity_search::from_payment("1BgG");
+    const auto hits = search.search(get_secret(1), 1, 1, {});
+    BOOST_REQUIRE_EQUAL(hits.size(), 1u);
+    BOOST_REQUIRE_EQUAL(hits.front().secret, get_secret(1));
+    BOOST_REQUIRE_EQUAL(hits.front().address, GENERATOR_P2KH);
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__search__stepped_keys__expected)
+{
+    // Every key matches, so hits are the seed and its successors.
+    const auto search = vanity_search::from_payment("1");
+    const auto hits = search.search(get_secret(1), 1, 3, {});
+    BOOST_REQUIRE_EQUAL(hits.size(), 3u);
+    BOOST_REQUIRE_EQUAL(hits[0].secret, get_secret(1));
+    BOOST_REQUIRE_EQUAL(hits[1].secret, get_secret(2));
+    BOOST_REQUIRE_EQUAL(hits[2].secret, get_secret(3));
+    BOOST_REQUIRE_EQUAL(hits[0].address, GENERATOR_P2KH);
+    BOOST_REQUIRE_EQUAL(hits[1].address, payment_address(ec_private(get_secret(2))).encoded());
+    BOOST_REQUIRE_EQUAL(hits[2].address, payment_address(ec_private(get_secret(3))).encoded());
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__search__lanes__hits_match_secrets)
+{
+    // One in 32 (p2wpkh) keys matches.
+    const auto search = vanity_search::from_witness("bc1qq");
+    const auto hits = search.search(get_secret(42), 4, 8, {});
+    BOOST_REQUIRE_EQUAL(hits.size(), 8u);
+
+    for (const auto& hit: hits)
+    {
+        ec_compressed point{};
+        BOOST_REQUIRE(secret_to_public(point, hit.secret));
+        BOOST_REQUIRE_EQUAL(search.match(point), hit.address);
+        BOOST_REQUIRE_EQUAL(witness_address(ec_private(hit.secret)).encoded(), hit.address);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__search__lanes__hits_from_each_lane)
+{
+    // Every p2kh key matches "1", so each lane hits until the handler stops.
+    constexpr size_t lanes = 4;
+    const auto search = vanity_search::from_payment("1");
+    const auto handler = [](const vanity_search::progress& progress)
+    {
+        return progress.keys < lanes * 16u * vanity_search::batch_size;
+    };
+
+    const auto hits = search.search(get_secret(1), lanes, max_size_t, handler);
+    BOOST_REQUIRE(!hits.empty());
+
+    // Lane n starts at seed + (n << 64), so the lane is the secret >> 64.
+    std::vector<bool> seen(lanes, false);
+    for (const auto& hit: hits)
+    {
+        const auto value = from_big_endian(hit.secret);
+        const auto lane = static_cast<uint64_t>(value >> 64);
+        BOOST_REQUIRE_LT(lane, lanes);
+        seen[lane] = true;
+    }
+
+    BOOST_REQUIRE(std::all_of(seen.begin(), seen.end(), [](bool lane)
+    {
+        return lane;
+    }));
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__search__handler_stop__stopped)
+{
+    size_t calls{};
+    vanity_search::progress last{};
+    const auto handler = [&](const vanity_search::progress& progress)
+    {
+        ++calls;
+        last = progress;
+        return false;
+    };
+
+    // Expected one hit in 2^58 keys.
+    const auto search = vanity_search::from_payment("1BgGZ9tcN4r");
+    BOOST_REQUIRE(search.search(get_secret(1), 1, 2, handler).size() == 1u);
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE_EQUAL(last.keys, vanity_search::batch_size);
+    BOOST_REQUIRE_EQUAL(last.hits, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
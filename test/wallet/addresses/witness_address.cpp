@@ -1071,4 +1071,83 @@ BOOST_AUTO_TEST_CASE(witness_address__bip173__invalid_address10__payload_too_sho
     BOOST_REQUIRE(witness_address::parse_address(out1, out2, out3, "bc1gmk9yu") == result::payload_too_short);
 }
 
+// batch
+
+BOOST_AUTO_TEST_CASE(witness_address__to_addresses__scripts__expected)
+{
+    const data_stack scripts
+    {
+        base16_chunk("0014751e76e8199196d454941c45d1b3a323f1433bd6"),
+        base16_chunk("00201863143c14c5166804bd19203356da136c985678cd4d27a1b8c6329604903262"),
+        base16_chunk("6002751e"),
+        base16_chunk("76a914751e76e8199196d454941c45d1b3a323f1433bd688ac"),
+        base16_chunk("0013751e76e8199196d454941c45d1b3a323f1433b"),
+        base16_chunk("0015751e76e8199196d454941c45d1b3a323f1433bd6"),
+        {}
+    };
+
+    const auto addresses = witness_address::to_addresses(scripts, "tb");
+    BOOST_REQUIRE_EQUAL(addresses.size(), scripts.size());
+    BOOST_REQUIRE_EQUAL(addresses[0], "tb1qw508d6qejxtdg4y5r3zarvary0c5xw7kxpjzsx");
+    BOOST_REQUIRE_EQUAL(addresses[1], "tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3q0sl5k7");
+    BOOST_REQUIRE_EQUAL(addresses[2], witness_address(base16_chunk("751e"), "tb", 16).encoded());
+    BOOST_REQUIRE(addresses[3].empty());
+    BOOST_REQUIRE(addresses[4].empty());
+    BOOST_REQUIRE(addresses[5].empty());
+    BOOST_REQUIRE(addresses[6].empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__to_addresses__invalid_prefix__empty)
+{
+    const data_stack scripts{ base16_chunk("0014751e76e8199196d454941c45d1b3a323f1433bd6") };
+    const auto addresses = witness_address::to_addresses(scripts, "BC");
+    BOOST_REQUIRE_EQUAL(addresses.size(), 1u);
+    BOOST_REQUIRE(addresses.front().empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__to_scripts__addresses__expected)
+{
+    const string_list addresses
+    {
+        "BC1QW508D6QEJXTDG4Y5R3ZARVARY0C5XW7KV8F3T4",
+        "bc1pw508d6qejxtdg4y5r3zarvary0c5xw7kw508d6qejxtdg4y5r3zarvary0c5xw7kt5nd6y",
+        "tb1qw508d6qejxtdg4y5r3zarvary0c5xw7kxpjzsx",
+        "BC1QR508D6QEJXTDG4Y5R3ZARVARYV98GJ9P",
+        "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t5",
+        ""
+    };
+
+    const auto scripts = witness_address::to_scripts(addresses, "bc");
+    BOOST_REQUIRE_EQUAL(scripts.size(), addresses.size());
+    BOOST_REQUIRE_EQUAL(scripts[0], base16_chunk("0014751e76e8199196d454941c45d1b3a323f1433bd6"));
+    BOOST_REQUIRE_EQUAL(scripts[1], base16_chunk("5128751e76e8199196d454941c45d1b3a323f1433bd6751e76e8199196d454941c45d1b3a323f1433bd6"));
+    BOOST_REQUIRE(scripts[2].empty());
+    BOOST_REQUIRE(scripts[3].empty());
+    BOOST_REQUIRE(scripts[4].empty());
+    BOOST_REQUIRE(scripts[5].empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__to_scripts__to_addresses__round_trips)
+{
+    data_stack scripts{};
+    for (uint8_t version = 0; version <= 16; ++version)
+    {
+        const auto size = is_zero(version) ? 32u : add1(version) * 2u;
+        data_chunk program(size);
+        for (size_t index = 0; index < size; ++index)
+            program[index] = narrow_cast<uint8_t>(index * version + 7u);
+
+        scripts.push_back(script(script::to_pay_witness_pattern(version, program)).to_data(false));
+    }
+
+    const auto addresses = witness_address::to_addresses(scripts, "bc");
+    for (size_t index = 0; index < scripts.size(); ++index)
+    {
+        const witness_address address(addresses[index]);
+        BOOST_REQUIRE_EQUAL(address.script().to_data(false), scripts[index]);
+    }
+
+    BOOST_REQUIRE_EQUAL(witness_address::to_scripts(addresses, "bc"), scripts);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -433,6 +433,92 @@ BOOST_AUTO_TEST_CASE(encrypted__decrypt_public__vector_9__expected)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(encrypted__batch)
+
+BOOST_AUTO_TEST_CASE(encrypted__batch__empty__true_empty)
+{
+    encrypted_privates out_privates{ encrypted_private{} };
+    BOOST_REQUIRE(encrypt(out_privates, {}, "TestingOneTwoThree", 0x00, false));
+    BOOST_REQUIRE(out_privates.empty());
+
+    ek_decryptions out{ ek_decryption{} };
+    BOOST_REQUIRE(decrypt(out, {}, "TestingOneTwoThree"));
+    BOOST_REQUIRE(out.empty());
+}
+
+// github.com/bitcoin/bips/blob/master/bip-0038.mediawiki#no-compression-no-ec-multiply
+BOOST_AUTO_TEST_CASE(encrypted__batch__encrypt_vectors_0_1__expected)
+{
+    const std::vector<ec_secret> secrets
+    {
+        base16_array("cbf4b9f70470856bb4f40f80b87edb90865997ffee6df315ab166d713af433a5"),
+        base16_array("09c2686880095b1a4c249ee3ac4eea8a014f11e6f986d0b5025ac1f39afbd9ae")
+    };
+
+    // Vector 1 is encrypted with another passphrase.
+    encrypted_private expected{};
+    BOOST_REQUIRE(encrypt(expected, secrets[1], "TestingOneTwoThree", 0x00, false));
+
+    encrypted_privates out_privates{};
+    BOOST_REQUIRE(encrypt(out_privates, secrets, "TestingOneTwoThree", 0x00, false));
+    BOOST_REQUIRE_EQUAL(out_privates.size(), 2u);
+    BOOST_REQUIRE_EQUAL(encode_base58(out_privates[0]), "6PRVWUbkzzsbcVac2qwfssoUJAN1Xhrg6bNk8J7Nzm5H7kxEbn2Nh2ZoGg");
+    BOOST_REQUIRE_EQUAL(out_privates[1], expected);
+}
+
+// github.com/bitcoin/bips/blob/master/bip-0038.mediawiki
+BOOST_AUTO_TEST_CASE(encrypted__batch__decrypt_vectors__expected)
+{
+    // Vector 1 passphrase is not valid, the last checksum is not valid.
+    const encrypted_privates keys
+    {
+        base58_array("6PRVWUbkzzsbcVac2qwfssoUJAN1Xhrg6bNk8J7Nzm5H7kxEbn2Nh2ZoGg"),
+        base58_array("6PRNFFkZc2NZ6dJqFfhRoFNMR9Lnyj7dYGrzdgXXVMXcxoKTePPX1dWByq"),
+        base58_array("6PYNKZ1EAgYgmQfmNVamxyXVWHzK5s6DGhwP4J5o44cvXdoY7sRzhtpUeo"),
+        base58_array("6PfQu77ygVyJLZjfvMLyhLMQbYnu5uguoJJ4kMCLqWwPEdfpwANVS76gTX"),
+        encrypted_private{}
+    };
+
+    ek_decryptions out{};
+    BOOST_REQUIRE(decrypt(out, keys, "TestingOneTwoThree"));
+    BOOST_REQUIRE_EQUAL(out.size(), 5u);
+    BOOST_REQUIRE(out[0].valid);
+    BOOST_REQUIRE(!out[1].valid);
+    BOOST_REQUIRE(out[2].valid);
+    BOOST_REQUIRE(out[3].valid);
+    BOOST_REQUIRE(!out[4].valid);
+    BOOST_REQUIRE_EQUAL(encode_base16(out[0].secret), "cbf4b9f70470856bb4f40f80b87edb90865997ffee6df315ab166d713af433a5");
+    BOOST_REQUIRE_EQUAL(encode_base16(out[2].secret), "cbf4b9f70470856bb4f40f80b87edb90865997ffee6df315ab166d713af433a5");
+    BOOST_REQUIRE_EQUAL(encode_base16(out[3].secret), "a43a940577f4e97f5c4d39eb14ff083a98187c64ea7c99ef7ce460833959a519");
+    BOOST_REQUIRE(!out[0].compressed);
+    BOOST_REQUIRE(out[2].compressed);
+    BOOST_REQUIRE(!out[3].compressed);
+    BOOST_REQUIRE_EQUAL(out[0].version, 0x00u);
+    BOOST_REQUIRE_EQUAL(out[3].version, 0x00u);
+}
+
+BOOST_AUTO_TEST_CASE(encrypted__batch__decrypt_minimum_memory__expected)
+{
+    // Derivations proceed serially below the memory of one.
+    const encrypted_privates keys
+    {
+        base58_array("6PgNBNNzDkKdhkT6uJntUXwwzQV8Rr2tZcbkDcuC9DZRsS6AtHts4Ypo1j"),
+        base58_array("6PgNBNNzDkKdhkT6uJntUXwwzQV8Rr2tZcbkDcuC9DZRsS6AtHts4Ypo1j")
+    };
+
+    ek_decryptions out{};
+    BOOST_REQUIRE(decrypt(out, keys, "MOLON LABE", 0));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE(out[0].valid);
+    BOOST_REQUIRE(out[1].valid);
+    BOOST_REQUIRE_EQUAL(encode_base16(out[0].secret), "44ea95afbf138356a05ea32110dfd627232d0f2991ad221187be356f19fa8190");
+    BOOST_REQUIRE_EQUAL(encode_base16(out[1].secret), "44ea95afbf138356a05ea32110dfd627232d0f2991ad221187be356f19fa8190");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 #endif // HAVE_ICU
 
 // ----------------------------------------------------------------------------
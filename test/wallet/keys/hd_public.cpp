@@ -93,4 +93,83 @@ BOOST_AUTO_TEST_CASE(hd_public__derive_public__long_seed__expected)
     BOOST_REQUIRE_EQUAL(m0xH1yH2_pub.encoded(), "xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt");
 }
 
+// derive_range
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_range__empty__true_empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    compressed_list points{ null_ec_compressed };
+    BOOST_REQUIRE(m_pub.derive_range(points, 42, 0));
+    BOOST_REQUIRE(points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_range__hardened__false)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    compressed_list points{};
+    BOOST_REQUIRE(!m_pub.derive_range(points, hd_first_hardened_key, 1));
+    BOOST_REQUIRE(!m_pub.derive_range(points, sub1(hd_first_hardened_key), 2));
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_range__partially_hardened__false_empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    compressed_list points{ null_ec_compressed, null_ec_compressed };
+    BOOST_REQUIRE(!m_pub.derive_range(points, hd_first_hardened_key - 10, 20));
+    BOOST_REQUIRE(points.empty());
+
+    short_hashes hashes{ null_short_hash };
+    BOOST_REQUIRE(!m_pub.derive_range(hashes, hd_first_hardened_key - 10, 20));
+    BOOST_REQUIRE(hashes.empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_range__invalid_parent__false_empty)
+{
+    const hd_public invalid{};
+    compressed_list points{ null_ec_compressed };
+    BOOST_REQUIRE(!invalid.derive_range(points, 0, 20));
+    BOOST_REQUIRE(points.empty());
+
+    short_hashes hashes{ null_short_hash };
+    BOOST_REQUIRE(!invalid.derive_range(hashes, 0, 20));
+    BOOST_REQUIRE(hashes.empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_range__points__expected)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    compressed_list points{};
+    BOOST_REQUIRE(m_pub.derive_range(points, 10, 100));
+    BOOST_REQUIRE_EQUAL(points.size(), 100u);
+
+    for (uint32_t index = 0; index < points.size(); ++index)
+        BOOST_REQUIRE_EQUAL(points[index], m_pub.derive_public(10 + index).point());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_range__short_hashes__expected)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    short_hashes hashes{};
+    BOOST_REQUIRE(m_pub.derive_range(hashes, 0, 20));
+    BOOST_REQUIRE_EQUAL(hashes.size(), 20u);
+
+    for (uint32_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], bitcoin_short_hash(m_pub.derive_public(index).point()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
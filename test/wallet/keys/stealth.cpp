@@ -149,4 +149,15 @@ BOOST_AUTO_TEST_CASE(bitfield_test4)
     BOOST_REQUIRE_EQUAL(prefix, compare);
 }
 
+BOOST_AUTO_TEST_CASE(is_stealth_filtered__leftmost_bits__expected)
+{
+    // Prefix bytes are little endian, so the leftmost bits are 0x69.
+    constexpr uint32_t prefix = 0x8bf41c69;
+    BOOST_REQUIRE(is_stealth_filtered(binary{}, prefix));
+    BOOST_REQUIRE(is_stealth_filtered(binary("0110"), prefix));
+    BOOST_REQUIRE(is_stealth_filtered(binary(32, to_little_endian(prefix)), prefix));
+    BOOST_REQUIRE(!is_stealth_filtered(binary("0111"), prefix));
+    BOOST_REQUIRE(!is_stealth_filtered(binary(33, data_chunk(5, 0x00)), 0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
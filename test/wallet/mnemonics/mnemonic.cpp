@@ -124,6 +124,59 @@ BOOST_AUTO_TEST_CASE(mnemonic__is_valid_word_count__valid__true)
     BOOST_CHECK(mnemonic::is_valid_word_count(24));
 }
 
+// from_sentences
+
+BOOST_AUTO_TEST_CASE(mnemonic__from_sentences__empty__empty)
+{
+    BOOST_REQUIRE(mnemonic::from_sentences({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__from_sentences__mixed__expected_order_and_validity)
+{
+    const auto instances = mnemonic::from_sentences(
+    {
+        vectors_en[0].mnemonic,
+        "abandon abandon",
+        vectors_en[1].mnemonic
+    }, language::en);
+
+    BOOST_REQUIRE_EQUAL(instances.size(), 3u);
+    BOOST_REQUIRE(instances[0]);
+    BOOST_REQUIRE(!instances[1]);
+    BOOST_REQUIRE(instances[2]);
+    BOOST_REQUIRE(instances[0] == mnemonic(vectors_en[0].mnemonic));
+    BOOST_REQUIRE(instances[2] == mnemonic(vectors_en[1].mnemonic));
+}
+
+// to_seeds
+
+BOOST_AUTO_TEST_CASE(mnemonic__to_seeds__empty__empty)
+{
+    BOOST_REQUIRE(mnemonic::to_seeds({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__to_seeds__vectors__expected)
+{
+    string_list sentences{};
+    for (const auto& vector: vectors_en)
+        sentences.push_back(vector.mnemonic);
+
+    // Invalid mnemonic produces null seed in its position.
+    sentences.push_back("");
+
+    const auto seeds = mnemonic::to_seeds(
+        mnemonic::from_sentences(sentences, language::en), "TREZOR");
+
+    BOOST_REQUIRE_EQUAL(seeds.size(), add1(vectors_en.size()));
+    for (size_t index = 0; index < vectors_en.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(vectors_en[index].passphrase, "TREZOR");
+        BOOST_REQUIRE_EQUAL(seeds[index], vectors_en[index].seed());
+    }
+
+    BOOST_REQUIRE_EQUAL(seeds.back(), long_hash{});
+}
+
 #endif // PUBLIC_STATIC
 
 #ifdef PROTECTED_STATIC
@@ -199,6 +199,22 @@ BOOST_AUTO_TEST_CASE(dictionaries__index2__none__empty)
     BOOST_REQUIRE(indexes.empty());
 }
 
+BOOST_AUTO_TEST_CASE(dictionaries__locate__valid_words__expected)
+{
+    using location = test_dictionaries::location;
+    BOOST_REQUIRE(instance.locate(test_words_en.word[0]) == location(language::en, 0));
+    BOOST_REQUIRE(instance.locate(test_words_es.word[1]) == location(language::es, 1));
+    BOOST_REQUIRE(instance.locate(test_words_ja.word[2]) == location(language::ja, 2));
+    BOOST_REQUIRE(instance.locate(test_words_zh_Hant.word[4]) == location(language::zh_Hans, 4));
+}
+
+BOOST_AUTO_TEST_CASE(dictionaries__locate__invalid_words__not_found)
+{
+    using location = test_dictionaries::location;
+    BOOST_REQUIRE(instance.locate("foo") == location(language::none, -1));
+    BOOST_REQUIRE(instance.locate("") == location(language::none, -1));
+}
+
 BOOST_AUTO_TEST_CASE(dictionaries__contains1__default_dictionary__expected)
 {
     BOOST_REQUIRE(instance.contains(test_words_en.word[0]) == language::en);
@@ -170,4 +170,62 @@ BOOST_AUTO_TEST_CASE(dictionary__contains2__empty__true)
     BOOST_REQUIRE(instance.contains(string_list{}));
 }
 
+// hashed
+
+static const dictionary<test_dictionary_size>::table& test_table() NOEXCEPT
+{
+    static const dictionary<test_dictionary_size>::table table
+    {
+        test_words_es.word
+    };
+
+    return table;
+}
+
+BOOST_AUTO_TEST_CASE(dictionary__index1__hashed_words__expected)
+{
+    const dictionary<test_dictionary_size> hashed(language::es, test_words_es,
+        test_table);
+
+    for (size_t index = 0; index < test_dictionary_size; ++index)
+        BOOST_REQUIRE_EQUAL(hashed.index(test_words_es.word[index]),
+            possible_narrow_sign_cast<int32_t>(index));
+
+    BOOST_REQUIRE_EQUAL(hashed.index("foo"), -1);
+    BOOST_REQUIRE_EQUAL(hashed.index(""), -1);
+}
+
+BOOST_AUTO_TEST_CASE(dictionary__index_key__hashed_and_unhashed__same)
+{
+    using table = dictionary<test_dictionary_size>::table;
+    const dictionary<test_dictionary_size> hashed(language::es, test_words_es,
+        test_table);
+
+    for (const std::string word: { "abeja", "abuelo", "foo", "" })
+    {
+        const auto key = table::to_key(word);
+        BOOST_REQUIRE_EQUAL(hashed.index(word, key), instance.index(word));
+        BOOST_REQUIRE_EQUAL(instance.index(word, key), instance.index(word));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dictionary__contains2__hashed_words__expected)
+{
+    const dictionary<test_dictionary_size> hashed(language::es, test_words_es,
+        test_table);
+
+    BOOST_REQUIRE(hashed.contains(string_list
+    {
+        test_words_es.word[1],
+        test_words_es.word[3],
+        test_words_es.word[5]
+    }));
+
+    BOOST_REQUIRE(!hashed.contains(string_list
+    {
+        test_words_es.word[1],
+        "foo"
+    }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(perfect_hash_tests)
+
+using namespace bc::system::words;
+
+// First 10 words of BIP39 es, first word not sorted for C compare (<).
+constexpr perfect_hash<10>::words test_words
+{
+    "ábaco",
+    "abdomen",
+    "abeja",
+    "abierto",
+    "abogado",
+    "abono",
+    "aborto",
+    "abrazo",
+    "abrir",
+    "abuelo"
+};
+
+constexpr perfect_hash<10> test_table{ test_words };
+static_assert(test_table);
+static_assert(test_table.at(perfect_hash<10>::to_key("abeja")) == 2u);
+static_assert(test_table.at(perfect_hash<10>::to_key("abuelo")) == 9u);
+
+template <size_t Size>
+static bool is_perfect(const perfect_hash<Size>& table,
+    const std::array<const char*, Size>& words)
+{
+    for (size_t index = 0; index < Size; ++index)
+        if (table.at(perfect_hash<Size>::to_key(words[index])) != index)
+            return false;
+
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__size__10__10)
+{
+    BOOST_REQUIRE_EQUAL(perfect_hash<10>::size(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__construct__empty__invalid)
+{
+    BOOST_REQUIRE(!perfect_hash<0>({}));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__construct__duplicate_words__invalid)
+{
+    BOOST_REQUIRE(!perfect_hash<3>({ "abeja", "abono", "abeja" }));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__at__words__expected)
+{
+    BOOST_REQUIRE(test_table);
+    BOOST_REQUIRE(is_perfect(test_table, test_words));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__at__mnemonic_catalogs__expected)
+{
+    BOOST_REQUIRE(is_perfect(mnemonic::en_table(), mnemonic::en.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::es_table(), mnemonic::es.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::it_table(), mnemonic::it.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::fr_table(), mnemonic::fr.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::cs_table(), mnemonic::cs.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::pt_table(), mnemonic::pt.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::ja_table(), mnemonic::ja.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::ko_table(), mnemonic::ko.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::zh_Hans_table(), mnemonic::zh_Hans.word));
+    BOOST_REQUIRE(is_perfect(mnemonic::zh_Hant_table(), mnemonic::zh_Hant.word));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__at__electrum_v1_catalogs__expected)
+{
+    BOOST_REQUIRE(is_perfect(electrum_v1::en_table(), electrum_v1::en.word));
+    BOOST_REQUIRE(is_perfect(electrum_v1::pt_table(), electrum_v1::pt.word));
+}
+
+BOOST_AUTO_TEST_SUITE_END()